@@ -0,0 +1,894 @@
+#ifndef CPP2_S21_CONTAINERS_ADAPTIVE_RADIX_TREE
+#define CPP2_S21_CONTAINERS_ADAPTIVE_RADIX_TREE
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) && !defined(S21_NO_SIMD)
+#include <emmintrin.h>
+#endif
+
+namespace s21 {
+
+// A key as a string of bytes whose lexicographic order is the key order.
+// data_ points either into the key itself or into buffer_.
+struct art_key_bytes {
+  const unsigned char *data_;
+  std::size_t size_;
+  unsigned char buffer_[8];
+};
+
+// Fills an art_key_bytes for a key. Specializations exist for the integral
+// types and std::string; other key types can add their own.
+template <typename Key, typename Enable = void>
+struct art_key_traits;
+
+// Big-endian bytes, with the sign bit flipped so that negative values sort
+// first.
+template <typename Key>
+struct art_key_traits<Key, std::enable_if_t<std::is_integral<Key>::value>> {
+  static void encode(const Key &key, art_key_bytes &out) {
+    std::uint64_t bits = static_cast<std::make_unsigned_t<Key>>(key);
+    if (std::is_signed<Key>::value) {
+      bits ^= std::uint64_t(1) << (sizeof(Key) * 8 - 1);
+    }
+    for (std::size_t i = sizeof(Key); i-- > 0; bits >>= 8) {
+      out.buffer_[i] = static_cast<unsigned char>(bits);
+    }
+    out.data_ = out.buffer_;
+    out.size_ = sizeof(Key);
+  }
+};
+
+template <>
+struct art_key_traits<std::string> {
+  static void encode(const std::string &key, art_key_bytes &out) {
+    out.data_ = reinterpret_cast<const unsigned char *>(key.data());
+    out.size_ = key.size();
+  }
+};
+
+// Adaptive radix tree (Leis et al., "The Adaptive Radix Tree"). Each inner
+// node branches on one byte of the key and comes in four sizes: Node4 and
+// Node16 keep sorted key bytes next to their children, Node16 searched with
+// one SSE2 comparison; Node48 maps all 256 bytes to 48 child slots; Node256
+// indexes its children directly. Nodes grow and shrink between the sizes as
+// children come and go, so sparse levels stay small.
+//
+// Chains of single-child nodes are collapsed into a prefix stored in the
+// node below them. Up to kMaxPrefix bytes of it are kept inline; lookups
+// skip the rest and check the whole key once they reach a leaf, while
+// inserts and erases read the missing bytes from any leaf under the node.
+// A key that is a prefix of other keys ends in an inner node, whose end_
+// holds its leaf.
+//
+// Leaves hold the values and are also chained in key order, so iterators
+// are bidirectional and stepping one is O(1).
+template <typename Value, typename Key, typename KeyOf,
+          typename Traits = art_key_traits<Key>>
+class adaptive_radix_tree {
+ public:
+  using value_type = Value;
+  using key_type = Key;
+  using size_type = std::size_t;
+
+ private:
+  struct Leaf {
+    Leaf *prev_;
+    Leaf *next_;
+    value_type value_;
+
+    template <typename... Args>
+    explicit Leaf(Args &&...args)
+        : prev_(nullptr), next_(nullptr), value_(std::forward<Args>(args)...) {}
+  };
+
+  // A child slot: 0 when empty, a Leaf pointer with the low bit set, or a
+  // Node pointer.
+  using Ref = std::uintptr_t;
+
+  enum NodeType : std::uint8_t { kNode4, kNode16, kNode48, kNode256 };
+  static constexpr std::uint32_t kMaxPrefix = 8;
+
+  struct Node {
+    NodeType type_;
+    std::uint16_t count_;
+    std::uint32_t prefixLen_;
+    unsigned char prefix_[kMaxPrefix];
+    Leaf *end_;
+  };
+  struct Node4 : Node {
+    unsigned char keys_[4];
+    Ref children_[4];
+  };
+  struct Node16 : Node {
+    unsigned char keys_[16];
+    Ref children_[16];
+  };
+  // index_[byte] is one past the child's slot, or 0 for none.
+  struct Node48 : Node {
+    unsigned char index_[256];
+    Ref children_[48];
+  };
+  struct Node256 : Node {
+    Ref children_[256];
+  };
+
+  Ref root_;
+  Leaf *first_;
+  Leaf *last_;
+  size_type size_;
+
+  static bool isLeaf(Ref ref) { return ref & 1; }
+  static Leaf *leafOf(Ref ref) { return reinterpret_cast<Leaf *>(ref - 1); }
+  static Node *nodeOf(Ref ref) { return reinterpret_cast<Node *>(ref); }
+  static Ref refOf(Leaf *leaf) { return reinterpret_cast<Ref>(leaf) + 1; }
+  static Ref refOf(Node *node) { return reinterpret_cast<Ref>(node); }
+
+  static void encode(const key_type &key, art_key_bytes &out) {
+    Traits::encode(key, out);
+  }
+  static void encodeLeaf(const Leaf *leaf, art_key_bytes &out) {
+    Traits::encode(KeyOf()(leaf->value_), out);
+  }
+  static int compare(const art_key_bytes &a, const art_key_bytes &b) {
+    std::size_t n = a.size_ < b.size_ ? a.size_ : b.size_;
+    int res = n ? std::memcmp(a.data_, b.data_, n) : 0;
+    if (res != 0) return res;
+    return a.size_ < b.size_ ? -1 : (a.size_ > b.size_ ? 1 : 0);
+  }
+  static bool leafEquals(const Leaf *leaf, const art_key_bytes &key) {
+    art_key_bytes bytes;
+    encodeLeaf(leaf, bytes);
+    return bytes.size_ == key.size_ &&
+           (key.size_ == 0 ||
+            std::memcmp(bytes.data_, key.data_, key.size_) == 0);
+  }
+
+  template <typename N>
+  static N *newNode(NodeType type) {
+    N *node = new N();
+    node->type_ = type;
+    return node;
+  }
+  static void copyHeader(Node *to, const Node *from) {
+    to->count_ = from->count_;
+    to->prefixLen_ = from->prefixLen_;
+    std::memcpy(to->prefix_, from->prefix_, kMaxPrefix);
+    to->end_ = from->end_;
+  }
+  static void deleteNode(Node *node) {
+    switch (node->type_) {
+      case kNode4:
+        delete static_cast<Node4 *>(node);
+        break;
+      case kNode16:
+        delete static_cast<Node16 *>(node);
+        break;
+      case kNode48:
+        delete static_cast<Node48 *>(node);
+        break;
+      case kNode256:
+        delete static_cast<Node256 *>(node);
+        break;
+    }
+  }
+
+  // Bit i of the result stands for keys[i], among the first count keys of
+  // a Node16: matchEqual sets it when keys[i] == byte, matchGreater when
+  // keys[i] > byte.
+  static unsigned matchEqual(const unsigned char *keys, unsigned count,
+                             unsigned char byte) {
+#if defined(__SSE2__) && !defined(S21_NO_SIMD)
+    __m128i cmp = _mm_cmpeq_epi8(
+        _mm_set1_epi8(static_cast<char>(byte)),
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(keys)));
+    unsigned mask = unsigned(_mm_movemask_epi8(cmp));
+#else
+    unsigned mask = 0;
+    for (unsigned i = 0; i < 16; i++) mask |= unsigned(keys[i] == byte) << i;
+#endif
+    return mask & ((1u << count) - 1);
+  }
+  static unsigned matchGreater(const unsigned char *keys, unsigned count,
+                               unsigned char byte) {
+#if defined(__SSE2__) && !defined(S21_NO_SIMD)
+    // SSE2 only compares signed bytes; flipping the top bit of both sides
+    // turns that into an unsigned comparison.
+    const __m128i flip = _mm_set1_epi8(static_cast<char>(0x80));
+    __m128i cmp = _mm_cmpgt_epi8(
+        _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(keys)),
+                      flip),
+        _mm_xor_si128(_mm_set1_epi8(static_cast<char>(byte)), flip));
+    unsigned mask = unsigned(_mm_movemask_epi8(cmp));
+#else
+    unsigned mask = 0;
+    for (unsigned i = 0; i < 16; i++) mask |= unsigned(keys[i] > byte) << i;
+#endif
+    return mask & ((1u << count) - 1);
+  }
+
+  static Ref *findChild(Node *node, unsigned char byte) {
+    switch (node->type_) {
+      case kNode4: {
+        Node4 *n = static_cast<Node4 *>(node);
+        for (unsigned i = 0; i < n->count_; i++) {
+          if (n->keys_[i] == byte) return &n->children_[i];
+        }
+        return nullptr;
+      }
+      case kNode16: {
+        Node16 *n = static_cast<Node16 *>(node);
+        unsigned mask = matchEqual(n->keys_, n->count_, byte);
+        return mask ? &n->children_[__builtin_ctz(mask)] : nullptr;
+      }
+      case kNode48: {
+        Node48 *n = static_cast<Node48 *>(node);
+        unsigned slot = n->index_[byte];
+        return slot ? &n->children_[slot - 1] : nullptr;
+      }
+      case kNode256: {
+        Node256 *n = static_cast<Node256 *>(node);
+        return n->children_[byte] ? &n->children_[byte] : nullptr;
+      }
+    }
+    return nullptr;
+  }
+
+  // First child whose byte is at least from, with its byte, or 0.
+  static Ref childFrom(const Node *node, unsigned from, unsigned char &byte) {
+    switch (node->type_) {
+      case kNode4: {
+        const Node4 *n = static_cast<const Node4 *>(node);
+        for (unsigned i = 0; i < n->count_; i++) {
+          if (n->keys_[i] >= from) {
+            byte = n->keys_[i];
+            return n->children_[i];
+          }
+        }
+        return 0;
+      }
+      case kNode16: {
+        const Node16 *n = static_cast<const Node16 *>(node);
+        if (from == 0) {
+          if (n->count_ == 0) return 0;
+          byte = n->keys_[0];
+          return n->children_[0];
+        }
+        unsigned mask = matchGreater(n->keys_, n->count_,
+                                     static_cast<unsigned char>(from - 1));
+        if (mask == 0) return 0;
+        byte = n->keys_[__builtin_ctz(mask)];
+        return n->children_[__builtin_ctz(mask)];
+      }
+      case kNode48: {
+        const Node48 *n = static_cast<const Node48 *>(node);
+        for (unsigned b = from; b < 256; b++) {
+          if (n->index_[b]) {
+            byte = static_cast<unsigned char>(b);
+            return n->children_[n->index_[b] - 1];
+          }
+        }
+        return 0;
+      }
+      case kNode256: {
+        const Node256 *n = static_cast<const Node256 *>(node);
+        for (unsigned b = from; b < 256; b++) {
+          if (n->children_[b]) {
+            byte = static_cast<unsigned char>(b);
+            return n->children_[b];
+          }
+        }
+        return 0;
+      }
+    }
+    return 0;
+  }
+
+  static Leaf *minimumLeaf(Ref ref) {
+    while (!isLeaf(ref)) {
+      const Node *node = nodeOf(ref);
+      if (node->end_) return node->end_;
+      unsigned char byte;
+      ref = childFrom(node, 0, byte);
+    }
+    return leafOf(ref);
+  }
+
+  // Adds child under byte, which must be absent, growing node into the
+  // next size when it is full; slot is the reference to node.
+  static void addChild(Ref &slot, Node *node, unsigned char byte, Ref child) {
+    switch (node->type_) {
+      case kNode4: {
+        Node4 *n = static_cast<Node4 *>(node);
+        if (n->count_ < 4) {
+          unsigned pos = 0;
+          while (pos < n->count_ && n->keys_[pos] < byte) pos++;
+          std::memmove(n->keys_ + pos + 1, n->keys_ + pos, n->count_ - pos);
+          std::memmove(n->children_ + pos + 1, n->children_ + pos,
+                       (n->count_ - pos) * sizeof(Ref));
+          n->keys_[pos] = byte;
+          n->children_[pos] = child;
+          n->count_++;
+          return;
+        }
+        Node16 *grown = newNode<Node16>(kNode16);
+        copyHeader(grown, n);
+        std::memcpy(grown->keys_, n->keys_, 4);
+        std::memcpy(grown->children_, n->children_, 4 * sizeof(Ref));
+        delete n;
+        slot = refOf(grown);
+        addChild(slot, grown, byte, child);
+        return;
+      }
+      case kNode16: {
+        Node16 *n = static_cast<Node16 *>(node);
+        if (n->count_ < 16) {
+          unsigned mask = matchGreater(n->keys_, n->count_, byte);
+          unsigned pos = mask ? unsigned(__builtin_ctz(mask)) : n->count_;
+          std::memmove(n->keys_ + pos + 1, n->keys_ + pos, n->count_ - pos);
+          std::memmove(n->children_ + pos + 1, n->children_ + pos,
+                       (n->count_ - pos) * sizeof(Ref));
+          n->keys_[pos] = byte;
+          n->children_[pos] = child;
+          n->count_++;
+          return;
+        }
+        Node48 *grown = newNode<Node48>(kNode48);
+        copyHeader(grown, n);
+        for (unsigned i = 0; i < 16; i++) {
+          grown->index_[n->keys_[i]] = static_cast<unsigned char>(i + 1);
+          grown->children_[i] = n->children_[i];
+        }
+        delete n;
+        slot = refOf(grown);
+        addChild(slot, grown, byte, child);
+        return;
+      }
+      case kNode48: {
+        Node48 *n = static_cast<Node48 *>(node);
+        if (n->count_ < 48) {
+          unsigned pos = 0;
+          while (n->children_[pos]) pos++;
+          n->children_[pos] = child;
+          n->index_[byte] = static_cast<unsigned char>(pos + 1);
+          n->count_++;
+          return;
+        }
+        Node256 *grown = newNode<Node256>(kNode256);
+        copyHeader(grown, n);
+        for (unsigned b = 0; b < 256; b++) {
+          if (n->index_[b]) {
+            grown->children_[b] = n->children_[n->index_[b] - 1];
+          }
+        }
+        delete n;
+        slot = refOf(grown);
+        addChild(slot, grown, byte, child);
+        return;
+      }
+      case kNode256: {
+        Node256 *n = static_cast<Node256 *>(node);
+        n->children_[byte] = child;
+        n->count_++;
+        return;
+      }
+    }
+  }
+
+  // Shrinks node into the next smaller size once it falls well below its
+  // capacity, and dissolves a Node4 that no longer branches: its only
+  // entry takes its place, with the prefixes joined.
+  static void shrink(Ref &slot, Node *node) {
+    switch (node->type_) {
+      case kNode4: {
+        Node4 *n = static_cast<Node4 *>(node);
+        if (n->count_ == 0 && n->end_ != nullptr) {
+          slot = refOf(n->end_);
+          delete n;
+        } else if (n->count_ == 1 && n->end_ == nullptr) {
+          Ref child = n->children_[0];
+          if (!isLeaf(child)) {
+            Node *c = nodeOf(child);
+            unsigned char joined[kMaxPrefix];
+            std::uint32_t len = 0;
+            for (; len < n->prefixLen_ && len < kMaxPrefix; len++) {
+              joined[len] = n->prefix_[len];
+            }
+            if (len < kMaxPrefix) joined[len++] = n->keys_[0];
+            for (std::uint32_t i = 0; i < c->prefixLen_ && len < kMaxPrefix;
+                 i++) {
+              joined[len++] = c->prefix_[i];
+            }
+            std::memcpy(c->prefix_, joined, len);
+            c->prefixLen_ += n->prefixLen_ + 1;
+          }
+          slot = child;
+          delete n;
+        }
+        return;
+      }
+      case kNode16: {
+        Node16 *n = static_cast<Node16 *>(node);
+        if (n->count_ > 3) return;
+        Node4 *shrunk = newNode<Node4>(kNode4);
+        copyHeader(shrunk, n);
+        std::memcpy(shrunk->keys_, n->keys_, n->count_);
+        std::memcpy(shrunk->children_, n->children_, n->count_ * sizeof(Ref));
+        delete n;
+        slot = refOf(shrunk);
+        return;
+      }
+      case kNode48: {
+        Node48 *n = static_cast<Node48 *>(node);
+        if (n->count_ > 12) return;
+        Node16 *shrunk = newNode<Node16>(kNode16);
+        copyHeader(shrunk, n);
+        unsigned pos = 0;
+        for (unsigned b = 0; b < 256; b++) {
+          if (n->index_[b] == 0) continue;
+          shrunk->keys_[pos] = static_cast<unsigned char>(b);
+          shrunk->children_[pos++] = n->children_[n->index_[b] - 1];
+        }
+        delete n;
+        slot = refOf(shrunk);
+        return;
+      }
+      case kNode256: {
+        Node256 *n = static_cast<Node256 *>(node);
+        if (n->count_ > 37) return;
+        Node48 *shrunk = newNode<Node48>(kNode48);
+        copyHeader(shrunk, n);
+        unsigned pos = 0;
+        for (unsigned b = 0; b < 256; b++) {
+          if (n->children_[b] == 0) continue;
+          shrunk->index_[b] = static_cast<unsigned char>(pos + 1);
+          shrunk->children_[pos++] = n->children_[b];
+        }
+        delete n;
+        slot = refOf(shrunk);
+        return;
+      }
+    }
+  }
+
+  static void removeChild(Ref &slot, Node *node, unsigned char byte) {
+    switch (node->type_) {
+      case kNode4:
+      case kNode16: {
+        unsigned char *keys = node->type_ == kNode4
+                                  ? static_cast<Node4 *>(node)->keys_
+                                  : static_cast<Node16 *>(node)->keys_;
+        Ref *children = node->type_ == kNode4
+                            ? static_cast<Node4 *>(node)->children_
+                            : static_cast<Node16 *>(node)->children_;
+        unsigned pos = 0;
+        while (keys[pos] != byte) pos++;
+        std::memmove(keys + pos, keys + pos + 1, node->count_ - pos - 1);
+        std::memmove(children + pos, children + pos + 1,
+                     (node->count_ - pos - 1) * sizeof(Ref));
+        break;
+      }
+      case kNode48: {
+        Node48 *n = static_cast<Node48 *>(node);
+        n->children_[n->index_[byte] - 1] = 0;
+        n->index_[byte] = 0;
+        break;
+      }
+      case kNode256:
+        static_cast<Node256 *>(node)->children_[byte] = 0;
+        break;
+    }
+    node->count_--;
+    shrink(slot, node);
+  }
+
+  // Byte i of node's prefix, which starts at depth in every key below it.
+  static unsigned char prefixByte(const Node *node, std::size_t depth,
+                                  std::uint32_t i) {
+    if (i < kMaxPrefix) return node->prefix_[i];
+    art_key_bytes bytes;
+    encodeLeaf(minimumLeaf(refOf(const_cast<Node *>(node))), bytes);
+    return bytes.data_[depth + i];
+  }
+
+  // Index of the first byte of node's prefix that key does not share, or
+  // prefixLen_ if key continues through the whole prefix.
+  static std::uint32_t prefixMismatch(const Node *node,
+                                      const art_key_bytes &key,
+                                      std::size_t depth) {
+    std::uint32_t stored =
+        node->prefixLen_ < kMaxPrefix ? node->prefixLen_ : kMaxPrefix;
+    for (std::uint32_t i = 0; i < stored; i++) {
+      if (depth + i >= key.size_ || node->prefix_[i] != key.data_[depth + i]) {
+        return i;
+      }
+    }
+    if (node->prefixLen_ <= kMaxPrefix) return node->prefixLen_;
+    art_key_bytes bytes;
+    encodeLeaf(minimumLeaf(refOf(const_cast<Node *>(node))), bytes);
+    for (std::uint32_t i = kMaxPrefix; i < node->prefixLen_; i++) {
+      if (depth + i >= key.size_ ||
+          bytes.data_[depth + i] != key.data_[depth + i]) {
+        return i;
+      }
+    }
+    return node->prefixLen_;
+  }
+
+  // Checks only the inline bytes of the prefix; the caller compares the
+  // whole key against the leaf it ends at.
+  static bool prefixMayMatch(const Node *node, const art_key_bytes &key,
+                             std::size_t depth) {
+    if (depth + node->prefixLen_ > key.size_) return false;
+    std::uint32_t stored =
+        node->prefixLen_ < kMaxPrefix ? node->prefixLen_ : kMaxPrefix;
+    return stored == 0 ||
+           std::memcmp(node->prefix_, key.data_ + depth, stored) == 0;
+  }
+
+  // Places leaf, whose key runs through the prefix of a fresh node n, under
+  // n at depth.
+  static void attach(Node4 *n, Leaf *leaf, const art_key_bytes &key,
+                     std::size_t depth) {
+    if (depth == key.size_) {
+      n->end_ = leaf;
+    } else {
+      Ref slot = refOf(n);
+      addChild(slot, n, key.data_[depth], refOf(leaf));
+    }
+  }
+
+  // Links leaf, which must not be in the tree, below slot.
+  void insertAt(Ref &slot, Leaf *leaf, const art_key_bytes &key,
+                std::size_t depth) {
+    if (slot == 0) {
+      slot = refOf(leaf);
+      return;
+    }
+    if (isLeaf(slot)) {
+      // Two leaves: a Node4 over the bytes they share tells them apart.
+      Leaf *other = leafOf(slot);
+      art_key_bytes bytes;
+      encodeLeaf(other, bytes);
+      std::size_t common = 0;
+      while (depth + common < key.size_ && depth + common < bytes.size_ &&
+             key.data_[depth + common] == bytes.data_[depth + common]) {
+        common++;
+      }
+      Node4 *n = newNode<Node4>(kNode4);
+      n->prefixLen_ = static_cast<std::uint32_t>(common);
+      std::memcpy(n->prefix_, key.data_ + depth,
+                  common < kMaxPrefix ? common : kMaxPrefix);
+      attach(n, other, bytes, depth + common);
+      attach(n, leaf, key, depth + common);
+      slot = refOf(n);
+      return;
+    }
+    Node *node = nodeOf(slot);
+    if (node->prefixLen_) {
+      std::uint32_t mismatch = prefixMismatch(node, key, depth);
+      if (mismatch < node->prefixLen_) {
+        // key leaves the prefix early: a Node4 over the shared part takes
+        // node's place, with node below it under its next prefix byte.
+        Node4 *parent = newNode<Node4>(kNode4);
+        parent->prefixLen_ = mismatch;
+        std::memcpy(parent->prefix_, node->prefix_,
+                    mismatch < kMaxPrefix ? mismatch : kMaxPrefix);
+        unsigned char edge = prefixByte(node, depth, mismatch);
+        if (node->prefixLen_ <= kMaxPrefix) {
+          node->prefixLen_ -= mismatch + 1;
+          std::memmove(node->prefix_, node->prefix_ + mismatch + 1,
+                       node->prefixLen_);
+        } else {
+          art_key_bytes bytes;
+          encodeLeaf(minimumLeaf(slot), bytes);
+          node->prefixLen_ -= mismatch + 1;
+          std::memcpy(node->prefix_, bytes.data_ + depth + mismatch + 1,
+                      node->prefixLen_ < kMaxPrefix ? node->prefixLen_
+                                                    : kMaxPrefix);
+        }
+        Ref parentRef = refOf(parent);
+        addChild(parentRef, parent, edge, slot);
+        attach(parent, leaf, key, depth + mismatch);
+        slot = parentRef;
+        return;
+      }
+      depth += node->prefixLen_;
+    }
+    if (depth == key.size_) {
+      node->end_ = leaf;
+      return;
+    }
+    Ref *child = findChild(node, key.data_[depth]);
+    if (child != nullptr) {
+      insertAt(*child, leaf, key, depth + 1);
+    } else {
+      addChild(slot, node, key.data_[depth], refOf(leaf));
+    }
+  }
+
+  // Unlinks the leaf of key from below slot and returns it, or nullptr.
+  Leaf *eraseAt(Ref &slot, const art_key_bytes &key, std::size_t depth) {
+    if (slot == 0) return nullptr;
+    if (isLeaf(slot)) {
+      Leaf *leaf = leafOf(slot);
+      if (!leafEquals(leaf, key)) return nullptr;
+      slot = 0;
+      return leaf;
+    }
+    Node *node = nodeOf(slot);
+    if (!prefixMayMatch(node, key, depth)) return nullptr;
+    depth += node->prefixLen_;
+    if (depth == key.size_) {
+      Leaf *leaf = node->end_;
+      if (leaf == nullptr || !leafEquals(leaf, key)) return nullptr;
+      node->end_ = nullptr;
+      shrink(slot, node);
+      return leaf;
+    }
+    Ref *child = findChild(node, key.data_[depth]);
+    if (child == nullptr) return nullptr;
+    if (isLeaf(*child)) {
+      Leaf *leaf = leafOf(*child);
+      if (!leafEquals(leaf, key)) return nullptr;
+      removeChild(slot, node, key.data_[depth]);
+      return leaf;
+    }
+    return eraseAt(*child, key, depth + 1);
+  }
+
+  Leaf *findLeaf(const art_key_bytes &key) const {
+    std::size_t depth = 0;
+    for (Ref ref = root_; ref != 0;) {
+      if (isLeaf(ref)) {
+        Leaf *leaf = leafOf(ref);
+        return leafEquals(leaf, key) ? leaf : nullptr;
+      }
+      Node *node = nodeOf(ref);
+      if (!prefixMayMatch(node, key, depth)) return nullptr;
+      depth += node->prefixLen_;
+      if (depth == key.size_) {
+        Leaf *leaf = node->end_;
+        return leaf && leafEquals(leaf, key) ? leaf : nullptr;
+      }
+      Ref *child = findChild(node, key.data_[depth]);
+      if (child == nullptr) return nullptr;
+      ref = *child;
+      depth++;
+    }
+    return nullptr;
+  }
+
+  // First leaf below ref whose key is not less than key, or nullptr. Every
+  // key below ref shares the first depth bytes of key.
+  static Leaf *lowerBoundAt(Ref ref, const art_key_bytes &key,
+                            std::size_t depth) {
+    if (isLeaf(ref)) {
+      art_key_bytes bytes;
+      encodeLeaf(leafOf(ref), bytes);
+      return compare(bytes, key) >= 0 ? leafOf(ref) : nullptr;
+    }
+    const Node *node = nodeOf(ref);
+    std::uint32_t mismatch = prefixMismatch(node, key, depth);
+    if (mismatch < node->prefixLen_) {
+      // Every key below node is greater than key, or every one is less.
+      if (depth + mismatch == key.size_ ||
+          prefixByte(node, depth, mismatch) > key.data_[depth + mismatch]) {
+        return minimumLeaf(ref);
+      }
+      return nullptr;
+    }
+    depth += node->prefixLen_;
+    if (depth == key.size_) return minimumLeaf(ref);
+    unsigned char want = key.data_[depth];
+    unsigned char byte = 0;
+    Ref child = childFrom(node, want, byte);
+    if (child != 0 && byte == want) {
+      Leaf *res = lowerBoundAt(child, key, depth + 1);
+      if (res != nullptr) return res;
+      child = want < 255 ? childFrom(node, want + 1u, byte) : 0;
+    }
+    return child != 0 ? minimumLeaf(child) : nullptr;
+  }
+
+  void destroy(Ref ref) {
+    if (ref == 0) return;
+    if (isLeaf(ref)) {
+      delete leafOf(ref);
+      return;
+    }
+    Node *node = nodeOf(ref);
+    if (node->end_) delete node->end_;
+    unsigned char byte = 0;
+    for (Ref child = childFrom(node, 0, byte); child != 0;
+         child = byte < 255 ? childFrom(node, byte + 1u, byte) : 0) {
+      destroy(child);
+    }
+    deleteNode(node);
+  }
+
+ public:
+  template <bool Const>
+  class ArtIterator {
+    friend class adaptive_radix_tree;
+    template <bool>
+    friend class ArtIterator;
+
+    Leaf *leaf_;
+    const adaptive_radix_tree *tree_;
+
+    ArtIterator(Leaf *leaf, const adaptive_radix_tree *tree)
+        : leaf_(leaf), tree_(tree) {}
+
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Value;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::conditional_t<Const, const Value &, Value &>;
+    using pointer = std::conditional_t<Const, const Value *, Value *>;
+
+    ArtIterator() : leaf_(nullptr), tree_(nullptr) {}
+    template <bool OtherConst,
+              typename = std::enable_if_t<Const && !OtherConst>>
+    ArtIterator(const ArtIterator<OtherConst> &other)
+        : leaf_(other.leaf_), tree_(other.tree_) {}
+
+    reference operator*() const { return leaf_->value_; }
+    pointer operator->() const { return &leaf_->value_; }
+
+    ArtIterator &operator++() {
+      leaf_ = leaf_->next_;
+      return *this;
+    }
+    ArtIterator operator++(int) {
+      ArtIterator tmp(*this);
+      ++*this;
+      return tmp;
+    }
+    // Decrementing end() gives the largest key.
+    ArtIterator &operator--() {
+      leaf_ = leaf_ ? leaf_->prev_ : tree_->last_;
+      return *this;
+    }
+    ArtIterator operator--(int) {
+      ArtIterator tmp(*this);
+      --*this;
+      return tmp;
+    }
+
+    bool operator==(const ArtIterator &other) const {
+      return leaf_ == other.leaf_;
+    }
+    bool operator!=(const ArtIterator &other) const {
+      return leaf_ != other.leaf_;
+    }
+  };
+
+  using iterator = ArtIterator<false>;
+  using const_iterator = ArtIterator<true>;
+
+  adaptive_radix_tree()
+      : root_(0), first_(nullptr), last_(nullptr), size_(0) {}
+  adaptive_radix_tree(const adaptive_radix_tree &other)
+      : adaptive_radix_tree() {
+    try {
+      for (Leaf *leaf = other.first_; leaf; leaf = leaf->next_) {
+        insertUnique(KeyOf()(leaf->value_), leaf->value_);
+      }
+    } catch (...) {
+      clear();
+      throw;
+    }
+  }
+  adaptive_radix_tree(adaptive_radix_tree &&other) noexcept
+      : adaptive_radix_tree() {
+    swap(other);
+  }
+  ~adaptive_radix_tree() { clear(); }
+
+  adaptive_radix_tree &operator=(const adaptive_radix_tree &other) {
+    if (this != &other) {
+      adaptive_radix_tree tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+  adaptive_radix_tree &operator=(adaptive_radix_tree &&other) noexcept {
+    if (this != &other) {
+      adaptive_radix_tree tmp(std::move(other));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  void swap(adaptive_radix_tree &other) noexcept {
+    std::swap(root_, other.root_);
+    std::swap(first_, other.first_);
+    std::swap(last_, other.last_);
+    std::swap(size_, other.size_);
+  }
+
+  void clear() {
+    destroy(root_);
+    root_ = 0;
+    first_ = last_ = nullptr;
+    size_ = 0;
+  }
+
+  size_type getSize() const { return size_; }
+
+  iterator begin() { return iterator(first_, this); }
+  iterator end() { return iterator(nullptr, this); }
+  const_iterator begin() const { return const_iterator(first_, this); }
+  const_iterator end() const { return const_iterator(nullptr, this); }
+
+  iterator find(const key_type &key) {
+    art_key_bytes bytes;
+    encode(key, bytes);
+    return iterator(findLeaf(bytes), this);
+  }
+  const_iterator find(const key_type &key) const {
+    return const_cast<adaptive_radix_tree *>(this)->find(key);
+  }
+  iterator lowerBound(const key_type &key) {
+    if (root_ == 0) return end();
+    art_key_bytes bytes;
+    encode(key, bytes);
+    return iterator(lowerBoundAt(root_, bytes, 0), this);
+  }
+  iterator upperBound(const key_type &key) {
+    art_key_bytes bytes;
+    encode(key, bytes);
+    iterator res = lowerBound(key);
+    if (res != end() && leafEquals(res.leaf_, bytes)) ++res;
+    return res;
+  }
+
+  // Inserts a value built from args unless key is present. The leaf is
+  // chained in front of the lower bound found before linking it in.
+  template <typename... Args>
+  std::pair<iterator, bool> insertUnique(const key_type &key,
+                                         Args &&...args) {
+    iterator next = lowerBound(key);
+    art_key_bytes bytes;
+    encode(key, bytes);
+    if (next != end() && leafEquals(next.leaf_, bytes)) return {next, false};
+    Leaf *leaf = new Leaf(std::forward<Args>(args)...);
+    encodeLeaf(leaf, bytes);
+    try {
+      insertAt(root_, leaf, bytes, 0);
+    } catch (...) {
+      delete leaf;
+      throw;
+    }
+    leaf->next_ = next.leaf_;
+    leaf->prev_ = next.leaf_ ? next.leaf_->prev_ : last_;
+    (leaf->prev_ ? leaf->prev_->next_ : first_) = leaf;
+    (leaf->next_ ? leaf->next_->prev_ : last_) = leaf;
+    size_++;
+    return {iterator(leaf, this), true};
+  }
+
+  size_type erase(const key_type &key) {
+    art_key_bytes bytes;
+    encode(key, bytes);
+    Leaf *leaf = eraseAt(root_, bytes, 0);
+    if (leaf == nullptr) return 0;
+    (leaf->prev_ ? leaf->prev_->next_ : first_) = leaf->next_;
+    (leaf->next_ ? leaf->next_->prev_ : last_) = leaf->prev_;
+    delete leaf;
+    size_--;
+    return 1;
+  }
+  void erase(const_iterator pos) { erase(KeyOf()(pos.leaf_->value_)); }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_ADAPTIVE_RADIX_TREE
@@ -0,0 +1,670 @@
+#ifndef CPP2_S21_CONTAINERS_B_PLUS_TREE
+#define CPP2_S21_CONTAINERS_B_PLUS_TREE
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) && !defined(S21_NO_SIMD)
+#include <emmintrin.h>
+#endif
+
+namespace s21 {
+
+// Number of the n sorted keys at keys that are less than key, i.e. the
+// lower-bound position of key inside one node.
+template <typename K>
+std::size_t node_lower_bound(const K *keys, std::size_t n, const K &key) {
+  return std::size_t(std::lower_bound(keys, keys + n, key) - keys);
+}
+
+// Number of the n sorted keys at keys that are not greater than key.
+template <typename K>
+std::size_t node_upper_bound(const K *keys, std::size_t n, const K &key) {
+  return std::size_t(std::upper_bound(keys, keys + n, key) - keys);
+}
+
+#if defined(__SSE2__) && !defined(S21_NO_SIMD)
+// Arithmetic keys are counted four (or two) at a time instead: one compare
+// and one movemask per step and no data-dependent branch. A node holds a few
+// cache lines of keys, and scanning all of them is cheaper than the
+// mispredicted branches of a binary search. Unsigned keys are compared as
+// signed after flipping their top bit.
+inline std::size_t simdCountInt32(const void *data, std::size_t n,
+                                  std::uint32_t key, std::uint32_t flip,
+                                  bool or_equal) {
+  const std::uint32_t *keys = static_cast<const std::uint32_t *>(data);
+  const __m128i bias = _mm_set1_epi32(int(flip));
+  const __m128i needle = _mm_set1_epi32(int(key ^ flip));
+  std::size_t res = 0;
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m128i v = _mm_xor_si128(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(keys + i)), bias);
+    __m128i hit = or_equal ? _mm_cmpgt_epi32(v, needle)
+                           : _mm_cmplt_epi32(v, needle);
+    int bits = __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(hit)));
+    res += or_equal ? 4 - bits : bits;
+  }
+  for (; i < n; i++) {
+    std::int32_t a = std::int32_t(keys[i] ^ flip);
+    std::int32_t b = std::int32_t(key ^ flip);
+    res += or_equal ? a <= b : a < b;
+  }
+  return res;
+}
+
+inline std::size_t node_lower_bound(const int *keys, std::size_t n,
+                                    const int &key) {
+  return simdCountInt32(keys, n, std::uint32_t(key), 0, false);
+}
+inline std::size_t node_upper_bound(const int *keys, std::size_t n,
+                                    const int &key) {
+  return simdCountInt32(keys, n, std::uint32_t(key), 0, true);
+}
+inline std::size_t node_lower_bound(const unsigned *keys, std::size_t n,
+                                    const unsigned &key) {
+  return simdCountInt32(keys, n, key, 0x80000000u, false);
+}
+inline std::size_t node_upper_bound(const unsigned *keys, std::size_t n,
+                                    const unsigned &key) {
+  return simdCountInt32(keys, n, key, 0x80000000u, true);
+}
+
+inline std::size_t simdCountFloat(const float *keys, std::size_t n, float key,
+                                  bool or_equal) {
+  const __m128 needle = _mm_set1_ps(key);
+  std::size_t res = 0;
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m128 v = _mm_loadu_ps(keys + i);
+    __m128 hit = or_equal ? _mm_cmple_ps(v, needle) : _mm_cmplt_ps(v, needle);
+    res += __builtin_popcount(_mm_movemask_ps(hit));
+  }
+  for (; i < n; i++) res += or_equal ? keys[i] <= key : keys[i] < key;
+  return res;
+}
+
+inline std::size_t node_lower_bound(const float *keys, std::size_t n,
+                                    const float &key) {
+  return simdCountFloat(keys, n, key, false);
+}
+inline std::size_t node_upper_bound(const float *keys, std::size_t n,
+                                    const float &key) {
+  return simdCountFloat(keys, n, key, true);
+}
+
+inline std::size_t simdCountDouble(const double *keys, std::size_t n,
+                                   double key, bool or_equal) {
+  const __m128d needle = _mm_set1_pd(key);
+  std::size_t res = 0;
+  std::size_t i = 0;
+  for (; i + 2 <= n; i += 2) {
+    __m128d v = _mm_loadu_pd(keys + i);
+    __m128d hit = or_equal ? _mm_cmple_pd(v, needle) : _mm_cmplt_pd(v, needle);
+    res += __builtin_popcount(_mm_movemask_pd(hit));
+  }
+  for (; i < n; i++) res += or_equal ? keys[i] <= key : keys[i] < key;
+  return res;
+}
+
+inline std::size_t node_lower_bound(const double *keys, std::size_t n,
+                                    const double &key) {
+  return simdCountDouble(keys, n, key, false);
+}
+inline std::size_t node_upper_bound(const double *keys, std::size_t n,
+                                    const double &key) {
+  return simdCountDouble(keys, n, key, true);
+}
+#endif
+
+// B+-tree with the interface map, set and multiset expect of their backing
+// tree, as an alternative to RBTree. Pass it as the last template argument,
+// e.g. s21::map<int, int, s21::BPlusTree>.
+//
+// Every node holds up to kSlots keys, chosen so that the keys fill four
+// cache lines; a lookup therefore costs one or two misses per level, and
+// the tree is about log_32(n) levels deep instead of the 2 log_2(n) of a
+// red-black tree. Inner nodes hold only separator keys and child pointers;
+// all values live in the leaves, which are chained in both directions so
+// that iteration walks arrays instead of climbing the tree. Keys and values
+// are kept in separate arrays so that searching a leaf touches only keys.
+// Nodes split in half when full, except that appending past the last key of
+// the last leaf starts a new leaf, so sorted loads fill leaves completely.
+// Nodes that fall under half full borrow from or merge with a sibling.
+//
+// Inserting or erasing may move values between nodes, which invalidates
+// iterators into the affected leaves.
+template <typename K, typename V>
+class BPlusTree {
+ public:
+  using size_type = std::size_t;
+
+  static constexpr size_type kNodeKeyBytes = 256;
+  static constexpr size_type kSlots =
+      kNodeKeyBytes / sizeof(K) < 8
+          ? 8
+          : (kNodeKeyBytes / sizeof(K) > 64 ? 64
+                                            : kNodeKeyBytes / sizeof(K) & ~1);
+
+ private:
+  static constexpr size_type kMinSlots = kSlots / 2 - 1;
+
+  struct Inner;
+
+  struct NodeBase {
+    bool leaf_;
+    unsigned short count_;
+    Inner *parent_;
+    explicit NodeBase(bool leaf) : leaf_(leaf), count_(0), parent_(nullptr) {}
+  };
+
+  struct Leaf : NodeBase {
+    K keys_[kSlots];
+    Leaf *prev_;
+    Leaf *next_;
+    alignas(V) unsigned char storage_[sizeof(V) * kSlots];
+
+    Leaf() : NodeBase(true), keys_(), prev_(nullptr), next_(nullptr) {}
+    V *values() { return reinterpret_cast<V *>(storage_); }
+  };
+
+  struct Inner : NodeBase {
+    K keys_[kSlots];
+    NodeBase *children_[kSlots + 1];
+
+    Inner() : NodeBase(false), keys_(), children_() {}
+  };
+
+  NodeBase *root_;
+  Leaf *first_;
+  Leaf *last_;
+  size_type size_;
+
+ public:
+  template <bool Const>
+  class BPlusTreeIterator {
+    friend class BPlusTree;
+    template <bool>
+    friend class BPlusTreeIterator;
+
+    Leaf *leaf_;
+    size_type pos_;
+    const BPlusTree *tree_;
+
+    BPlusTreeIterator(Leaf *leaf, size_type pos, const BPlusTree *tree)
+        : leaf_(leaf), pos_(pos), tree_(tree) {}
+
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = V;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::conditional_t<Const, const V &, V &>;
+    using pointer = std::conditional_t<Const, const V *, V *>;
+
+    BPlusTreeIterator() : leaf_(nullptr), pos_(0), tree_(nullptr) {}
+    template <bool OtherConst,
+              typename = std::enable_if_t<Const && !OtherConst>>
+    BPlusTreeIterator(const BPlusTreeIterator<OtherConst> &other)
+        : leaf_(other.leaf_), pos_(other.pos_), tree_(other.tree_) {}
+
+    reference operator*() const { return leaf_->values()[pos_]; }
+    pointer operator->() const { return leaf_->values() + pos_; }
+
+    BPlusTreeIterator &operator++() {
+      if (leaf_ != nullptr && ++pos_ == leaf_->count_) {
+        leaf_ = leaf_->next_;
+        pos_ = 0;
+      }
+      return *this;
+    }
+    BPlusTreeIterator operator++(int) {
+      BPlusTreeIterator tmp(*this);
+      ++*this;
+      return tmp;
+    }
+    // Decrementing end() gives the last value.
+    BPlusTreeIterator &operator--() {
+      if (leaf_ == nullptr) {
+        leaf_ = tree_->last_;
+        pos_ = leaf_ != nullptr ? leaf_->count_ - 1 : 0;
+      } else if (pos_ == 0) {
+        leaf_ = leaf_->prev_;
+        pos_ = leaf_ != nullptr ? leaf_->count_ - 1 : 0;
+      } else {
+        --pos_;
+      }
+      return *this;
+    }
+    BPlusTreeIterator operator--(int) {
+      BPlusTreeIterator tmp(*this);
+      --*this;
+      return tmp;
+    }
+
+    bool operator==(const BPlusTreeIterator &other) const {
+      return leaf_ == other.leaf_ && pos_ == other.pos_;
+    }
+    bool operator!=(const BPlusTreeIterator &other) const {
+      return !(*this == other);
+    }
+  };
+
+  using iterator = BPlusTreeIterator<false>;
+  using const_iterator = BPlusTreeIterator<true>;
+
+  BPlusTree() : root_(nullptr), first_(nullptr), last_(nullptr), size_(0) {}
+
+  BPlusTree(const BPlusTree &other) : BPlusTree() {
+    for (Leaf *leaf = other.first_; leaf != nullptr; leaf = leaf->next_) {
+      for (size_type i = 0; i < leaf->count_; i++) {
+        appendBack(leaf->keys_[i], leaf->values()[i]);
+      }
+    }
+  }
+
+  BPlusTree(BPlusTree &&other) noexcept : BPlusTree() { swap(other); }
+
+  ~BPlusTree() { clear(); }
+
+  BPlusTree &operator=(const BPlusTree &other) {
+    if (this != &other) {
+      BPlusTree tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  BPlusTree &operator=(BPlusTree &&other) noexcept {
+    if (this != &other) {
+      BPlusTree tmp(std::move(other));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  iterator begin() { return iterator(first_, 0, this); }
+  iterator end() { return iterator(nullptr, 0, this); }
+  const_iterator begin() const { return const_iterator(first_, 0, this); }
+  const_iterator end() const { return const_iterator(nullptr, 0, this); }
+
+  size_type getSize() const { return size_; }
+
+  void clear() {
+    if (root_ != nullptr) freeNode(root_);
+    root_ = nullptr;
+    first_ = last_ = nullptr;
+    size_ = 0;
+  }
+
+  void swap(BPlusTree &other) noexcept {
+    std::swap(root_, other.root_);
+    std::swap(first_, other.first_);
+    std::swap(last_, other.last_);
+    std::swap(size_, other.size_);
+  }
+
+  // First value whose key is not less than key.
+  iterator lowerBound(const K &key) {
+    if (root_ == nullptr) return end();
+    Leaf *leaf = descend(key, false);
+    return iteratorAt(leaf, node_lower_bound(leaf->keys_, leaf->count_, key));
+  }
+
+  // First value whose key is greater than key.
+  iterator upperBound(const K &key) {
+    if (root_ == nullptr) return end();
+    Leaf *leaf = descend(key, true);
+    return iteratorAt(leaf, node_upper_bound(leaf->keys_, leaf->count_, key));
+  }
+
+  iterator find(const K &key) {
+    iterator it = lowerBound(key);
+    if (it.leaf_ != nullptr && !(key < it.leaf_->keys_[it.pos_])) return it;
+    return end();
+  }
+
+  size_type count(const K &key) {
+    size_type res = 0;
+    for (iterator it = lowerBound(key);
+         it.leaf_ != nullptr && !(key < it.leaf_->keys_[it.pos_]); ++it) {
+      res++;
+    }
+    return res;
+  }
+
+  // Inserts value under key unless key is present already.
+  std::pair<iterator, bool> insertUnique(const K &key, const V &value) {
+    if (root_ == nullptr) return {appendBack(key, value), true};
+    Leaf *leaf = descend(key, false);
+    size_type pos = node_lower_bound(leaf->keys_, leaf->count_, key);
+    iterator next = iteratorAt(leaf, pos);
+    if (next.leaf_ != nullptr && !(key < next.leaf_->keys_[next.pos_])) {
+      return {next, false};
+    }
+    return {insertAt(leaf, pos, key, value), true};
+  }
+
+  // Inserts value under key after any values with an equal key.
+  iterator insertMulti(const K &key, const V &value) {
+    if (root_ == nullptr) return appendBack(key, value);
+    Leaf *leaf = descend(key, true);
+    size_type pos = node_upper_bound(leaf->keys_, leaf->count_, key);
+    return insertAt(leaf, pos, key, value);
+  }
+
+  void erase(iterator pos) {
+    Leaf *leaf = pos.leaf_;
+    if (leaf == nullptr) return;
+    leaf->values()[pos.pos_].~V();
+    for (size_type i = pos.pos_; i + 1 < leaf->count_; i++) {
+      moveEntry(leaf, i + 1, leaf, i);
+    }
+    leaf->count_--;
+    size_--;
+    if (leaf == root_) {
+      if (leaf->count_ == 0) clear();
+    } else if (leaf->count_ < kMinSlots) {
+      rebalanceLeaf(leaf);
+    }
+  }
+
+  // Number of levels from the root to the leaves, 0 for an empty tree.
+  size_type height() const {
+    size_type res = 0;
+    for (NodeBase *node = root_; node != nullptr; res++) {
+      node = node->leaf_ ? nullptr : static_cast<Inner *>(node)->children_[0];
+    }
+    return res;
+  }
+
+ private:
+  iterator iteratorAt(Leaf *leaf, size_type pos) {
+    if (pos == leaf->count_) return iterator(leaf->next_, 0, this);
+    return iterator(leaf, pos, this);
+  }
+
+  // The leaf where key belongs. Equal separators send the search left for a
+  // lower bound and right for an upper bound.
+  Leaf *descend(const K &key, bool upper) const {
+    NodeBase *node = root_;
+    while (!node->leaf_) {
+      Inner *inner = static_cast<Inner *>(node);
+      size_type i = upper ? node_upper_bound(inner->keys_, inner->count_, key)
+                          : node_lower_bound(inner->keys_, inner->count_, key);
+      node = inner->children_[i];
+    }
+    return static_cast<Leaf *>(node);
+  }
+
+  void freeNode(NodeBase *node) {
+    if (node->leaf_) {
+      Leaf *leaf = static_cast<Leaf *>(node);
+      for (size_type i = 0; i < leaf->count_; i++) leaf->values()[i].~V();
+      delete leaf;
+    } else {
+      Inner *inner = static_cast<Inner *>(node);
+      for (size_type i = 0; i <= inner->count_; i++) {
+        freeNode(inner->children_[i]);
+      }
+      delete inner;
+    }
+  }
+
+  // Moves entry i of from into the unconstructed value slot j of to.
+  static void moveEntry(Leaf *from, size_type i, Leaf *to, size_type j) {
+    to->keys_[j] = std::move(from->keys_[i]);
+    new (to->values() + j) V(std::move(from->values()[i]));
+    from->values()[i].~V();
+  }
+
+  static size_type childIndex(const Inner *parent, const NodeBase *child) {
+    size_type i = 0;
+    while (parent->children_[i] != child) i++;
+    return i;
+  }
+
+  iterator appendBack(const K &key, const V &value) {
+    if (root_ == nullptr) {
+      Leaf *leaf = new Leaf();
+      root_ = first_ = last_ = leaf;
+    }
+    return insertAt(last_, last_->count_, key, value);
+  }
+
+  iterator insertAt(Leaf *leaf, size_type pos, const K &key, const V &value) {
+    bool fresh = false;
+    if (leaf->count_ == kSlots) {
+      if (leaf == last_ && pos == kSlots) {
+        leaf = linkLeafAfter(leaf);
+        pos = 0;
+        fresh = true;
+      } else {
+        Leaf *right = splitLeaf(leaf);
+        if (pos > leaf->count_) {
+          pos -= leaf->count_;
+          leaf = right;
+        }
+      }
+    }
+    for (size_type i = leaf->count_; i > pos; i--) {
+      moveEntry(leaf, i - 1, leaf, i);
+    }
+    leaf->keys_[pos] = key;
+    new (leaf->values() + pos) V(value);
+    leaf->count_++;
+    size_++;
+    if (fresh) insertIntoParent(leaf->prev_, leaf->keys_[0], leaf);
+    return iterator(leaf, pos, this);
+  }
+
+  // Chains a new empty leaf after leaf. The caller adds its first entry,
+  // which then becomes the separator in the parent.
+  Leaf *linkLeafAfter(Leaf *leaf) {
+    Leaf *right = new Leaf();
+    right->next_ = leaf->next_;
+    right->prev_ = leaf;
+    if (leaf->next_ != nullptr) {
+      leaf->next_->prev_ = right;
+    } else {
+      last_ = right;
+    }
+    leaf->next_ = right;
+    return right;
+  }
+
+  // Moves the upper half of a full leaf into a new right sibling.
+  Leaf *splitLeaf(Leaf *leaf) {
+    Leaf *right = linkLeafAfter(leaf);
+    size_type half = kSlots / 2;
+    for (size_type i = half; i < leaf->count_; i++) {
+      moveEntry(leaf, i, right, i - half);
+    }
+    right->count_ = static_cast<unsigned short>(leaf->count_ - half);
+    leaf->count_ = static_cast<unsigned short>(half);
+    insertIntoParent(leaf, right->keys_[0], right);
+    return right;
+  }
+
+  // Moves the keys and children above the middle of a full inner node into
+  // a new right sibling and pushes the middle key up.
+  Inner *splitInner(Inner *node) {
+    size_type mid = kSlots / 2;
+    Inner *right = new Inner();
+    for (size_type i = mid + 1; i < node->count_; i++) {
+      right->keys_[i - mid - 1] = std::move(node->keys_[i]);
+    }
+    for (size_type i = mid + 1; i <= node->count_; i++) {
+      right->children_[i - mid - 1] = node->children_[i];
+      node->children_[i]->parent_ = right;
+    }
+    right->count_ = static_cast<unsigned short>(node->count_ - mid - 1);
+    node->count_ = static_cast<unsigned short>(mid);
+    K up = std::move(node->keys_[mid]);
+    insertIntoParent(node, up, right);
+    return right;
+  }
+
+  // Registers right as the sibling after left, separated by sep.
+  void insertIntoParent(NodeBase *left, const K &sep, NodeBase *right) {
+    Inner *parent = left->parent_;
+    if (parent == nullptr) {
+      Inner *root = new Inner();
+      root->keys_[0] = sep;
+      root->children_[0] = left;
+      root->children_[1] = right;
+      root->count_ = 1;
+      left->parent_ = right->parent_ = root;
+      root_ = root;
+      return;
+    }
+    size_type idx = childIndex(parent, left);
+    if (parent->count_ == kSlots) {
+      Inner *sibling = splitInner(parent);
+      if (idx > parent->count_) {
+        idx -= parent->count_ + 1;
+        parent = sibling;
+      }
+    }
+    for (size_type i = parent->count_; i > idx; i--) {
+      parent->keys_[i] = std::move(parent->keys_[i - 1]);
+      parent->children_[i + 1] = parent->children_[i];
+    }
+    parent->keys_[idx] = sep;
+    parent->children_[idx + 1] = right;
+    right->parent_ = parent;
+    parent->count_++;
+  }
+
+  void rebalanceLeaf(Leaf *leaf) {
+    Inner *parent = leaf->parent_;
+    size_type idx = childIndex(parent, leaf);
+    Leaf *left =
+        idx > 0 ? static_cast<Leaf *>(parent->children_[idx - 1]) : nullptr;
+    Leaf *right = idx < parent->count_
+                      ? static_cast<Leaf *>(parent->children_[idx + 1])
+                      : nullptr;
+    if (left != nullptr && left->count_ > kMinSlots) {
+      for (size_type i = leaf->count_; i > 0; i--) {
+        moveEntry(leaf, i - 1, leaf, i);
+      }
+      moveEntry(left, left->count_ - 1, leaf, 0);
+      left->count_--;
+      leaf->count_++;
+      parent->keys_[idx - 1] = leaf->keys_[0];
+    } else if (right != nullptr && right->count_ > kMinSlots) {
+      moveEntry(right, 0, leaf, leaf->count_);
+      for (size_type i = 1; i < right->count_; i++) {
+        moveEntry(right, i, right, i - 1);
+      }
+      right->count_--;
+      leaf->count_++;
+      parent->keys_[idx] = right->keys_[0];
+    } else if (left != nullptr) {
+      mergeLeaves(left, leaf);
+      removeChild(parent, idx - 1);
+    } else {
+      mergeLeaves(leaf, right);
+      removeChild(parent, idx);
+    }
+  }
+
+  // Appends every entry of right to left and unlinks right.
+  void mergeLeaves(Leaf *left, Leaf *right) {
+    for (size_type i = 0; i < right->count_; i++) {
+      moveEntry(right, i, left, left->count_ + i);
+    }
+    left->count_ = static_cast<unsigned short>(left->count_ + right->count_);
+    left->next_ = right->next_;
+    if (right->next_ != nullptr) {
+      right->next_->prev_ = left;
+    } else {
+      last_ = left;
+    }
+    delete right;
+  }
+
+  // Removes keys_[idx] and the child to its right from node.
+  void removeChild(Inner *node, size_type idx) {
+    for (size_type i = idx; i + 1 < node->count_; i++) {
+      node->keys_[i] = std::move(node->keys_[i + 1]);
+      node->children_[i + 1] = node->children_[i + 2];
+    }
+    node->count_--;
+    if (node == root_) {
+      if (node->count_ == 0) {
+        root_ = node->children_[0];
+        root_->parent_ = nullptr;
+        delete node;
+      }
+    } else if (node->count_ < kMinSlots) {
+      rebalanceInner(node);
+    }
+  }
+
+  void rebalanceInner(Inner *node) {
+    Inner *parent = node->parent_;
+    size_type idx = childIndex(parent, node);
+    Inner *left =
+        idx > 0 ? static_cast<Inner *>(parent->children_[idx - 1]) : nullptr;
+    Inner *right = idx < parent->count_
+                       ? static_cast<Inner *>(parent->children_[idx + 1])
+                       : nullptr;
+    if (left != nullptr && left->count_ > kMinSlots) {
+      for (size_type i = node->count_; i > 0; i--) {
+        node->keys_[i] = std::move(node->keys_[i - 1]);
+      }
+      for (size_type i = node->count_ + 1; i > 0; i--) {
+        node->children_[i] = node->children_[i - 1];
+      }
+      node->keys_[0] = std::move(parent->keys_[idx - 1]);
+      node->children_[0] = left->children_[left->count_];
+      node->children_[0]->parent_ = node;
+      parent->keys_[idx - 1] = std::move(left->keys_[left->count_ - 1]);
+      left->count_--;
+      node->count_++;
+    } else if (right != nullptr && right->count_ > kMinSlots) {
+      node->keys_[node->count_] = std::move(parent->keys_[idx]);
+      node->children_[node->count_ + 1] = right->children_[0];
+      right->children_[0]->parent_ = node;
+      node->count_++;
+      parent->keys_[idx] = std::move(right->keys_[0]);
+      for (size_type i = 1; i < right->count_; i++) {
+        right->keys_[i - 1] = std::move(right->keys_[i]);
+      }
+      for (size_type i = 1; i <= right->count_; i++) {
+        right->children_[i - 1] = right->children_[i];
+      }
+      right->count_--;
+    } else if (left != nullptr) {
+      mergeInner(left, parent->keys_[idx - 1], node);
+      removeChild(parent, idx - 1);
+    } else {
+      mergeInner(node, parent->keys_[idx], right);
+      removeChild(parent, idx);
+    }
+  }
+
+  // Appends sep and then every key and child of right to left.
+  static void mergeInner(Inner *left, K &sep, Inner *right) {
+    size_type base = left->count_ + 1;
+    left->keys_[left->count_] = std::move(sep);
+    for (size_type i = 0; i < right->count_; i++) {
+      left->keys_[base + i] = std::move(right->keys_[i]);
+    }
+    for (size_type i = 0; i <= right->count_; i++) {
+      left->children_[base + i] = right->children_[i];
+      right->children_[i]->parent_ = left;
+    }
+    left->count_ = static_cast<unsigned short>(base + right->count_);
+    delete right;
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_B_PLUS_TREE
@@ -0,0 +1,89 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../s21_art_map.h"
+#include "../s21_map.h"
+#include "../s21_unordered_map.h"
+#include "bench.h"
+
+namespace {
+
+const std::size_t kKeys = 1 << 20;
+const std::size_t kLookups = 4000000;
+
+std::uint64_t nextId(std::uint64_t &state) {
+  state = state * 6364136223846793005ull + 1442695040888963407ull;
+  return state >> 16;
+}
+
+// URL paths: a handful of shared stems with numeric IDs underneath.
+std::vector<std::string> makePaths(std::size_t n) {
+  const char *stems[] = {"/api/v1/users/", "/api/v1/orders/",
+                         "/api/v2/organizations/", "/static/assets/"};
+  std::vector<std::string> res;
+  std::uint64_t state = 3;
+  for (std::size_t i = 0; i < n; i++) {
+    res.push_back(std::string(stems[i % 4]) +
+                  std::to_string(nextId(state) % 100000000) + "/profile");
+  }
+  return res;
+}
+
+template <typename Map, typename Key>
+void run(const char *name, const std::vector<Key> &keys,
+         const std::vector<Key> &probes) {
+  Map m;
+  double ms = bench::measure_ms([&] {
+    for (std::size_t i = 0; i < keys.size(); i++) m.insert(keys[i], int(i));
+  });
+  std::string label = std::string(name) + " insert";
+  bench::report(label.c_str(), ms, keys.size());
+  std::size_t found = 0;
+  ms = bench::measure_ms([&] {
+    for (std::size_t i = 0; i < kLookups; i++) {
+      found += m.contains(probes[i % probes.size()]);
+    }
+  });
+  bench::do_not_optimize(found);
+  label = std::string(name) + " contains";
+  bench::report(label.c_str(), ms, kLookups);
+}
+
+// Half of the probes are present keys and half are misses.
+template <typename Key>
+std::vector<Key> makeProbes(const std::vector<Key> &keys,
+                            const std::vector<Key> &misses) {
+  std::vector<Key> res;
+  for (std::size_t i = 0; i < keys.size(); i++) {
+    res.push_back(i % 2 ? keys[(i * 7919) % keys.size()] : misses[i]);
+  }
+  return res;
+}
+
+}  // namespace
+
+int main() {
+  std::vector<std::uint64_t> ids;
+  std::vector<std::uint64_t> missing_ids;
+  std::uint64_t state = 1;
+  for (std::size_t i = 0; i < kKeys; i++) {
+    ids.push_back(nextId(state));
+    missing_ids.push_back(nextId(state));
+  }
+  std::vector<std::uint64_t> id_probes = makeProbes(ids, missing_ids);
+  run<s21::map<std::uint64_t, int>>("map uint64", ids, id_probes);
+  run<s21::unordered_map<std::uint64_t, int>>("unordered_map uint64", ids,
+                                              id_probes);
+  run<s21::art_map<std::uint64_t, int>>("art_map uint64", ids, id_probes);
+
+  std::vector<std::string> paths = makePaths(kKeys);
+  std::vector<std::string> missing_paths = makePaths(2 * kKeys);
+  missing_paths.erase(missing_paths.begin(), missing_paths.begin() + kKeys);
+  std::vector<std::string> path_probes = makeProbes(paths, missing_paths);
+  run<s21::map<std::string, int>>("map path", paths, path_probes);
+  run<s21::unordered_map<std::string, int>>("unordered_map path", paths,
+                                            path_probes);
+  run<s21::art_map<std::string, int>>("art_map path", paths, path_probes);
+  return 0;
+}
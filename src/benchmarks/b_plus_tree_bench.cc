@@ -0,0 +1,53 @@
+#include <cstdint>
+#include <string>
+
+#include "../s21_map.h"
+#include "bench.h"
+
+namespace {
+
+const int kKeys = 1 << 20;
+const std::size_t kLookups = 4000000;
+
+int nextKey(std::uint32_t &state) {
+  state = state * 1664525u + 1013904223u;
+  return int(state >> 8) % (2 * kKeys);
+}
+
+// Random inserts, then lookups of which about half miss, then one full
+// in-order scan, on the same map type.
+template <typename Map>
+void run(const char *name) {
+  std::string label(name);
+  Map m;
+  double ms = bench::measure_ms([&] {
+    std::uint32_t state = 7;
+    for (int i = 0; i < kKeys; i++) m.insert(nextKey(state), i);
+  });
+  bench::report((label + " random insert").c_str(), ms, kKeys);
+
+  std::size_t found = 0;
+  ms = bench::measure_ms([&] {
+    std::uint32_t state = 1;
+    for (std::size_t i = 0; i < kLookups; i++) {
+      found += m.contains(nextKey(state));
+    }
+  });
+  bench::do_not_optimize(found);
+  bench::report((label + " contains").c_str(), ms, kLookups);
+
+  long long sum = 0;
+  ms = bench::measure_ms([&] {
+    for (auto it = m.begin(); it != m.end(); ++it) sum += (*it).second;
+  });
+  bench::do_not_optimize(sum);
+  bench::report((label + " iterate").c_str(), ms, m.size());
+}
+
+}  // namespace
+
+int main() {
+  run<s21::map<int, int>>("red-black map");
+  run<s21::map<int, int, s21::BPlusTree>>("B+-tree map");
+  return 0;
+}
@@ -0,0 +1,33 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+
+namespace bench {
+
+// Runs f once and returns the elapsed wall time in milliseconds.
+template <typename F>
+double measure_ms(F &&f) {
+  auto start = std::chrono::steady_clock::now();
+  f();
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+inline void report(const char *name, double ms, std::size_t ops) {
+  std::printf("%-48s %10.2f ms %10.2f Mops/s\n", name, ms,
+              ms > 0 ? ops / ms / 1000.0 : 0.0);
+}
+
+// Keeps the compiler from discarding a value that is computed only to be
+// measured.
+template <typename T>
+void do_not_optimize(T const &value) {
+  asm volatile("" : : "g"(&value) : "memory");
+}
+
+}  // namespace bench
+
+#endif
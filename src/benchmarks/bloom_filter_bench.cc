@@ -0,0 +1,83 @@
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "../s21_map.h"
+#include "../s21_set.h"
+#include "bench.h"
+
+namespace {
+
+const std::size_t kKeys = 1 << 20;
+const std::size_t kLookups = 4000000;
+
+// Even keys are present; miss_percent of the probes ask for odd ones.
+int probeKey(std::uint32_t &state, unsigned miss_percent) {
+  state = state * 1664525u + 1013904223u;
+  int key = int((std::uint64_t(state) * kKeys) >> 32) * 2;
+  return (state & 0x7F) % 100 < miss_percent ? key + 1 : key;
+}
+
+std::string pathOf(int key) { return "/api/v1/users/" + std::to_string(key); }
+
+template <typename Set>
+void lookup(const char *name, Set &s, unsigned miss_percent) {
+  std::size_t found = 0;
+  double ms = bench::measure_ms([&] {
+    std::uint32_t state = 1;
+    for (std::size_t i = 0; i < kLookups; i++) {
+      found += s.contains(probeKey(state, miss_percent));
+    }
+  });
+  bench::do_not_optimize(found);
+  std::string label = std::string(name) + " " +
+                      std::to_string(miss_percent) + "% misses";
+  bench::report(label.c_str(), ms, kLookups);
+}
+
+template <template <typename, typename> class Tree>
+void runSet(const char *name) {
+  s21::set<int, Tree> s;
+  for (std::size_t i = 0; i < kKeys; i++) s.insert(int(2 * i));
+  lookup(name, s, 0);
+  lookup(name, s, 90);
+}
+
+template <template <typename, typename> class Tree>
+void runMap(const char *name) {
+  s21::map<std::string, int, Tree> m;
+  for (std::size_t i = 0; i < kKeys; i++) m.insert(pathOf(int(2 * i)), 0);
+  std::size_t found = 0;
+  double ms = bench::measure_ms([&] {
+    std::uint32_t state = 1;
+    for (std::size_t i = 0; i < kLookups / 4; i++) {
+      found += m.contains(pathOf(probeKey(state, 90)));
+    }
+  });
+  bench::do_not_optimize(found);
+  std::string label = std::string(name) + " 90% misses";
+  bench::report(label.c_str(), ms, kLookups / 4);
+}
+
+}  // namespace
+
+int main() {
+  runSet<s21::RBTree>("set<int> RBTree");
+  runSet<s21::BloomRBTree>("set<int> BloomRBTree");
+  runSet<s21::BPlusTree>("set<int> BPlusTree");
+  runSet<s21::BloomBPlusTree>("set<int> BloomBPlusTree");
+  runMap<s21::RBTree>("map<string> RBTree");
+  runMap<s21::BloomRBTree>("map<string> BloomRBTree");
+
+  s21::set<int, s21::BloomRBTree> s;
+  for (std::size_t i = 0; i < kKeys; i++) s.insert(int(2 * i));
+  for (std::size_t i = 0; i < kKeys; i += 2) s.erase(s.find(int(2 * i)));
+  lookup("set<int> BloomRBTree after erasing half", s, 90);
+  s21::bloom_filter_stats stats = s.filter_stats();
+  std::printf(
+      "  lookups %zu: %zu definite misses, %zu false positives, %zu hits, "
+      "%zu rebuilds\n",
+      stats.lookups, stats.definite_misses, stats.false_positives, stats.hits,
+      stats.rebuilds);
+  return 0;
+}
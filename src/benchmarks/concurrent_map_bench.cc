@@ -0,0 +1,78 @@
+#include <map>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_concurrent_map.h"
+#include "bench.h"
+
+namespace {
+
+const std::size_t kOps = 1 << 19;
+const int kKeys = 1 << 16;
+
+class locked_map {
+ public:
+  bool contains(int key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return map_.count(key) != 0;
+  }
+  void insert(int key, int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_.emplace(key, value);
+  }
+  void erase(int key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_.erase(key);
+  }
+
+ private:
+  std::mutex mutex_;
+  std::map<int, int> map_;
+};
+
+// A read-mostly cache: nine lookups for every insert or erase, with kOps
+// operations split between the threads.
+template <typename Map>
+void read_mostly(const char *name, std::size_t threads) {
+  Map m;
+  for (int i = 0; i < kKeys; i += 2) m.insert(i, i);
+  double ms = bench::measure_ms([&] {
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < threads; t++) {
+      workers.emplace_back([&m, threads, t] {
+        std::mt19937 rng(static_cast<unsigned>(t));
+        std::size_t hits = 0;
+        for (std::size_t i = 0; i < kOps / threads; i++) {
+          int key = int(rng() % kKeys);
+          switch (i % 10) {
+            case 0:
+              m.insert(key, key);
+              break;
+            case 5:
+              m.erase(key);
+              break;
+            default:
+              hits += m.contains(key);
+          }
+        }
+        bench::do_not_optimize(hits);
+      });
+    }
+    for (auto &worker : workers) worker.join();
+  });
+  std::string label = std::string(name) + " threads=" + std::to_string(threads);
+  bench::report(label.c_str(), ms, kOps);
+}
+
+}  // namespace
+
+int main() {
+  for (std::size_t threads = 1; threads <= 16; threads *= 2) {
+    read_mostly<locked_map>("mutex + std::map", threads);
+    read_mostly<s21::concurrent_map<int, int>>("concurrent_map", threads);
+  }
+  return 0;
+}
@@ -0,0 +1,62 @@
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_concurrent_stack.h"
+#include "../s21_stack.h"
+#include "bench.h"
+
+namespace {
+
+const std::size_t kOps = 1 << 20;
+
+class locked_stack {
+ public:
+  void push(int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stack_.push(value);
+  }
+  bool try_pop(int &out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stack_.empty()) return false;
+    out = stack_.pop_value();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::stack<int> stack_;
+};
+
+// Every thread borrows and returns objects like a shared free-object pool:
+// kOps push/pop pairs are split between the threads.
+template <typename Stack>
+void contention(const char *name, std::size_t threads) {
+  Stack s;
+  for (int i = 0; i < 1024; i++) s.push(i);
+  double ms = bench::measure_ms([&] {
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < threads; t++) {
+      workers.emplace_back([&s, threads] {
+        int value = 0;
+        for (std::size_t i = 0; i < kOps / threads; i++) {
+          if (s.try_pop(value)) s.push(value);
+        }
+      });
+    }
+    for (auto &worker : workers) worker.join();
+  });
+  std::string label = std::string(name) + " threads=" + std::to_string(threads);
+  bench::report(label.c_str(), ms, 2 * kOps);
+}
+
+}  // namespace
+
+int main() {
+  for (std::size_t threads = 1; threads <= 16; threads *= 2) {
+    contention<locked_stack>("mutex + s21::stack", threads);
+    contention<s21::concurrent_stack<int>>("concurrent_stack", threads);
+  }
+  return 0;
+}
@@ -0,0 +1,67 @@
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_concurrent_unordered_map.h"
+#include "../s21_unordered_map.h"
+#include "bench.h"
+
+namespace {
+
+const std::size_t kOps = 1 << 21;
+const int kKeys = 1 << 16;
+
+class locked_map {
+ public:
+  void increment(int key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_[key]++;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::unordered_map<int, long> map_;
+};
+
+class sharded_map {
+ public:
+  void increment(int key) {
+    map_.upsert(key, [](long &value) { value++; });
+  }
+
+ private:
+  s21::concurrent_unordered_map<int, long> map_;
+};
+
+// Event counting: every operation bumps the counter of a random key, with
+// kOps increments split between the threads.
+template <typename Map>
+void counters(const char *name, std::size_t threads) {
+  Map m;
+  double ms = bench::measure_ms([&] {
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < threads; t++) {
+      workers.emplace_back([&m, threads, t] {
+        std::mt19937 rng(static_cast<unsigned>(t));
+        for (std::size_t i = 0; i < kOps / threads; i++) {
+          m.increment(int(rng() % kKeys));
+        }
+      });
+    }
+    for (auto &worker : workers) worker.join();
+  });
+  std::string label = std::string(name) + " threads=" + std::to_string(threads);
+  bench::report(label.c_str(), ms, kOps);
+}
+
+}  // namespace
+
+int main() {
+  for (std::size_t threads = 1; threads <= 32; threads *= 2) {
+    counters<locked_map>("mutex + s21::unordered_map", threads);
+    counters<sharded_map>("concurrent_unordered_map", threads);
+  }
+  return 0;
+}
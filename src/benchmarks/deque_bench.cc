@@ -0,0 +1,71 @@
+#include "../s21_deque.h"
+#include "../s21_list.h"
+#include "../s21_ring_buffer.h"
+#include "../s21_vector.h"
+#include "bench.h"
+
+namespace {
+
+const std::size_t kOps = 10000000;
+const std::size_t kBatch = 1000;
+
+// Sliding window: push a batch at the back, pop it at the front.
+template <typename Container>
+void fifo(const char *name) {
+  Container c;
+  long long sum = 0;
+  double ms = bench::measure_ms([&] {
+    for (std::size_t i = 0; i < kOps / kBatch; i++) {
+      for (std::size_t j = 0; j < kBatch; j++) c.push_back(int(j));
+      for (std::size_t j = 0; j < kBatch; j++) {
+        sum += c.front();
+        c.pop_front();
+      }
+    }
+  });
+  bench::do_not_optimize(sum);
+  bench::report(name, ms, 2 * kOps);
+}
+
+template <typename Container>
+void push_front(const char *name) {
+  long long sum = 0;
+  double ms = bench::measure_ms([&] {
+    for (std::size_t i = 0; i < kOps / kBatch / 10; i++) {
+      Container c;
+      for (std::size_t j = 0; j < 10 * kBatch; j++) c.push_front(int(j));
+      sum += c.front();
+    }
+  });
+  bench::do_not_optimize(sum);
+  bench::report(name, ms, kOps);
+}
+
+template <typename Container>
+void random_access(const char *name) {
+  Container c;
+  for (std::size_t i = 0; i < (1 << 16); i++) c.push_back(int(i));
+  long long sum = 0;
+  double ms = bench::measure_ms([&] {
+    std::size_t index = 1;
+    for (std::size_t i = 0; i < kOps; i++) {
+      index = (index * 1103515245 + 12345) & ((1 << 16) - 1);
+      sum += c[index];
+    }
+  });
+  bench::do_not_optimize(sum);
+  bench::report(name, ms, kOps);
+}
+
+}  // namespace
+
+int main() {
+  fifo<s21::list<int>>("list push_back/pop_front");
+  fifo<s21::ring_buffer<int>>("ring_buffer push_back/pop_front");
+  fifo<s21::deque<int>>("deque push_back/pop_front");
+  push_front<s21::list<int>>("list push_front");
+  push_front<s21::deque<int>>("deque push_front");
+  random_access<s21::vector<int>>("vector operator[]");
+  random_access<s21::deque<int>>("deque operator[]");
+  return 0;
+}
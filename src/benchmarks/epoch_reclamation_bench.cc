@@ -0,0 +1,68 @@
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../epoch_reclamation.h"
+#include "bench.h"
+
+namespace {
+
+const std::size_t kOps = 10000000;
+const std::size_t kRetires = 1 << 20;
+
+void pin_unpin() {
+  double ms = bench::measure_ms([] {
+    for (std::size_t i = 0; i < kOps; i++) s21::epoch_guard guard;
+  });
+  bench::report("epoch_guard pin/unpin", ms, kOps);
+}
+
+void nested_pin() {
+  s21::epoch_guard outer;
+  double ms = bench::measure_ms([] {
+    for (std::size_t i = 0; i < kOps; i++) s21::epoch_guard guard;
+  });
+  bench::report("epoch_guard nested pin/unpin", ms, kOps);
+}
+
+// Each thread allocates, retires and eventually frees kRetires / threads
+// nodes, the way a container's erase path would.
+void retire(std::size_t threads) {
+  double ms = bench::measure_ms([threads] {
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < threads; t++) {
+      workers.emplace_back([threads] {
+        s21::epoch_domain &domain = s21::epoch_domain::instance();
+        for (std::size_t i = 0; i < kRetires / threads; i++) {
+          s21::epoch_guard guard;
+          domain.retire(new long(long(i)));
+        }
+        domain.collect();
+      });
+    }
+    for (auto &worker : workers) worker.join();
+  });
+  std::string label = "retire threads=" + std::to_string(threads);
+  bench::report(label.c_str(), ms, kRetires);
+}
+
+void plain_delete() {
+  double ms = bench::measure_ms([] {
+    for (std::size_t i = 0; i < kRetires; i++) {
+      long *p = new long(long(i));
+      bench::do_not_optimize(p);
+      delete p;
+    }
+  });
+  bench::report("new + immediate delete", ms, kRetires);
+}
+
+}  // namespace
+
+int main() {
+  pin_unpin();
+  nested_pin();
+  plain_delete();
+  for (std::size_t threads = 1; threads <= 8; threads *= 2) retire(threads);
+  return 0;
+}
@@ -0,0 +1,67 @@
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "../s21_flat_map.h"
+#include "../s21_map.h"
+#include "bench.h"
+
+namespace {
+
+const int kKeys = 1 << 16;
+const std::size_t kLookups = 4000000;
+
+// Random keys in [0, 2 * kKeys), so about half of the lookups miss.
+int nextKey(std::uint32_t &state) {
+  state = state * 1664525u + 1013904223u;
+  return int(state >> 8) % (2 * kKeys);
+}
+
+template <typename Map>
+void lookup(const char *name, Map &m) {
+  std::size_t found = 0;
+  double ms = bench::measure_ms([&] {
+    std::uint32_t state = 1;
+    for (std::size_t i = 0; i < kLookups; i++) {
+      found += m.contains(nextKey(state));
+    }
+  });
+  bench::do_not_optimize(found);
+  bench::report(name, ms, kLookups);
+}
+
+// The same sorted keys searched with the branching std::binary_search.
+struct BranchySearch {
+  std::vector<int> keys;
+  bool contains(int key) const {
+    return std::binary_search(keys.begin(), keys.end(), key);
+  }
+};
+
+}  // namespace
+
+int main() {
+  s21::map<int, int> tree;
+  s21::flat_map<int, int> flat;
+  BranchySearch branchy;
+  double ms = bench::measure_ms([&] {
+    for (int i = 0; i < kKeys; i++) tree.insert(2 * i, i);
+  });
+  bench::report("map insert", ms, kKeys);
+  ms = bench::measure_ms([&] {
+    s21::vector<int> keys;
+    s21::vector<int> values;
+    for (int i = 0; i < kKeys; i++) {
+      keys.push_back(2 * i);
+      values.push_back(i);
+    }
+    flat.replace(std::move(keys), std::move(values));
+  });
+  bench::report("flat_map replace", ms, kKeys);
+  for (int i = 0; i < kKeys; i++) branchy.keys.push_back(2 * i);
+
+  lookup("map contains", tree);
+  lookup("std::binary_search on sorted keys", branchy);
+  lookup("flat_map contains", flat);
+  return 0;
+}
@@ -0,0 +1,71 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "../s21_frozen_set.h"
+#include "../s21_set.h"
+#include "bench.h"
+
+namespace {
+
+const std::size_t kLookups = 4000000;
+
+// Random keys in [0, 2 * n), so about half of the lookups miss.
+int nextKey(std::uint32_t &state, std::size_t n) {
+  state = state * 1664525u + 1013904223u;
+  return int((std::uint64_t(state) * 2 * n) >> 32);
+}
+
+template <typename Set>
+void lookup(const std::string &name, Set &s, std::size_t n) {
+  std::size_t found = 0;
+  double ms = bench::measure_ms([&] {
+    std::uint32_t state = 1;
+    for (std::size_t i = 0; i < kLookups; i++) {
+      found += s.contains(nextKey(state, n));
+    }
+  });
+  bench::do_not_optimize(found);
+  bench::report(name.c_str(), ms, kLookups);
+}
+
+struct BinarySearch {
+  std::vector<int> keys;
+  bool contains(int key) const {
+    return std::binary_search(keys.begin(), keys.end(), key);
+  }
+};
+
+// Looks up n even keys in a sorted vector and in a frozen_set, and in an
+// s21::set unless n is too large to build one in reasonable time.
+void run(std::size_t n) {
+  std::string suffix = " (" + std::to_string(n) + " keys)";
+  if (n <= (1u << 20)) {
+    s21::set<int> tree;
+    for (std::size_t i = 0; i < n; i++) tree.insert(int(2 * i));
+    lookup("set contains" + suffix, tree, n);
+  }
+  BinarySearch sorted;
+  sorted.keys.reserve(n);
+  for (std::size_t i = 0; i < n; i++) sorted.keys.push_back(int(2 * i));
+  lookup("std::binary_search" + suffix, sorted, n);
+  s21::frozen_set<int> frozen;
+  double ms = bench::measure_ms([&] {
+    frozen = s21::frozen_set<int>(sorted.keys.begin(), sorted.keys.end());
+  });
+  bench::report(("frozen_set build" + suffix).c_str(), ms, n);
+  sorted.keys = std::vector<int>();
+  lookup("frozen_set contains" + suffix, frozen, n);
+}
+
+}  // namespace
+
+// The large table holds 100M keys by default; pass a smaller count as the
+// first argument on machines with less than 2 GB of memory.
+int main(int argc, char **argv) {
+  run(1u << 20);
+  run(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000000u);
+  return 0;
+}
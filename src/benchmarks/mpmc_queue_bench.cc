@@ -0,0 +1,82 @@
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_mpmc_queue.h"
+#include "../s21_queue.h"
+#include "bench.h"
+
+namespace {
+
+const std::size_t kItems = 1 << 20;
+const std::size_t kCapacity = 1024;
+
+class locked_queue {
+ public:
+  void push(int value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    notFull_.wait(lock, [this] { return queue_.size() < kCapacity; });
+    queue_.push(value);
+    notEmpty_.notify_one();
+  }
+  void pop(int &out) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    notEmpty_.wait(lock, [this] { return !queue_.empty(); });
+    out = queue_.front();
+    queue_.pop();
+    notFull_.notify_one();
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable notFull_;
+  std::condition_variable notEmpty_;
+  s21::queue<int> queue_;
+};
+
+// Splits kItems between threads / 2 producers and as many consumers; with a
+// single thread it alternates push and pop.
+template <typename Queue>
+void run(const char *name, std::size_t threads) {
+  Queue q;
+  double ms = bench::measure_ms([&] {
+    if (threads == 1) {
+      int value = 0;
+      for (std::size_t i = 0; i < kItems; i++) {
+        q.push(int(i));
+        q.pop(value);
+      }
+      return;
+    }
+    std::size_t pairs = threads / 2;
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < pairs; t++) {
+      workers.emplace_back([&q, pairs] {
+        for (std::size_t i = 0; i < kItems / pairs; i++) q.push(int(i));
+      });
+      workers.emplace_back([&q, pairs] {
+        int value = 0;
+        for (std::size_t i = 0; i < kItems / pairs; i++) q.pop(value);
+      });
+    }
+    for (auto &worker : workers) worker.join();
+  });
+  std::string label = std::string(name) + " threads=" + std::to_string(threads);
+  bench::report(label.c_str(), ms, kItems);
+}
+
+struct lock_free_queue : s21::mpmc_queue<int> {
+  lock_free_queue() : s21::mpmc_queue<int>(kCapacity) {}
+};
+
+}  // namespace
+
+int main() {
+  for (std::size_t threads = 1; threads <= 64; threads *= 2) {
+    run<locked_queue>("mutex + s21::queue", threads);
+    run<lock_free_queue>("mpmc_queue", threads);
+  }
+  return 0;
+}
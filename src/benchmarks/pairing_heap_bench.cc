@@ -0,0 +1,132 @@
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "../s21_multiset.h"
+#include "../s21_pairing_heap.h"
+#include "../s21_priority_queue.h"
+#include "bench.h"
+
+namespace {
+
+const int kVertices = 1 << 13;
+const int kDegree = 8;
+
+struct Edge {
+  int to;
+  long weight;
+};
+
+using Graph = std::vector<std::vector<Edge>>;
+using Entry = std::pair<long, int>;
+
+Graph random_graph() {
+  Graph g(kVertices);
+  unsigned state = 99;
+  for (int v = 0; v < kVertices; v++) {
+    for (int i = 0; i < kDegree; i++) {
+      state = state * 1103515245 + 12345;
+      int to = int(state >> 8) % kVertices;
+      state = state * 1103515245 + 12345;
+      g[v].push_back(Edge{to, long(state >> 20) % 1000 + 1});
+    }
+  }
+  return g;
+}
+
+// Improves a tentative distance in place through its handle.
+long dijkstra_pairing_heap(const Graph &g) {
+  const long kInf = -1;
+  std::vector<long> dist(kVertices, kInf);
+  std::vector<s21::pairing_heap<Entry>::handle> handles(kVertices);
+  std::vector<bool> queued(kVertices, false);
+  s21::pairing_heap<Entry> heap;
+  dist[0] = 0;
+  handles[0] = heap.push(Entry{0, 0});
+  queued[0] = true;
+  long total = 0;
+  while (!heap.empty()) {
+    Entry top = heap.top();
+    heap.pop();
+    queued[top.second] = false;
+    total += top.first;
+    for (const Edge &e : g[top.second]) {
+      long candidate = top.first + e.weight;
+      if (dist[e.to] != kInf && dist[e.to] <= candidate) continue;
+      bool seen = dist[e.to] != kInf;
+      dist[e.to] = candidate;
+      if (seen && queued[e.to]) {
+        heap.decrease_key(handles[e.to], Entry{candidate, e.to});
+      } else if (!seen) {
+        handles[e.to] = heap.push(Entry{candidate, e.to});
+        queued[e.to] = true;
+      }
+    }
+  }
+  return total;
+}
+
+// Emulates decrease-key with erase plus insert.
+long dijkstra_multiset(const Graph &g) {
+  const long kInf = -1;
+  std::vector<long> dist(kVertices, kInf);
+  s21::multiset<Entry> heap;
+  dist[0] = 0;
+  heap.insert(Entry{0, 0});
+  long total = 0;
+  while (!heap.empty()) {
+    auto first = heap.begin();
+    Entry top = *first;
+    heap.erase(first);
+    total += top.first;
+    for (const Edge &e : g[top.second]) {
+      long candidate = top.first + e.weight;
+      if (dist[e.to] != kInf && dist[e.to] <= candidate) continue;
+      if (dist[e.to] != kInf) heap.erase(heap.find(Entry{dist[e.to], e.to}));
+      dist[e.to] = candidate;
+      heap.insert(Entry{candidate, e.to});
+    }
+  }
+  return total;
+}
+
+// Skips stale entries instead of updating them.
+long dijkstra_lazy(const Graph &g) {
+  const long kInf = -1;
+  std::vector<long> dist(kVertices, kInf);
+  s21::priority_queue<Entry, s21::vector<Entry>, std::greater<Entry>> heap;
+  dist[0] = 0;
+  heap.push(Entry{0, 0});
+  long total = 0;
+  while (!heap.empty()) {
+    Entry top = heap.top();
+    heap.pop();
+    if (top.first != dist[top.second]) continue;
+    total += top.first;
+    for (const Edge &e : g[top.second]) {
+      long candidate = top.first + e.weight;
+      if (dist[e.to] != kInf && dist[e.to] <= candidate) continue;
+      dist[e.to] = candidate;
+      heap.push(Entry{candidate, e.to});
+    }
+  }
+  return total;
+}
+
+template <typename F>
+void run(const char *name, F f, const Graph &g) {
+  long total = 0;
+  double ms = bench::measure_ms([&] { total = f(g); });
+  bench::do_not_optimize(total);
+  bench::report(name, ms, std::size_t(kVertices) * kDegree);
+}
+
+}  // namespace
+
+int main() {
+  Graph g = random_graph();
+  run("dijkstra multiset erase+insert", dijkstra_multiset, g);
+  run("dijkstra priority_queue lazy", dijkstra_lazy, g);
+  run("dijkstra pairing_heap decrease_key", dijkstra_pairing_heap, g);
+  return 0;
+}
@@ -0,0 +1,75 @@
+#include <cstdint>
+
+#include "../s21_map.h"
+#include "../s21_persistent_map.h"
+#include "bench.h"
+
+namespace {
+
+const int kKeys = 1 << 16;
+const std::size_t kVersions = 200;
+
+int nextKey(std::uint32_t &state) {
+  state = state * 1664525u + 1013904223u;
+  return int((std::uint64_t(state) * kKeys) >> 32);
+}
+
+// Publishes kVersions snapshots of a routing table, one changed entry each:
+// a full copy of an s21::map against a path copy of a persistent_map.
+void publish() {
+  s21::map<int, int> table;
+  for (int i = 0; i < kKeys; i++) table.insert(i, i);
+  std::size_t total = 0;
+  double ms = bench::measure_ms([&] {
+    std::uint32_t state = 1;
+    for (std::size_t v = 0; v < kVersions; v++) {
+      table.insert_or_assign(nextKey(state), int(v));
+      s21::map<int, int> snapshot(table);
+      total += snapshot.size();
+    }
+  });
+  bench::do_not_optimize(total);
+  bench::report("map copy per snapshot", ms, kVersions);
+
+  s21::persistent_map<int, int>::transient_type builder;
+  for (int i = 0; i < kKeys; i++) builder.insert(i, i);
+  s21::persistent_map<int, int> current = builder.persistent();
+  ms = bench::measure_ms([&] {
+    std::uint32_t state = 1;
+    for (std::size_t v = 0; v < kVersions; v++) {
+      current = current.insert_or_assign(nextKey(state), int(v));
+      s21::persistent_map<int, int> snapshot(current);
+      total += snapshot.size();
+    }
+  });
+  bench::do_not_optimize(total);
+  bench::report("persistent_map path copy per snapshot", ms, kVersions);
+}
+
+// Bulk loading through a transient edits nodes in place; going through
+// persistent versions copies a path per insert.
+void build() {
+  double ms = bench::measure_ms([] {
+    s21::persistent_map<int, int> m;
+    std::uint32_t state = 1;
+    for (int i = 0; i < kKeys; i++) m = m.insert(nextKey(state), i);
+    bench::do_not_optimize(m);
+  });
+  bench::report("persistent_map insert per version", ms, kKeys);
+  ms = bench::measure_ms([] {
+    s21::persistent_map<int, int>::transient_type builder;
+    std::uint32_t state = 1;
+    for (int i = 0; i < kKeys; i++) builder.insert(nextKey(state), i);
+    s21::persistent_map<int, int> m = builder.persistent();
+    bench::do_not_optimize(m);
+  });
+  bench::report("persistent_map insert through transient", ms, kKeys);
+}
+
+}  // namespace
+
+int main() {
+  publish();
+  build();
+  return 0;
+}
@@ -0,0 +1,87 @@
+#include <functional>
+#include <vector>
+
+#include "../s21_multiset.h"
+#include "../s21_priority_queue.h"
+#include "bench.h"
+
+namespace {
+
+const std::size_t kSize = 1 << 16;
+const std::size_t kOps = 2000000;
+
+std::vector<int> random_values(std::size_t n) {
+  std::vector<int> res(n);
+  unsigned state = 12345;
+  for (auto &value : res) {
+    state = state * 1103515245 + 12345;
+    value = int(state >> 8);
+  }
+  return res;
+}
+
+// A scheduler's steady state: take the earliest deadline, push a new one.
+template <typename Queue>
+void hold(const char *name, const std::vector<int> &values) {
+  Queue q(values.begin(), values.begin() + kSize);
+  long long sum = 0;
+  double ms = bench::measure_ms([&] {
+    for (std::size_t i = 0; i < kOps; i++) {
+      sum += q.top();
+      q.pop();
+      q.push(values[i % values.size()]);
+    }
+  });
+  bench::do_not_optimize(sum);
+  bench::report(name, ms, 2 * kOps);
+}
+
+void hold_multiset(const std::vector<int> &values) {
+  s21::multiset<int> s;
+  for (std::size_t i = 0; i < kSize; i++) s.insert(values[i]);
+  long long sum = 0;
+  double ms = bench::measure_ms([&] {
+    for (std::size_t i = 0; i < kOps; i++) {
+      auto first = s.begin();
+      sum += *first;
+      s.erase(first);
+      s.insert(values[i % values.size()]);
+    }
+  });
+  bench::do_not_optimize(sum);
+  bench::report("multiset as heap pop/push", ms, 2 * kOps);
+}
+
+template <typename Queue>
+void build(const char *name, const std::vector<int> &values, bool bulk) {
+  long long sum = 0;
+  double ms = bench::measure_ms([&] {
+    for (int round = 0; round < 10; round++) {
+      Queue q;
+      if (bulk) {
+        q.push_range(values.begin(), values.end());
+      } else {
+        for (int value : values) q.push(value);
+      }
+      sum += q.top();
+    }
+  });
+  bench::do_not_optimize(sum);
+  bench::report(name, ms, 10 * values.size());
+}
+
+}  // namespace
+
+int main() {
+  using binary =
+      s21::priority_queue<int, s21::vector<int>, std::greater<int>, 2>;
+  using quaternary =
+      s21::priority_queue<int, s21::vector<int>, std::greater<int>>;
+  std::vector<int> values = random_values(kSize * 4);
+  hold_multiset(values);
+  hold<binary>("priority_queue arity=2 pop/push", values);
+  hold<quaternary>("priority_queue arity=4 pop/push", values);
+  build<quaternary>("priority_queue push one by one", values, false);
+  build<quaternary>("priority_queue push_range (Floyd)", values, true);
+  return 0;
+}
@@ -0,0 +1,50 @@
+#include "../s21_queue.h"
+#include "bench.h"
+
+namespace {
+
+const std::size_t kOps = 10000000;
+const std::size_t kBatch = 64;
+
+template <typename Queue>
+void push_pop(const char *name) {
+  Queue q;
+  long long sum = 0;
+  double ms = bench::measure_ms([&] {
+    for (std::size_t i = 0; i < kOps / kBatch; i++) {
+      for (std::size_t j = 0; j < kBatch; j++) q.push(int(j));
+      for (std::size_t j = 0; j < kBatch; j++) {
+        sum += q.front();
+        q.pop();
+      }
+    }
+  });
+  bench::do_not_optimize(sum);
+  bench::report(name, ms, 2 * kOps);
+}
+
+void bulk_push_pop(const char *name) {
+  s21::queue<int> q;
+  int input[kBatch];
+  int output[kBatch];
+  for (std::size_t j = 0; j < kBatch; j++) input[j] = int(j);
+  long long sum = 0;
+  double ms = bench::measure_ms([&] {
+    for (std::size_t i = 0; i < kOps / kBatch; i++) {
+      q.push_range(input, input + kBatch);
+      q.pop_into(output, kBatch);
+      sum += output[kBatch - 1];
+    }
+  });
+  bench::do_not_optimize(sum);
+  bench::report(name, ms, 2 * kOps);
+}
+
+}  // namespace
+
+int main() {
+  push_pop<s21::queue<int, s21::list<int>>>("queue<list> push/pop");
+  push_pop<s21::queue<int>>("queue<ring_buffer> push/pop");
+  bulk_push_pop("queue<ring_buffer> push_range/pop_into");
+  return 0;
+}
@@ -0,0 +1,81 @@
+#include <atomic>
+#include <cstdint>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_map.h"
+#include "../s21_rcu_map.h"
+#include "bench.h"
+
+namespace {
+
+const std::size_t kReads = 1 << 21;
+const int kKeys = 1 << 14;
+
+int nextKey(std::uint32_t &state) {
+  state = state * 1664525u + 1013904223u;
+  return int((std::uint64_t(state) * kKeys) >> 32);
+}
+
+class shared_locked_map {
+ public:
+  bool contains(int key) {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return map_.contains(key);
+  }
+  void insert_or_assign(int key, int value) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    map_.insert_or_assign(key, value);
+  }
+
+ private:
+  std::shared_mutex mutex_;
+  s21::map<int, int> map_;
+};
+
+// A routing table: reader threads split kReads lookups between them while
+// one writer changes a route every thousand or so reads.
+template <typename Map>
+void routing(const char *name, std::size_t readers) {
+  Map m;
+  for (int i = 0; i < kKeys; i += 2) m.insert_or_assign(i, i);
+  std::atomic<std::size_t> done(0);
+  double ms = bench::measure_ms([&] {
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < readers; t++) {
+      workers.emplace_back([&m, &done, readers, t] {
+        std::uint32_t state = std::uint32_t(t) + 1;
+        std::size_t hits = 0;
+        for (std::size_t i = 0; i < kReads / readers; i++) {
+          hits += m.contains(nextKey(state));
+          if (i % 1024 == 1023) done.fetch_add(1024, std::memory_order_relaxed);
+        }
+        bench::do_not_optimize(hits);
+      });
+    }
+    std::uint32_t state = 12345;
+    std::size_t writes = 0;
+    while (done.load(std::memory_order_relaxed) + 1024 * readers < kReads) {
+      if (done.load(std::memory_order_relaxed) / 1024 > writes) {
+        m.insert_or_assign(nextKey(state), int(writes++));
+      } else {
+        std::this_thread::yield();
+      }
+    }
+    for (auto &worker : workers) worker.join();
+  });
+  std::string label = std::string(name) + " readers=" + std::to_string(readers);
+  bench::report(label.c_str(), ms, kReads);
+}
+
+}  // namespace
+
+int main() {
+  for (std::size_t readers = 1; readers <= 16; readers *= 2) {
+    routing<shared_locked_map>("shared_mutex + s21::map", readers);
+    routing<s21::rcu_map<int, int>>("rcu_map", readers);
+  }
+  return 0;
+}
@@ -0,0 +1,195 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "../s21_roaring_set.h"
+#include "../s21_set.h"
+#include "bench.h"
+
+// Every allocation carries its size in front, so that the live heap bytes
+// of each container can be read off around its construction. The operators
+// are kept out of line so that the compiler does not pair the inlined
+// malloc and free with the new and delete expressions around them.
+namespace {
+std::size_t live_bytes = 0;
+const std::size_t kHeader = 16;
+}  // namespace
+
+__attribute__((noinline)) void *operator new(std::size_t n) {
+  char *p = static_cast<char *>(std::malloc(n + kHeader));
+  if (p == nullptr) throw std::bad_alloc();
+  *reinterpret_cast<std::size_t *>(p) = n;
+  live_bytes += n;
+  return p + kHeader;
+}
+__attribute__((noinline)) void operator delete(void *p) noexcept {
+  if (p == nullptr) return;
+  char *base = static_cast<char *>(p) - kHeader;
+  live_bytes -= *reinterpret_cast<std::size_t *>(base);
+  std::free(base);
+}
+void operator delete(void *p, std::size_t) noexcept { operator delete(p); }
+
+namespace {
+
+const std::size_t kValues = 1 << 20;
+const std::size_t kLookups = 4000000;
+
+std::uint32_t nextValue(std::uint32_t &state) {
+  state = state * 1664525u + 1013904223u;
+  return state;
+}
+
+// kValues IDs drawn from [0, range), sorted and unique.
+std::vector<std::uint32_t> makeIds(std::uint32_t seed, std::uint64_t range) {
+  std::vector<bool> taken(range);
+  std::vector<std::uint32_t> res;
+  std::uint32_t state = seed;
+  while (res.size() < kValues) {
+    std::uint32_t id =
+        std::uint32_t((std::uint64_t(nextValue(state)) * range) >> 32);
+    if (!taken[id]) {
+      taken[id] = true;
+      res.push_back(id);
+    }
+  }
+  res.clear();
+  for (std::uint32_t id = 0; id < range; id++) {
+    if (taken[id]) res.push_back(id);
+  }
+  return res;
+}
+
+// IDs handed out in blocks of consecutive numbers, with gaps between.
+std::vector<std::uint32_t> makeBlocks(std::uint32_t seed) {
+  std::vector<std::uint32_t> res;
+  std::uint32_t state = seed;
+  std::uint32_t id = 0;
+  while (res.size() < kValues) {
+    id += 1 + nextValue(state) % 64;
+    std::uint32_t length = 1 + nextValue(state) % 512;
+    for (std::uint32_t i = 0; i < length && res.size() < kValues; i++) {
+      res.push_back(id++);
+    }
+  }
+  return res;
+}
+
+std::string label(const char *kind, const char *what) {
+  return std::string(kind) + " " + what;
+}
+
+// Intersection, union and difference of two s21::sets by one merge over
+// their iterators into a vector, the cheapest result a tree offers.
+template <typename Emit>
+std::size_t mergeSets(s21::set<std::uint32_t> &a, s21::set<std::uint32_t> &b,
+                      Emit emit) {
+  std::vector<std::uint32_t> out;
+  auto i = a.begin();
+  auto j = b.begin();
+  while (i != a.end() || j != b.end()) {
+    if (j == b.end() || (i != a.end() && *i < *j)) {
+      emit(out, *i, true, false);
+      ++i;
+    } else if (i == a.end() || *j < *i) {
+      emit(out, *j, false, true);
+      ++j;
+    } else {
+      emit(out, *i, true, true);
+      ++i;
+      ++j;
+    }
+  }
+  return out.size();
+}
+
+void run(const char *kind, const std::vector<std::uint32_t> &ids,
+         const std::vector<std::uint32_t> &other) {
+  std::size_t before = live_bytes;
+  s21::set<std::uint32_t> set_a;
+  for (std::uint32_t id : ids) set_a.insert(id);
+  std::size_t set_bytes = live_bytes - before;
+  s21::set<std::uint32_t> set_b;
+  for (std::uint32_t id : other) set_b.insert(id);
+
+  before = live_bytes;
+  s21::roaring_set roaring_a;
+  for (std::uint32_t id : ids) roaring_a.insert(id);
+  roaring_a.run_optimize();
+  std::size_t roaring_bytes = live_bytes - before;
+  s21::roaring_set roaring_b;
+  for (std::uint32_t id : other) roaring_b.insert(id);
+  roaring_b.run_optimize();
+
+  std::printf("%-48s %10.2f B/value (roaring_set reports %.2f)\n",
+              label(kind, "set memory").c_str(),
+              double(set_bytes) / ids.size(),
+              double(roaring_a.memory_usage()) / ids.size());
+  std::printf("%-48s %10.2f B/value\n",
+              label(kind, "roaring_set memory").c_str(),
+              double(roaring_bytes) / ids.size());
+
+  std::size_t ops = ids.size() + other.size();
+  std::size_t sink = 0;
+  double ms = bench::measure_ms([&] {
+    sink += mergeSets(set_a, set_b,
+                      [](std::vector<std::uint32_t> &out, std::uint32_t v,
+                         bool in_a, bool in_b) {
+                        if (in_a && in_b) out.push_back(v);
+                      });
+  });
+  bench::report(label(kind, "set intersection").c_str(), ms, ops);
+  ms = bench::measure_ms([&] { sink += (roaring_a & roaring_b).size(); });
+  bench::report(label(kind, "roaring_set intersection").c_str(), ms, ops);
+  ms = bench::measure_ms([&] {
+    sink += mergeSets(
+        set_a, set_b,
+        [](std::vector<std::uint32_t> &out, std::uint32_t v, bool, bool) {
+          out.push_back(v);
+        });
+  });
+  bench::report(label(kind, "set union").c_str(), ms, ops);
+  ms = bench::measure_ms([&] { sink += (roaring_a | roaring_b).size(); });
+  bench::report(label(kind, "roaring_set union").c_str(), ms, ops);
+  ms = bench::measure_ms([&] {
+    sink += mergeSets(set_a, set_b,
+                      [](std::vector<std::uint32_t> &out, std::uint32_t v,
+                         bool in_a, bool in_b) {
+                        if (in_a && !in_b) out.push_back(v);
+                      });
+  });
+  bench::report(label(kind, "set difference").c_str(), ms, ops);
+  ms = bench::measure_ms([&] { sink += (roaring_a - roaring_b).size(); });
+  bench::report(label(kind, "roaring_set difference").c_str(), ms, ops);
+
+  std::uint32_t limit = ids.back() + 1;
+  ms = bench::measure_ms([&] {
+    std::uint32_t state = 9;
+    for (std::size_t i = 0; i < kLookups; i++) {
+      sink += set_a.contains(nextValue(state) % limit);
+    }
+  });
+  bench::report(label(kind, "set contains").c_str(), ms, kLookups);
+  ms = bench::measure_ms([&] {
+    std::uint32_t state = 9;
+    for (std::size_t i = 0; i < kLookups; i++) {
+      sink += roaring_a.contains(nextValue(state) % limit);
+    }
+  });
+  bench::report(label(kind, "roaring_set contains").c_str(), ms, kLookups);
+  bench::do_not_optimize(sink);
+}
+
+}  // namespace
+
+// Three shapes of 1M 32-bit IDs: sparse (arrays), dense (bitmaps) and
+// handed out in blocks (runs).
+int main() {
+  run("sparse", makeIds(1, 1ull << 28), makeIds(2, 1ull << 28));
+  run("dense", makeIds(1, 1ull << 21), makeIds(2, 1ull << 21));
+  run("blocks", makeBlocks(1), makeBlocks(2));
+  return 0;
+}
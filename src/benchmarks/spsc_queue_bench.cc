@@ -0,0 +1,146 @@
+#include <mutex>
+#include <thread>
+
+#include "../s21_queue.h"
+#include "../s21_spsc_queue.h"
+#include "bench.h"
+
+namespace {
+
+const std::size_t kItems = 5000000;
+const std::size_t kRoundTrips = 200000;
+const std::size_t kCapacity = 1024;
+const std::size_t kBatch = 32;
+
+// Spins briefly, then gives the core away so that the benchmark also makes
+// progress on machines with fewer cores than threads.
+void wait_a_bit(unsigned &spins) {
+  if (++spins < 64) {
+    s21::cpu_relax();
+  } else {
+    spins = 0;
+    std::this_thread::yield();
+  }
+}
+
+class locked_queue {
+ public:
+  bool push(int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.size() == kCapacity) return false;
+    queue_.push(value);
+    return true;
+  }
+  bool try_pop(int &out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) return false;
+    out = queue_.front();
+    queue_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::queue<int> queue_;
+};
+
+template <typename Queue>
+void throughput(const char *name, Queue &q) {
+  long long sum = 0;
+  double ms = bench::measure_ms([&] {
+    std::thread producer([&q] {
+      unsigned spins = 0;
+      for (std::size_t i = 0; i < kItems;) {
+        if (q.push(int(i))) {
+          i++;
+        } else {
+          wait_a_bit(spins);
+        }
+      }
+    });
+    unsigned spins = 0;
+    int value = 0;
+    for (std::size_t i = 0; i < kItems;) {
+      if (q.try_pop(value)) {
+        sum += value;
+        i++;
+      } else {
+        wait_a_bit(spins);
+      }
+    }
+    producer.join();
+  });
+  bench::do_not_optimize(sum);
+  bench::report(name, ms, kItems);
+}
+
+void batch_throughput(const char *name) {
+  s21::spsc_queue<int> q(kCapacity);
+  long long sum = 0;
+  double ms = bench::measure_ms([&] {
+    std::thread producer([&q] {
+      unsigned spins = 0;
+      int batch[kBatch];
+      for (std::size_t i = 0; i < kItems;) {
+        std::size_t n = kItems - i < kBatch ? kItems - i : kBatch;
+        for (std::size_t j = 0; j < n; j++) batch[j] = int(i + j);
+        std::size_t pushed = q.push_n(batch, n);
+        if (pushed == 0) wait_a_bit(spins);
+        i += pushed;
+      }
+    });
+    unsigned spins = 0;
+    int batch[kBatch];
+    for (std::size_t i = 0; i < kItems;) {
+      std::size_t popped = q.pop_n(batch, kBatch);
+      for (std::size_t j = 0; j < popped; j++) sum += batch[j];
+      if (popped == 0) wait_a_bit(spins);
+      i += popped;
+    }
+    producer.join();
+  });
+  bench::do_not_optimize(sum);
+  bench::report(name, ms, kItems);
+}
+
+// Bounces one value between two threads through a pair of queues and reports
+// the mean round-trip time.
+void latency() {
+  s21::spsc_queue<int> ping(kCapacity);
+  s21::spsc_queue<int> pong(kCapacity);
+  double ms = bench::measure_ms([&] {
+    std::thread echo([&] {
+      unsigned spins = 0;
+      int value = 0;
+      for (std::size_t i = 0; i < kRoundTrips;) {
+        if (ping.try_pop(value)) {
+          pong.push(value);
+          i++;
+        } else {
+          wait_a_bit(spins);
+        }
+      }
+    });
+    unsigned spins = 0;
+    int value = 0;
+    for (std::size_t i = 0; i < kRoundTrips; i++) {
+      ping.push(int(i));
+      while (!pong.try_pop(value)) wait_a_bit(spins);
+    }
+    echo.join();
+  });
+  std::printf("%-48s %10.1f ns\n", "spsc_queue round trip latency",
+              ms * 1e6 / kRoundTrips);
+}
+
+}  // namespace
+
+int main() {
+  locked_queue locked;
+  throughput("mutex + s21::queue push/pop", locked);
+  s21::spsc_queue<int> spsc(kCapacity);
+  throughput("spsc_queue push/pop", spsc);
+  batch_throughput("spsc_queue push_n/pop_n");
+  latency();
+  return 0;
+}
@@ -0,0 +1,34 @@
+#include "../s21_stack.h"
+#include "bench.h"
+
+namespace {
+
+const std::size_t kOps = 10000000;
+const std::size_t kDepth = 256;
+
+// Mimics a depth-first traversal: the stack repeatedly grows to kDepth
+// values and drains again.
+template <typename Stack>
+void push_pop(const char *name) {
+  Stack s;
+  long long sum = 0;
+  double ms = bench::measure_ms([&] {
+    for (std::size_t i = 0; i < kOps / kDepth; i++) {
+      for (std::size_t j = 0; j < kDepth; j++) s.push(int(j));
+      while (!s.empty()) {
+        sum += s.top();
+        s.pop();
+      }
+    }
+  });
+  bench::do_not_optimize(sum);
+  bench::report(name, ms, 2 * kOps);
+}
+
+}  // namespace
+
+int main() {
+  push_pop<s21::stack<int, s21::list<int>>>("stack<list> push/pop");
+  push_pop<s21::stack<int>>("stack<vector> push/pop");
+  return 0;
+}
@@ -0,0 +1,70 @@
+#include <cstdint>
+#include <unordered_map>
+
+#include "../s21_map.h"
+#include "../s21_unordered_map.h"
+#include "bench.h"
+
+namespace {
+
+const std::size_t kKeys = 1 << 20;
+const std::size_t kLookups = 10000000;
+
+// Present keys have the top bit clear; the keys looked up as misses set it.
+int nextKey(std::uint32_t &state) {
+  state = state * 1664525u + 1013904223u;
+  return int(state & 0x7FFFFFFFu);
+}
+
+template <typename Map>
+bool has(Map &m, int key) {
+  return m.contains(key);
+}
+bool has(std::unordered_map<int, int> &m, int key) { return m.count(key); }
+
+template <typename Map>
+void fill(Map &m) {
+  std::uint32_t state = 1;
+  for (std::size_t i = 0; i < kKeys; i++) m[nextKey(state)] = int(i);
+}
+
+template <typename Map>
+void insert(const char *name) {
+  double ms = bench::measure_ms([&] {
+    Map m;
+    fill(m);
+    bench::do_not_optimize(m.size());
+  });
+  bench::report(name, ms, kKeys);
+}
+
+// Half of the lookups hit a present key and half miss.
+template <typename Map>
+void lookup(const char *name) {
+  Map m;
+  fill(m);
+  std::size_t found = 0;
+  double ms = bench::measure_ms([&] {
+    std::uint32_t state = 1;
+    std::uint32_t miss = 7;
+    for (std::size_t i = 0; i < kLookups; i++) {
+      if (i % kKeys == 0) state = 1;
+      int key = i % 2 ? nextKey(state) : int(nextKey(miss) | 1u << 31);
+      found += has(m, key);
+    }
+  });
+  bench::do_not_optimize(found);
+  bench::report(name, ms, kLookups);
+}
+
+}  // namespace
+
+int main() {
+  insert<s21::map<int, int>>("map operator[] insert");
+  insert<std::unordered_map<int, int>>("std::unordered_map operator[] insert");
+  insert<s21::unordered_map<int, int>>("unordered_map operator[] insert");
+  lookup<s21::map<int, int>>("map contains");
+  lookup<std::unordered_map<int, int>>("std::unordered_map count");
+  lookup<s21::unordered_map<int, int>>("unordered_map contains");
+  return 0;
+}
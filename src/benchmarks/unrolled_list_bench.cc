@@ -0,0 +1,48 @@
+#include "../s21_list.h"
+#include "../s21_unrolled_list.h"
+#include "bench.h"
+
+namespace {
+
+const std::size_t kElements = 1000000;
+const std::size_t kIterations = 20;
+const std::size_t kMiddleInserts = 100000;
+
+template <typename List>
+void iteration(const char *name) {
+  List l;
+  for (std::size_t i = 0; i < kElements; i++) l.push_back(int(i));
+  long long sum = 0;
+  double ms = bench::measure_ms([&] {
+    for (std::size_t k = 0; k < kIterations; k++) {
+      for (auto it = l.begin(); it != l.end(); ++it) sum += *it;
+    }
+  });
+  bench::do_not_optimize(sum);
+  bench::report(name, ms, kElements * kIterations);
+}
+
+template <typename List>
+void middle_insertion(const char *name) {
+  List l;
+  for (std::size_t i = 0; i < kElements / 10; i++) l.push_back(int(i));
+  double ms = bench::measure_ms([&] {
+    auto pos = l.begin();
+    for (std::size_t i = 0; i < kElements / 20; i++) ++pos;
+    for (std::size_t i = 0; i < kMiddleInserts; i++) {
+      pos = l.insert(pos, int(i));
+    }
+  });
+  bench::do_not_optimize(l.front());
+  bench::report(name, ms, kMiddleInserts);
+}
+
+}  // namespace
+
+int main() {
+  iteration<s21::list<int>>("list iteration");
+  iteration<s21::unrolled_list<int>>("unrolled_list iteration");
+  middle_insertion<s21::list<int>>("list middle insertion");
+  middle_insertion<s21::unrolled_list<int>>("unrolled_list middle insertion");
+  return 0;
+}
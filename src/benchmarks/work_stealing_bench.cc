@@ -0,0 +1,97 @@
+#include <mutex>
+#include <string>
+
+#include "../s21_stack.h"
+#include "../s21_thread_pool.h"
+#include "../s21_work_stealing_deque.h"
+#include "bench.h"
+
+namespace {
+
+const std::size_t kOps = 10000000;
+const std::size_t kDepth = 256;
+const int kFib = 34;
+const int kCutoff = 20;
+
+class locked_stack {
+ public:
+  void push(int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stack_.push(value);
+  }
+  bool pop(int &out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stack_.empty()) return false;
+    out = stack_.pop_value();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::stack<int> stack_;
+};
+
+// The owner's push/pop path, which a scheduler hits for every task.
+template <typename Stack>
+void owner_push_pop(const char *name) {
+  Stack s;
+  long long sum = 0;
+  double ms = bench::measure_ms([&] {
+    int value = 0;
+    for (std::size_t i = 0; i < kOps / kDepth; i++) {
+      for (std::size_t j = 0; j < kDepth; j++) s.push(int(j));
+      while (s.pop(value)) sum += value;
+    }
+  });
+  bench::do_not_optimize(sum);
+  bench::report(name, ms, 2 * kOps);
+}
+
+long fib_serial(int n) {
+  return n < 2 ? n : fib_serial(n - 1) + fib_serial(n - 2);
+}
+
+long fib_parallel(s21::thread_pool &pool, int n) {
+  if (n < kCutoff) return fib_serial(n);
+  long left = 0;
+  s21::task_group group(pool);
+  group.run([&] { left = fib_parallel(pool, n - 1); });
+  long right = fib_parallel(pool, n - 2);
+  group.wait();
+  return left + right;
+}
+
+// Number of calls fib_serial(n) makes, used as the operation count.
+std::size_t fib_calls(int n) {
+  std::size_t a = 1, b = 1;
+  for (int i = 1; i < n; i++) {
+    std::size_t c = a + b + 1;
+    a = b;
+    b = c;
+  }
+  return b;
+}
+
+}  // namespace
+
+int main() {
+  owner_push_pop<locked_stack>("mutex + s21::stack owner push/pop");
+  owner_push_pop<s21::work_stealing_deque<int>>(
+      "work_stealing_deque owner push/pop");
+
+  long res = 0;
+  double ms = bench::measure_ms([&] { res = fib_serial(kFib); });
+  bench::do_not_optimize(res);
+  bench::report("fib serial", ms, fib_calls(kFib));
+  for (std::size_t threads = 1; threads <= 8; threads *= 2) {
+    s21::thread_pool pool(threads);
+    ms = bench::measure_ms([&] {
+      pool.submit([&] { res = fib_parallel(pool, kFib); });
+      pool.wait_idle();
+    });
+    bench::do_not_optimize(res);
+    std::string label = "fib thread_pool threads=" + std::to_string(threads);
+    bench::report(label.c_str(), ms, fib_calls(kFib));
+  }
+  return 0;
+}
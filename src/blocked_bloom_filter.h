@@ -0,0 +1,120 @@
+#ifndef CPP2_S21_CONTAINERS_BLOCKED_BLOOM_FILTER
+#define CPP2_S21_CONTAINERS_BLOCKED_BLOOM_FILTER
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace s21 {
+
+// Approximate membership for 64-bit hashes, for answering "certainly not
+// present" without touching the container it guards. Every hash selects one
+// 64-byte block, i.e. one cache line, and sets one bit in each of its eight
+// words, so both insert and mayContain read or write a single line.
+//
+// With capacity() keys inserted, i.e. 16 bits per key, mayContain wrongly
+// answers true for about 0.1% of the hashes never inserted, and for far
+// fewer at lower load. The rate rises quickly beyond capacity(). Bits
+// cannot be removed, so the owner rebuilds the filter from its keys when
+// needed.
+class blocked_bloom_filter {
+ public:
+  using size_type = std::size_t;
+  static constexpr size_type kBitsPerKey = 16;
+
+ private:
+  struct alignas(64) Block {
+    std::uint64_t words_[8];
+  };
+  static constexpr size_type kKeysPerBlock = 512 / kBitsPerKey;
+
+  Block *blocks_;
+  size_type mask_;
+
+  // One bit per word, picked by the top six bits of the low half of hash
+  // times a per-word odd constant.
+  static std::uint64_t bitFor(std::uint64_t hash, int word) {
+    static constexpr std::uint32_t kSalt[8] = {
+        0x47b6137bu, 0x44974d91u, 0x8824ad5bu, 0xa2b7289du,
+        0x705495c7u, 0x2df1424bu, 0x9efc4947u, 0x5c6bfb31u};
+    return std::uint64_t(1) << ((std::uint32_t(hash) * kSalt[word]) >> 26);
+  }
+  const Block &blockFor(std::uint64_t hash) const {
+    return blocks_[(hash >> 32) & mask_];
+  }
+
+ public:
+  // Room for about capacity keys at kBitsPerKey, in a power of two blocks.
+  explicit blocked_bloom_filter(size_type capacity = 0)
+      : blocks_(nullptr), mask_(0) {
+    size_type blocks = 1;
+    while (blocks * kKeysPerBlock < capacity) blocks *= 2;
+    blocks_ = new Block[blocks]();
+    mask_ = blocks - 1;
+  }
+  blocked_bloom_filter(const blocked_bloom_filter &other)
+      : blocks_(new Block[other.mask_ + 1]), mask_(other.mask_) {
+    std::copy(other.blocks_, other.blocks_ + mask_ + 1, blocks_);
+  }
+  blocked_bloom_filter(blocked_bloom_filter &&other) noexcept
+      : blocks_(nullptr), mask_(0) {
+    swap(other);
+  }
+  ~blocked_bloom_filter() { delete[] blocks_; }
+
+  blocked_bloom_filter &operator=(const blocked_bloom_filter &other) {
+    if (this != &other) {
+      blocked_bloom_filter tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+  blocked_bloom_filter &operator=(blocked_bloom_filter &&other) noexcept {
+    if (this != &other) {
+      blocked_bloom_filter tmp(std::move(other));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  size_type capacity() const { return (mask_ + 1) * kKeysPerBlock; }
+  size_type memoryUsage() const { return (mask_ + 1) * sizeof(Block); }
+
+  void insert(std::uint64_t hash) {
+    Block &block = blocks_[(hash >> 32) & mask_];
+    for (int i = 0; i < 8; i++) block.words_[i] |= bitFor(hash, i);
+  }
+
+  // False only if hash was never inserted.
+  bool mayContain(std::uint64_t hash) const {
+    const Block &block = blockFor(hash);
+    std::uint64_t missing = 0;
+    for (int i = 0; i < 8; i++) missing |= bitFor(hash, i) & ~block.words_[i];
+    return missing == 0;
+  }
+
+  void clear() { std::fill(blocks_, blocks_ + mask_ + 1, Block()); }
+
+  void swap(blocked_bloom_filter &other) {
+    std::swap(blocks_, other.blocks_);
+    std::swap(mask_, other.mask_);
+  }
+};
+
+// Lookup counters of a container with a negative-lookup filter. Every
+// lookup is counted once: as a definite miss the filter answered alone, as
+// a false positive that searched the container and missed, or as a hit.
+struct bloom_filter_stats {
+  std::size_t lookups;
+  std::size_t definite_misses;
+  std::size_t false_positives;
+  std::size_t hits;
+  // Times the filter was built again from the keys, after it filled up or
+  // after enough erases left it with stale bits.
+  std::size_t rebuilds;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_BLOCKED_BLOOM_FILTER
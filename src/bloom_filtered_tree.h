@@ -0,0 +1,161 @@
+#ifndef CPP2_S21_CONTAINERS_BLOOM_FILTERED_TREE
+#define CPP2_S21_CONTAINERS_BLOOM_FILTERED_TREE
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "b_plus_tree.h"
+#include "blocked_bloom_filter.h"
+#include "red_black_tree.h"
+
+namespace s21 {
+
+// Tree backend for map, set and multiset that keeps a blocked_bloom_filter
+// of its keys next to a Tree. find and count ask the filter first, so a key
+// that is not present usually costs one cache line instead of a walk down
+// the whole tree; hits pay one extra filter probe. Select it like any
+// backend:
+//
+//   s21::set<int, s21::BloomRBTree> s;
+//   s21::map<std::string, int, s21::BloomBPlusTree> m;
+//
+// Keys need std::hash. The filter grows by rebuilding from the keys once
+// more keys were added than it was sized for. Erased keys leave their bits
+// behind and answer "maybe" until the next rebuild, so the filter is also
+// rebuilt once an eighth of the keys it holds are gone. Both rebuilds are
+// O(n) and amortized O(1) per insert or erase.
+//
+// The 0.1% false positive rate of blocked_bloom_filter holds for keys that
+// were never inserted. Under churn, lookups of recently erased keys are
+// false positives too: with equal shares of inserts and erases over a few
+// thousand keys, about 6% of the misses still search the tree.
+template <typename K, typename V, template <typename, typename> class Tree>
+class BloomFilteredTree : public Tree<K, V> {
+ private:
+  using Base = Tree<K, V>;
+  using size_type = std::size_t;
+  static constexpr size_type kMinCapacity = 64;
+  // Rebuild once more than 1 / kStaleDivisor of the keys added are erased.
+  static constexpr size_type kStaleDivisor = 8;
+
+  blocked_bloom_filter filter_;
+  // Keys inserted into filter_ since it was last built, and how many of
+  // them have been erased since.
+  size_type added_;
+  size_type stale_;
+  bloom_filter_stats stats_;
+
+  static std::uint64_t hashOf(const K &key) {
+    std::uint64_t h = static_cast<std::uint64_t>(std::hash<K>()(key));
+    h *= 0x9E3779B97F4A7C15ull;
+    return h ^ (h >> 32);
+  }
+  // set and multiset store the key itself, map a pair.
+  static const K &keyOf(const V &value) {
+    if constexpr (std::is_same_v<K, V>) {
+      return value;
+    } else {
+      return value.first;
+    }
+  }
+
+  void rebuild() {
+    size_type size = Base::getSize();
+    blocked_bloom_filter filter(std::max(2 * size, kMinCapacity));
+    for (auto it = Base::begin(); it != Base::end(); ++it) {
+      filter.insert(hashOf(keyOf(*it)));
+    }
+    filter_.swap(filter);
+    added_ = size;
+    stale_ = 0;
+    stats_.rebuilds++;
+  }
+  void added(const K &key) {
+    filter_.insert(hashOf(key));
+    if (++added_ > filter_.capacity()) rebuild();
+  }
+
+ public:
+  using iterator = typename Base::iterator;
+  using const_iterator = typename Base::const_iterator;
+
+  BloomFilteredTree()
+      : Base(), filter_(kMinCapacity), added_(0), stale_(0), stats_() {}
+  BloomFilteredTree(const BloomFilteredTree &other)
+      : Base(other),
+        filter_(other.filter_),
+        added_(other.added_),
+        stale_(other.stale_),
+        stats_() {}
+  BloomFilteredTree(BloomFilteredTree &&other) : BloomFilteredTree() {
+    swap(other);
+  }
+
+  iterator find(const K &key) {
+    stats_.lookups++;
+    if (!filter_.mayContain(hashOf(key))) {
+      stats_.definite_misses++;
+      return Base::end();
+    }
+    iterator res = Base::find(key);
+    if (res == Base::end()) {
+      stats_.false_positives++;
+    } else {
+      stats_.hits++;
+    }
+    return res;
+  }
+  size_type count(const K &key) {
+    return find(key) == Base::end() ? 0 : Base::count(key);
+  }
+
+  std::pair<iterator, bool> insertUnique(const K &key, const V &value) {
+    std::pair<iterator, bool> res = Base::insertUnique(key, value);
+    if (res.second) added(key);
+    return res;
+  }
+  // The filter holds one copy of the key per equal element, so erasing
+  // one of them counts as one stale entry like any other erase.
+  iterator insertMulti(const K &key, const V &value) {
+    iterator res = Base::insertMulti(key, value);
+    added(key);
+    return res;
+  }
+
+  void erase(iterator pos) {
+    size_type size = Base::getSize();
+    Base::erase(pos);
+    if (Base::getSize() == size) return;
+    if (kStaleDivisor * ++stale_ > added_) rebuild();
+  }
+
+  void clear() {
+    Base::clear();
+    filter_.clear();
+    added_ = 0;
+    stale_ = 0;
+  }
+
+  void swap(BloomFilteredTree &other) {
+    Base::swap(other);
+    filter_.swap(other.filter_);
+    std::swap(added_, other.added_);
+    std::swap(stale_, other.stale_);
+    std::swap(stats_, other.stats_);
+  }
+
+  bloom_filter_stats filterStats() const { return stats_; }
+};
+
+template <typename K, typename V>
+using BloomRBTree = BloomFilteredTree<K, V, RBTree>;
+template <typename K, typename V>
+using BloomBPlusTree = BloomFilteredTree<K, V, BPlusTree>;
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_BLOOM_FILTERED_TREE
@@ -0,0 +1,64 @@
+#ifndef CPP2_S21_CONTAINERS_CONCURRENCY_UTILS
+#define CPP2_S21_CONTAINERS_CONCURRENCY_UTILS
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+
+namespace s21 {
+
+// Members written by different threads are aligned to this many bytes so
+// that they never share a cache line.
+inline constexpr std::size_t kCacheLineSize = 64;
+
+// Tells the CPU that the calling thread is spinning on a shared location.
+inline void cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__)
+  asm volatile("yield");
+#endif
+}
+
+// Rounds n up to the next power of two; zero becomes one.
+inline std::size_t round_up_to_power_of_two(std::size_t n) {
+  std::size_t res = 1;
+  while (res < n) res <<= 1;
+  return res;
+}
+
+// Test-and-test-and-set lock for critical sections a few dozen instructions
+// long. Waiters spin on a plain load so that the line stays shared until the
+// lock is released, and yield after a while in case the holder was
+// preempted. Meets the Lockable requirements, so std::lock_guard works.
+class spin_lock {
+ public:
+  spin_lock() : locked_(false) {}
+  spin_lock(const spin_lock &) = delete;
+  spin_lock &operator=(const spin_lock &) = delete;
+
+  bool try_lock() {
+    return !locked_.load(std::memory_order_relaxed) &&
+           !locked_.exchange(true, std::memory_order_acquire);
+  }
+  void lock() {
+    for (int spins = 0; !try_lock();) {
+      if (++spins < kSpinsBeforeYield) {
+        cpu_relax();
+      } else {
+        spins = 0;
+        std::this_thread::yield();
+      }
+    }
+  }
+  void unlock() { locked_.store(false, std::memory_order_release); }
+
+ private:
+  static constexpr int kSpinsBeforeYield = 64;
+
+  std::atomic<bool> locked_;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_CONCURRENCY_UTILS
@@ -0,0 +1,375 @@
+#ifndef CPP2_S21_CONTAINERS_CONCURRENT_SKIP_LIST
+#define CPP2_S21_CONTAINERS_CONCURRENT_SKIP_LIST
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <utility>
+
+#include "epoch_reclamation.h"
+
+namespace s21 {
+
+// Lock-free ordered set of values with unique keys, the engine behind
+// concurrent_map and concurrent_set. KeyOf extracts the key of a value.
+//
+// Nodes form a skip list: every node is linked into the sorted list at level
+// 0 and, with probability 1/2 per level, into the sparser lists above it.
+// The low bit of a node's next pointer at some level marks the node as
+// deleted at that level, and a marked pointer is never changed again.
+//
+// - insert links a node at level 0 with one CAS, which makes it visible,
+//   and then links the levels above one by one.
+// - erase marks the levels of a node top-down; marking level 0 is the
+//   moment the node is erased. Traversals that run into a marked node unlink
+//   it with a CAS on its predecessor.
+// - find, contains and lower_bound skip marked nodes without writing
+//   anything, so they finish in a bounded number of steps whatever other
+//   threads do.
+//
+// A node may still be linked into an upper level by its inserter after it
+// is erased, so both the inserter and the eraser hold a reference to it, and
+// the one that drops the last reference, after making sure the node is
+// unlinked everywhere, hands it to epoch_domain::retire. Every operation and
+// every iterator keeps the calling thread pinned, so nodes are never freed
+// under a reader. Values are never modified once inserted.
+template <typename Value, typename Key, typename KeyOf, typename Compare>
+class concurrent_skip_list {
+ public:
+  using size_type = std::size_t;
+
+  static constexpr int kMaxHeight = 32;
+
+ private:
+  struct Node {
+    int height_;
+    std::atomic<int> owners_;
+    alignas(Value) unsigned char storage_[sizeof(Value)];
+    // Allocated with height_ entries.
+    std::atomic<std::uintptr_t> next_[1];
+
+    explicit Node(int height) : height_(height), owners_(2), next_{0} {}
+    Value &value() { return *reinterpret_cast<Value *>(storage_); }
+  };
+
+  Node *head_;
+  std::atomic<size_type> size_;
+  Compare comp_;
+
+  static Node *pointerOf(std::uintptr_t next) {
+    return reinterpret_cast<Node *>(next & ~std::uintptr_t(1));
+  }
+  static bool marked(std::uintptr_t next) { return next & 1; }
+  static std::uintptr_t bitsOf(Node *node) {
+    return reinterpret_cast<std::uintptr_t>(node);
+  }
+
+  static Node *allocate(int height) {
+    void *raw = ::operator new(
+        sizeof(Node) +
+        std::size_t(height - 1) * sizeof(std::atomic<std::uintptr_t>));
+    Node *node = new (raw) Node(height);
+    for (int l = 1; l < height; l++) {
+      new (&node->next_[l]) std::atomic<std::uintptr_t>(0);
+    }
+    return node;
+  }
+  static void deallocate(Node *node) {
+    node->~Node();
+    ::operator delete(node);
+  }
+  static void destroy(void *pointer) {
+    Node *node = static_cast<Node *>(pointer);
+    node->value().~Value();
+    deallocate(node);
+  }
+
+  // 1 + the number of trailing zero bits of a per-thread xorshift, so a
+  // node reaches level l with probability 2^-l.
+  static int randomHeight() {
+    static thread_local std::uint32_t state = 0x9E3779B9u;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return 1 + __builtin_ctz(state | (1u << (kMaxHeight - 1)));
+  }
+
+  const Key &keyOf(Node *node) const { return KeyOf()(node->value()); }
+
+  // Fills preds and succs with the last node before key and the first node
+  // not before it at every level, unlinking marked nodes on the way. Returns
+  // false if an unlink failed because the list changed under it.
+  bool tryFind(const Key &key, Node **preds, Node **succs) const {
+    Node *pred = head_;
+    for (int l = kMaxHeight - 1; l >= 0; l--) {
+      Node *curr = pointerOf(pred->next_[l].load(std::memory_order_acquire));
+      while (curr != nullptr) {
+        std::uintptr_t succ = curr->next_[l].load(std::memory_order_acquire);
+        if (marked(succ)) {
+          std::uintptr_t expected = bitsOf(curr);
+          if (!pred->next_[l].compare_exchange_strong(
+                  expected, succ & ~std::uintptr_t(1),
+                  std::memory_order_acq_rel, std::memory_order_acquire)) {
+            return false;
+          }
+          curr = pointerOf(succ);
+        } else if (comp_(keyOf(curr), key)) {
+          pred = curr;
+          curr = pointerOf(succ);
+        } else {
+          break;
+        }
+      }
+      preds[l] = pred;
+      succs[l] = curr;
+    }
+    return true;
+  }
+
+  // Whether succs[0] holds key after a successful tryFind.
+  bool find(const Key &key, Node **preds, Node **succs) const {
+    while (!tryFind(key, preds, succs)) {
+    }
+    return succs[0] != nullptr && !comp_(key, keyOf(succs[0]));
+  }
+
+  // First node at level 0 that is not before key and was not erased when
+  // it was looked at. Only reads.
+  Node *lowerBoundNode(const Key &key) const {
+    Node *pred = head_;
+    Node *curr = nullptr;
+    for (int l = kMaxHeight - 1; l >= 0; l--) {
+      curr = pointerOf(pred->next_[l].load(std::memory_order_acquire));
+      while (curr != nullptr) {
+        std::uintptr_t succ = curr->next_[l].load(std::memory_order_acquire);
+        if (marked(succ)) {
+          curr = pointerOf(succ);
+        } else if (comp_(keyOf(curr), key)) {
+          pred = curr;
+          curr = pointerOf(succ);
+        } else {
+          break;
+        }
+      }
+    }
+    return curr;
+  }
+
+  // First node at level 0 after node that was not erased when it was
+  // looked at. node itself may be erased already; its next pointer still
+  // leads forward.
+  static Node *nextLive(Node *node) {
+    Node *next = pointerOf(node->next_[0].load(std::memory_order_acquire));
+    while (next != nullptr &&
+           marked(next->next_[0].load(std::memory_order_acquire))) {
+      next = pointerOf(next->next_[0].load(std::memory_order_acquire));
+    }
+    return next;
+  }
+
+  // Drops one of the two references to a linked node.
+  static void release(Node *node) {
+    if (node->owners_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      epoch_domain::instance().retire(node, &destroy);
+    }
+  }
+
+  // Links node into the levels above 0 until it is linked everywhere or
+  // erased, then drops the inserter's reference.
+  void linkUpperLevels(Node *node, Node **preds, Node **succs) {
+    const Key &key = keyOf(node);
+    for (int l = 1; l < node->height_; l++) {
+      bool linked = false;
+      while (!linked) {
+        std::uintptr_t next = node->next_[l].load(std::memory_order_acquire);
+        if (marked(next)) break;
+        if (pointerOf(next) != succs[l] &&
+            !node->next_[l].compare_exchange_strong(
+                next, bitsOf(succs[l]), std::memory_order_acq_rel)) {
+          break;
+        }
+        std::uintptr_t expected = bitsOf(succs[l]);
+        linked = preds[l]->next_[l].compare_exchange_strong(
+            expected, bitsOf(node), std::memory_order_acq_rel);
+        if (!linked && (!find(key, preds, succs) || succs[0] != node)) break;
+      }
+      if (!linked) break;
+    }
+    // An eraser may have missed the levels linked after its own cleanup.
+    if (marked(node->next_[0].load(std::memory_order_acquire))) {
+      find(key, preds, succs);
+    }
+    release(node);
+  }
+
+ public:
+  class SkipListIterator {
+    friend class concurrent_skip_list;
+
+    Node *node_;
+
+    explicit SkipListIterator(Node *node) : node_(node) {
+      epoch_domain::instance().enter();
+    }
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Value;
+    using difference_type = std::ptrdiff_t;
+    using reference = const Value &;
+    using pointer = const Value *;
+
+    // An iterator keeps its thread pinned, so the node it points at stays
+    // readable even after it is erased. It must be used and destroyed on
+    // the thread that created it.
+    SkipListIterator() : SkipListIterator(nullptr) {}
+    SkipListIterator(const SkipListIterator &other)
+        : SkipListIterator(other.node_) {}
+    ~SkipListIterator() { epoch_domain::instance().leave(); }
+    SkipListIterator &operator=(const SkipListIterator &other) {
+      node_ = other.node_;
+      return *this;
+    }
+
+    reference operator*() const { return node_->value(); }
+    pointer operator->() const { return &node_->value(); }
+
+    SkipListIterator &operator++() {
+      node_ = nextLive(node_);
+      return *this;
+    }
+    SkipListIterator operator++(int) {
+      SkipListIterator tmp(*this);
+      ++*this;
+      return tmp;
+    }
+
+    bool operator==(const SkipListIterator &other) const {
+      return node_ == other.node_;
+    }
+    bool operator!=(const SkipListIterator &other) const {
+      return node_ != other.node_;
+    }
+  };
+
+  using iterator = SkipListIterator;
+
+  concurrent_skip_list() : head_(allocate(kMaxHeight)), size_(0), comp_() {}
+  concurrent_skip_list(const concurrent_skip_list &) = delete;
+  concurrent_skip_list &operator=(const concurrent_skip_list &) = delete;
+  // Must not run concurrently with anything else.
+  ~concurrent_skip_list() {
+    Node *node = pointerOf(head_->next_[0].load(std::memory_order_relaxed));
+    while (node != nullptr) {
+      Node *next = pointerOf(node->next_[0].load(std::memory_order_relaxed));
+      destroy(node);
+      node = next;
+    }
+    deallocate(head_);
+  }
+
+  // A snapshot that may be stale by the time it is returned.
+  size_type size() const { return size_.load(std::memory_order_relaxed); }
+
+  iterator begin() const {
+    epoch_guard guard;
+    Node *first = pointerOf(head_->next_[0].load(std::memory_order_acquire));
+    if (first != nullptr &&
+        marked(first->next_[0].load(std::memory_order_acquire))) {
+      first = nextLive(first);
+    }
+    return iterator(first);
+  }
+  iterator end() const { return iterator(nullptr); }
+
+  iterator lower_bound(const Key &key) const {
+    epoch_guard guard;
+    return iterator(lowerBoundNode(key));
+  }
+
+  iterator find(const Key &key) const {
+    epoch_guard guard;
+    Node *node = lowerBoundNode(key);
+    if (node != nullptr && comp_(key, keyOf(node))) node = nullptr;
+    return iterator(node);
+  }
+
+  bool contains(const Key &key) const {
+    epoch_guard guard;
+    Node *node = lowerBoundNode(key);
+    return node != nullptr && !comp_(key, keyOf(node));
+  }
+
+  // Inserts a value built from args unless its key is present. The value
+  // is built before searching.
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    epoch_guard guard;
+    Node *node = allocate(randomHeight());
+    try {
+      new (node->storage_) Value(std::forward<Args>(args)...);
+    } catch (...) {
+      deallocate(node);
+      throw;
+    }
+    const Key &key = keyOf(node);
+    Node *preds[kMaxHeight];
+    Node *succs[kMaxHeight];
+    for (;;) {
+      if (find(key, preds, succs)) {
+        iterator existing(succs[0]);
+        destroy(node);
+        return {existing, false};
+      }
+      for (int l = 0; l < node->height_; l++) {
+        node->next_[l].store(bitsOf(succs[l]), std::memory_order_relaxed);
+      }
+      std::uintptr_t expected = bitsOf(succs[0]);
+      if (preds[0]->next_[0].compare_exchange_strong(
+              expected, bitsOf(node), std::memory_order_release,
+              std::memory_order_relaxed)) {
+        break;
+      }
+    }
+    size_.fetch_add(1, std::memory_order_relaxed);
+    iterator res(node);
+    linkUpperLevels(node, preds, succs);
+    return {res, true};
+  }
+
+  // Erases every value present when the walk reaches it. Values inserted
+  // concurrently may survive.
+  void clear() {
+    for (iterator it = begin(); it != end(); ++it) erase(KeyOf()(*it));
+  }
+
+  size_type erase(const Key &key) {
+    epoch_guard guard;
+    Node *preds[kMaxHeight];
+    Node *succs[kMaxHeight];
+    if (!find(key, preds, succs)) return 0;
+    Node *node = succs[0];
+    for (int l = node->height_ - 1; l >= 1; l--) {
+      std::uintptr_t next = node->next_[l].load(std::memory_order_acquire);
+      while (!marked(next) &&
+             !node->next_[l].compare_exchange_weak(
+                 next, next | 1, std::memory_order_acq_rel)) {
+      }
+    }
+    std::uintptr_t next = node->next_[0].load(std::memory_order_acquire);
+    do {
+      if (marked(next)) return 0;
+    } while (!node->next_[0].compare_exchange_weak(
+        next, next | 1, std::memory_order_acq_rel));
+    size_.fetch_sub(1, std::memory_order_relaxed);
+    find(key, preds, succs);
+    release(node);
+    return 1;
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_CONCURRENT_SKIP_LIST
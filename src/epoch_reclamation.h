@@ -0,0 +1,182 @@
+#ifndef CPP2_S21_CONTAINERS_EPOCH_RECLAMATION
+#define CPP2_S21_CONTAINERS_EPOCH_RECLAMATION
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "concurrency_utils.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Deferred freeing for lock-free containers.
+//
+// A thread that reads shared nodes first pins itself with an epoch_guard.
+// A node unlinked from a container is handed to retire() instead of being
+// deleted; it is freed once the global epoch has advanced twice past the
+// epoch it was retired in, which can only happen after every thread that was
+// pinned at the time has unpinned. The epoch advances when all pinned threads
+// have caught up with it.
+//
+// Threads register lazily on first use and give their record back when they
+// exit; a record's retired nodes are inherited by the next thread that claims
+// it. Retired nodes are kept per thread and reclaimed in batches, so retire()
+// is a push_back most of the time.
+class epoch_domain {
+ public:
+  using size_type = std::size_t;
+  using deleter_type = void (*)(void *);
+
+ private:
+  struct Retired {
+    void *pointer_;
+    deleter_type deleter_;
+    std::uint64_t epoch_;
+  };
+
+  // epoch_ holds (epoch << 1) | 1 while the owner is pinned and 0 otherwise.
+  struct alignas(kCacheLineSize) Record {
+    std::atomic<std::uint64_t> epoch_{0};
+    std::atomic<bool> owned_{true};
+    Record *next_ = nullptr;
+    unsigned nesting_ = 0;
+    size_type sinceCollect_ = 0;
+    vector<Retired> retired_;
+  };
+
+  // Gives the record back when its thread exits.
+  struct ThreadState {
+    Record *record_ = nullptr;
+    ~ThreadState() {
+      if (record_ != nullptr) {
+        record_->owned_.store(false, std::memory_order_release);
+      }
+    }
+  };
+
+  static constexpr size_type kCollectEvery = 64;
+
+  alignas(kCacheLineSize) std::atomic<std::uint64_t> epoch_;
+  alignas(kCacheLineSize) std::atomic<Record *> records_;
+
+  epoch_domain() : epoch_(0), records_(nullptr) {}
+
+  Record *acquireRecord() {
+    for (Record *r = records_.load(std::memory_order_acquire); r != nullptr;
+         r = r->next_) {
+      bool owned = false;
+      if (!r->owned_.load(std::memory_order_relaxed) &&
+          r->owned_.compare_exchange_strong(owned, true,
+                                            std::memory_order_acquire)) {
+        return r;
+      }
+    }
+    Record *r = new Record;
+    r->next_ = records_.load(std::memory_order_relaxed);
+    while (!records_.compare_exchange_weak(r->next_, r,
+                                           std::memory_order_release,
+                                           std::memory_order_relaxed)) {
+    }
+    return r;
+  }
+
+  Record *local() {
+    static thread_local ThreadState state;
+    if (state.record_ == nullptr) state.record_ = acquireRecord();
+    return state.record_;
+  }
+
+  // Advances the global epoch if every pinned thread has observed it.
+  void tryAdvance() {
+    std::uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+    for (Record *r = records_.load(std::memory_order_acquire); r != nullptr;
+         r = r->next_) {
+      std::uint64_t seen = r->epoch_.load(std::memory_order_seq_cst);
+      if ((seen & 1) && (seen >> 1) != epoch) return;
+    }
+    epoch_.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst);
+  }
+
+  // Frees the retired nodes of r that no pinned thread can still reach.
+  void reclaim(Record *r) {
+    std::uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+    size_type kept = 0;
+    for (size_type i = 0; i < r->retired_.size(); i++) {
+      Retired entry = r->retired_[i];
+      if (entry.epoch_ + 2 <= epoch) {
+        entry.deleter_(entry.pointer_);
+      } else {
+        r->retired_[kept++] = entry;
+      }
+    }
+    while (r->retired_.size() > kept) r->retired_.pop_back();
+    r->sinceCollect_ = 0;
+  }
+
+ public:
+  epoch_domain(const epoch_domain &) = delete;
+  epoch_domain &operator=(const epoch_domain &) = delete;
+
+  // The domain shared by every container. It is never destroyed, so static
+  // containers may retire nodes during program exit.
+  static epoch_domain &instance() {
+    static epoch_domain *domain = new epoch_domain;
+    return *domain;
+  }
+
+  // Pins the calling thread. Calls nest; only the outermost pair matters.
+  void enter() {
+    Record *r = local();
+    if (r->nesting_++ != 0) return;
+    std::uint64_t epoch = epoch_.load(std::memory_order_relaxed);
+    r->epoch_.store((epoch << 1) | 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+  }
+
+  void leave() {
+    Record *r = local();
+    if (--r->nesting_ == 0) r->epoch_.store(0, std::memory_order_release);
+  }
+
+  // Frees pointer with deleter once no pinned thread can still reach it.
+  void retire(void *pointer, deleter_type deleter) {
+    Record *r = local();
+    r->retired_.push_back(
+        Retired{pointer, deleter, epoch_.load(std::memory_order_seq_cst)});
+    if (++r->sinceCollect_ >= kCollectEvery) collect();
+  }
+
+  template <typename T>
+  void retire(T *pointer) {
+    retire(pointer, [](void *p) { delete static_cast<T *>(p); });
+  }
+
+  // Tries to advance the epoch and frees what the calling thread retired
+  // that is no longer reachable.
+  void collect() {
+    tryAdvance();
+    reclaim(local());
+  }
+
+  // Number of nodes the calling thread has retired but not yet freed.
+  size_type retired_count() { return local()->retired_.size(); }
+
+  std::uint64_t epoch() const { return epoch_.load(std::memory_order_relaxed); }
+};
+
+// Keeps the calling thread pinned for its lifetime.
+class epoch_guard {
+ public:
+  epoch_guard() : domain_(epoch_domain::instance()) { domain_.enter(); }
+  epoch_guard(const epoch_guard &) = delete;
+  epoch_guard &operator=(const epoch_guard &) = delete;
+  ~epoch_guard() { domain_.leave(); }
+
+ private:
+  epoch_domain &domain_;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_EPOCH_RECLAMATION
@@ -0,0 +1,195 @@
+#ifndef CPP2_S21_CONTAINERS_EYTZINGER_ARRAY
+#define CPP2_S21_CONTAINERS_EYTZINGER_ARRAY
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#include "concurrency_utils.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Positions in an Eytzinger layout are 1-based: the root is at 1 and the
+// children of k are at 2k and 2k + 1, so a search goes down the array from
+// the front instead of jumping across it. 0 stands for "no position".
+
+// Position of the smallest of n keys.
+inline std::size_t eytzinger_first(std::size_t n) {
+  if (n == 0) return 0;
+  std::size_t k = 1;
+  while (2 * k <= n) k = 2 * k;
+  return k;
+}
+
+// Position of the largest of n keys.
+inline std::size_t eytzinger_last(std::size_t n) {
+  std::size_t k = 0;
+  while (2 * k + 1 <= n) k = 2 * k + 1;
+  return k;
+}
+
+// In-order successor of position k, or 0 after the largest key. Without a
+// right subtree, climbs while k is a right child and then once more.
+inline std::size_t eytzinger_next(std::size_t k, std::size_t n) {
+  if (2 * k + 1 <= n) {
+    k = 2 * k + 1;
+    while (2 * k <= n) k = 2 * k;
+    return k;
+  }
+  return k >> (__builtin_ctzll(~static_cast<unsigned long long>(k)) + 1);
+}
+
+// In-order predecessor of position k; the predecessor of 0 is the largest.
+inline std::size_t eytzinger_prev(std::size_t k, std::size_t n) {
+  if (k == 0) return eytzinger_last(n);
+  if (2 * k <= n) {
+    k = 2 * k;
+    while (2 * k + 1 <= n) k = 2 * k + 1;
+    return k;
+  }
+  return k >> (__builtin_ctzll(static_cast<unsigned long long>(k)) + 1);
+}
+
+// Sorted keys, or values in the order of their keys, stored in Eytzinger
+// order in one cache-line aligned block. Position 0 is left unused, so the
+// 2^d descendants of k that lie d levels down start at k * 2^d and share a
+// cache line when 2^d keys fit in one.
+template <typename Key>
+class EytzingerArray {
+ public:
+  using size_type = std::size_t;
+
+  // Keys per cache line, rounded down to a power of two, at least 2.
+  static constexpr size_type kPrefetchStride =
+      kCacheLineSize / sizeof(Key) >= 16  ? 16
+      : kCacheLineSize / sizeof(Key) >= 8 ? 8
+      : kCacheLineSize / sizeof(Key) >= 4 ? 4
+                                          : 2;
+
+ private:
+  Key *base_;
+  size_type size_;
+
+  static Key *allocate(size_type n) {
+    return static_cast<Key *>(::operator new(
+        (n + 1) * sizeof(Key), std::align_val_t(kCacheLineSize)));
+  }
+  static void deallocate(Key *base) {
+    ::operator delete(base, std::align_val_t(kCacheLineSize));
+  }
+
+  // Asks for the cache line holding the descendants of k a few levels
+  // down, so it arrives while the levels in between are compared. The
+  // address may lie past the array; a prefetch never faults.
+  void prefetch(size_type k) const {
+    __builtin_prefetch(reinterpret_cast<const void *>(
+        reinterpret_cast<std::uintptr_t>(base_) +
+        k * kPrefetchStride * sizeof(Key)));
+  }
+
+  // Given the position a search fell off the tree at, strips the trailing
+  // right turns and the last left turn, which lands on the last key that
+  // sent the search left, or 0 if there was none.
+  static size_type landing(size_type k) {
+    return k >> (__builtin_ctzll(~static_cast<unsigned long long>(k)) + 1);
+  }
+
+  // Constructs the key at every position k from make(k), visiting the
+  // positions in sorted order, so that make can hand out sorted keys one
+  // after another.
+  template <typename Make>
+  void build(size_type n, Make make) {
+    if (n == 0) return;
+    base_ = allocate(n);
+    size_type k = eytzinger_first(n);
+    size_type done = 0;
+    try {
+      for (; k != 0; k = eytzinger_next(k, n), done++) {
+        new (base_ + k) Key(make(k));
+      }
+    } catch (...) {
+      k = eytzinger_first(n);
+      for (; done > 0; k = eytzinger_next(k, n), done--) base_[k].~Key();
+      deallocate(base_);
+      base_ = nullptr;
+      throw;
+    }
+    size_ = n;
+  }
+
+ public:
+  EytzingerArray() : base_(nullptr), size_(0) {}
+  // Takes keys, which must be sorted and unique.
+  explicit EytzingerArray(vector<Key> &&keys) : EytzingerArray() {
+    size_type i = 0;
+    build(keys.size(), [&keys, &i](size_type) { return std::move(keys[i++]); });
+  }
+  EytzingerArray(const EytzingerArray &other) : EytzingerArray() {
+    build(other.size_, [&other](size_type k) { return other.base_[k]; });
+  }
+  EytzingerArray(EytzingerArray &&other) noexcept : EytzingerArray() {
+    swap(other);
+  }
+  ~EytzingerArray() { clear(); }
+
+  EytzingerArray &operator=(const EytzingerArray &other) {
+    if (this != &other) {
+      EytzingerArray tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+  EytzingerArray &operator=(EytzingerArray &&other) noexcept {
+    if (this != &other) {
+      EytzingerArray tmp(std::move(other));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  void clear() {
+    for (size_type k = 1; k <= size_; k++) base_[k].~Key();
+    if (base_ != nullptr) deallocate(base_);
+    base_ = nullptr;
+    size_ = 0;
+  }
+
+  void swap(EytzingerArray &other) noexcept {
+    std::swap(base_, other.base_);
+    std::swap(size_, other.size_);
+  }
+
+  size_type size() const { return size_; }
+  const Key &operator[](size_type k) const { return base_[k]; }
+  const Key *data() const { return base_; }
+
+  // Position of the first key not less than key, or 0. Every step is one
+  // comparison turned into an index with no branch on its outcome, so the
+  // loop only mispredicts when it ends.
+  template <typename Compare>
+  size_type lowerBound(const Key &key, const Compare &comp) const {
+    size_type k = 1;
+    while (k <= size_) {
+      prefetch(k);
+      k = 2 * k + size_type(comp(base_[k], key));
+    }
+    return landing(k);
+  }
+
+  // Position of the first key greater than key, or 0.
+  template <typename Compare>
+  size_type upperBound(const Key &key, const Compare &comp) const {
+    size_type k = 1;
+    while (k <= size_) {
+      prefetch(k);
+      k = 2 * k + size_type(!comp(key, base_[k]));
+    }
+    return landing(k);
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_EYTZINGER_ARRAY
@@ -0,0 +1,501 @@
+#ifndef CPP2_S21_CONTAINERS_FLAT_HASH_TABLE
+#define CPP2_S21_CONTAINERS_FLAT_HASH_TABLE
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) && !defined(S21_NO_SIMD)
+#include <emmintrin.h>
+#endif
+
+namespace s21 {
+
+// One control byte per slot: kEmptyCtrl for a free slot, or the low seven
+// bits of the hash (h2) for a full one.
+using hash_ctrl_t = signed char;
+inline constexpr hash_ctrl_t kEmptyCtrl = -128;
+inline constexpr std::size_t kHashGroupWidth = 16;
+
+// Sixteen control bytes compared one at a time. Bit i of a result stands for
+// byte i.
+struct portable_group {
+  hash_ctrl_t ctrl_[kHashGroupWidth];
+
+  explicit portable_group(const hash_ctrl_t *ctrl) {
+    std::memcpy(ctrl_, ctrl, kHashGroupWidth);
+  }
+  std::uint32_t match(hash_ctrl_t h2) const {
+    std::uint32_t mask = 0;
+    for (std::size_t i = 0; i < kHashGroupWidth; i++) {
+      if (ctrl_[i] == h2) mask |= std::uint32_t(1) << i;
+    }
+    return mask;
+  }
+  std::uint32_t match_empty() const {
+    std::uint32_t mask = 0;
+    for (std::size_t i = 0; i < kHashGroupWidth; i++) {
+      if (ctrl_[i] == kEmptyCtrl) mask |= std::uint32_t(1) << i;
+    }
+    return mask;
+  }
+};
+
+#if defined(__SSE2__) && !defined(S21_NO_SIMD)
+// The same queries answered for all sixteen bytes by one compare and one
+// movemask. Empty is the only control value with the sign bit set.
+struct sse2_group {
+  __m128i ctrl_;
+
+  explicit sse2_group(const hash_ctrl_t *ctrl)
+      : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl))) {}
+  std::uint32_t match(hash_ctrl_t h2) const {
+    return static_cast<std::uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl_, _mm_set1_epi8(h2))));
+  }
+  std::uint32_t match_empty() const {
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(ctrl_));
+  }
+};
+using hash_group = sse2_group;
+#else
+using hash_group = portable_group;
+#endif
+
+// Open-addressing engine behind unordered_map and friends. KeyOf extracts
+// the key from a stored Value.
+//
+// The table uses linear probing, but scans sixteen control bytes per step
+// with hash_group, so a lookup usually touches one group and compares full
+// keys only where the 7-bit h2 matches. The control array repeats its first
+// fifteen bytes after the end, so a group can start at any slot without
+// wrapping. Because probing is linear, erase can shift the rest of the probe
+// run back by one slot instead of leaving a tombstone; lookups therefore
+// never have to skip deleted slots, and the table never needs rehashing just
+// to clean them up. Both inserting and erasing may move values, so either
+// invalidates iterators and references.
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+class flat_hash_table {
+ public:
+  using value_type = Value;
+  using key_type = Key;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+
+  static constexpr size_type npos = size_type(-1);
+
+ private:
+  hash_ctrl_t *ctrl_;
+  value_type *slots_;
+  size_type capacity_;
+  size_type size_;
+  float maxLoad_;
+  hasher hash_;
+  key_equal eq_;
+
+  static constexpr size_type kMinCapacity = kHashGroupWidth;
+  static constexpr float kMaxLoadLimit = 0.9375f;
+
+  static hash_ctrl_t emptyGroup[kHashGroupWidth];
+
+  // Spreads the bits of hashes such as std::hash<int>, which is the
+  // identity, over the whole word before splitting it into h1 and h2.
+  std::uint64_t hashOf(const key_type &key) const {
+    std::uint64_t h = static_cast<std::uint64_t>(hash_(key));
+    h *= 0x9E3779B97F4A7C15ull;
+    return h ^ (h >> 32);
+  }
+  static size_type h1(std::uint64_t hash) { return size_type(hash >> 7); }
+  static hash_ctrl_t h2(std::uint64_t hash) {
+    return static_cast<hash_ctrl_t>(hash & 0x7F);
+  }
+
+  size_type mask() const { return capacity_ - 1; }
+
+  void setCtrl(size_type i, hash_ctrl_t value) {
+    ctrl_[i] = value;
+    if (i < kHashGroupWidth - 1) ctrl_[capacity_ + i] = value;
+  }
+
+  static const key_type &keyOf(const value_type &value) {
+    return KeyOf()(value);
+  }
+
+  // First empty slot on the probe sequence of hash.
+  size_type findEmpty(std::uint64_t hash) const {
+    size_type pos = h1(hash) & mask();
+    for (;;) {
+      std::uint32_t empty = hash_group(ctrl_ + pos).match_empty();
+      if (empty) return (pos + __builtin_ctz(empty)) & mask();
+      pos = (pos + kHashGroupWidth) & mask();
+    }
+  }
+
+  size_type capacityFor(size_type n) const {
+    size_type capacity = kMinCapacity;
+    while (float(n) > float(capacity) * maxLoad_) capacity *= 2;
+    return capacity;
+  }
+
+  void allocate(size_type capacity) {
+    capacity_ = capacity;
+    ctrl_ = new hash_ctrl_t[capacity + kHashGroupWidth - 1];
+    std::memset(ctrl_, kEmptyCtrl, capacity + kHashGroupWidth - 1);
+    slots_ = static_cast<value_type *>(
+        ::operator new(sizeof(value_type) * capacity));
+  }
+
+  void release() {
+    if (capacity_ == 0) return;
+    delete[] ctrl_;
+    ::operator delete(slots_);
+    ctrl_ = emptyGroup;
+    slots_ = nullptr;
+    capacity_ = 0;
+  }
+
+  void resize(size_type capacity) {
+    hash_ctrl_t *old_ctrl = ctrl_;
+    value_type *old_slots = slots_;
+    size_type old_capacity = capacity_;
+    allocate(capacity);
+    for (size_type i = 0; i < old_capacity; i++) {
+      if (old_ctrl[i] == kEmptyCtrl) continue;
+      std::uint64_t hash = hashOf(keyOf(old_slots[i]));
+      size_type pos = findEmpty(hash);
+      new (slots_ + pos) value_type(std::move(old_slots[i]));
+      old_slots[i].~value_type();
+      setCtrl(pos, h2(hash));
+    }
+    if (old_capacity) {
+      delete[] old_ctrl;
+      ::operator delete(old_slots);
+    }
+  }
+
+  bool needsGrowth(size_type n) const {
+    return capacity_ == 0 || float(n) > float(capacity_) * maxLoad_;
+  }
+  void growFor(size_type n) {
+    if (needsGrowth(n)) resize(capacityFor(n));
+  }
+
+  template <typename Make>
+  size_type placeNew(std::uint64_t hash, Make &&make) {
+    size_type pos = findEmpty(hash);
+    make(slots_ + pos);
+    setCtrl(pos, h2(hash));
+    size_++;
+    return pos;
+  }
+
+ public:
+  template <bool Const>
+  class HashTableIterator {
+    friend class flat_hash_table;
+    template <bool>
+    friend class HashTableIterator;
+
+    const hash_ctrl_t *ctrl_;
+    const hash_ctrl_t *end_;
+    Value *slot_;
+
+    HashTableIterator(const hash_ctrl_t *ctrl, const hash_ctrl_t *end,
+                      Value *slot)
+        : ctrl_(ctrl), end_(end), slot_(slot) {
+      skipEmpty();
+    }
+    void skipEmpty() {
+      while (ctrl_ != end_ && *ctrl_ == kEmptyCtrl) {
+        ++ctrl_;
+        ++slot_;
+      }
+    }
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Value;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::conditional_t<Const, const Value &, Value &>;
+    using pointer = std::conditional_t<Const, const Value *, Value *>;
+
+    HashTableIterator() : ctrl_(nullptr), end_(nullptr), slot_(nullptr) {}
+    template <bool OtherConst,
+              typename = std::enable_if_t<Const && !OtherConst>>
+    HashTableIterator(const HashTableIterator<OtherConst> &other)
+        : ctrl_(other.ctrl_), end_(other.end_), slot_(other.slot_) {}
+
+    reference operator*() const { return *slot_; }
+    pointer operator->() const { return slot_; }
+    HashTableIterator &operator++() {
+      ++ctrl_;
+      ++slot_;
+      skipEmpty();
+      return *this;
+    }
+    HashTableIterator operator++(int) {
+      HashTableIterator tmp(*this);
+      ++*this;
+      return tmp;
+    }
+    bool operator==(const HashTableIterator &other) const {
+      return ctrl_ == other.ctrl_;
+    }
+    bool operator!=(const HashTableIterator &other) const {
+      return ctrl_ != other.ctrl_;
+    }
+  };
+
+  using iterator = HashTableIterator<false>;
+  using const_iterator = HashTableIterator<true>;
+
+  flat_hash_table()
+      : ctrl_(emptyGroup),
+        slots_(nullptr),
+        capacity_(0),
+        size_(0),
+        maxLoad_(0.875f),
+        hash_(),
+        eq_() {}
+
+  flat_hash_table(const flat_hash_table &other) : flat_hash_table() {
+    maxLoad_ = other.maxLoad_;
+    hash_ = other.hash_;
+    eq_ = other.eq_;
+    if (other.size_ == 0) return;
+    allocate(other.capacity_);
+    for (size_type i = 0; i < capacity_; i++) {
+      if (other.ctrl_[i] == kEmptyCtrl) continue;
+      new (slots_ + i) value_type(other.slots_[i]);
+      setCtrl(i, other.ctrl_[i]);
+      size_++;
+    }
+  }
+
+  flat_hash_table(flat_hash_table &&other) noexcept : flat_hash_table() {
+    swap(other);
+  }
+
+  ~flat_hash_table() {
+    clear();
+    release();
+  }
+
+  flat_hash_table &operator=(const flat_hash_table &other) {
+    if (this != &other) {
+      flat_hash_table tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  flat_hash_table &operator=(flat_hash_table &&other) noexcept {
+    if (this != &other) {
+      flat_hash_table tmp(std::move(other));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  iterator begin() { return iterator(ctrl_, ctrl_ + capacity_, slots_); }
+  iterator end() {
+    return iterator(ctrl_ + capacity_, ctrl_ + capacity_, slots_ + capacity_);
+  }
+  const_iterator begin() const {
+    return iterator(ctrl_, ctrl_ + capacity_, slots_);
+  }
+  const_iterator end() const {
+    return iterator(ctrl_ + capacity_, ctrl_ + capacity_, slots_ + capacity_);
+  }
+  iterator iteratorAt(size_type pos) {
+    if (pos == npos) return end();
+    return iterator(ctrl_ + pos, ctrl_ + capacity_, slots_ + pos);
+  }
+  value_type &at_slot(size_type pos) { return slots_[pos]; }
+
+  size_type size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  size_type capacity() const { return capacity_; }
+  size_type max_size() const {
+    return size_type(-1) / (sizeof(value_type) + 1) / 2;
+  }
+  float load_factor() const {
+    return capacity_ ? float(size_) / float(capacity_) : 0.0f;
+  }
+  float max_load_factor() const { return maxLoad_; }
+
+  // Values above 15/16 are clamped so that every probe run ends in an empty
+  // slot well before it covers the whole table.
+  void max_load_factor(float ml) {
+    if (ml > kMaxLoadLimit) ml = kMaxLoadLimit;
+    if (ml < 0.125f) ml = 0.125f;
+    maxLoad_ = ml;
+    if (capacity_ && float(size_) > float(capacity_) * maxLoad_) {
+      resize(capacityFor(size_));
+    }
+  }
+
+  // Makes room for n values without further growth.
+  void reserve(size_type n) {
+    if (n > size_) growFor(n);
+  }
+
+  // Rebuilds the table with room for at least n values, or with the
+  // smallest capacity that fits the current values when n is smaller.
+  void rehash(size_type n) {
+    size_type capacity = capacityFor(n > size_ ? n : size_);
+    if (size_ == 0 && n == 0) {
+      release();
+    } else if (capacity != capacity_) {
+      resize(capacity);
+    }
+  }
+
+  // Grows once for a range whose length is known up front; ranges of input
+  // iterators grow as they are consumed.
+  template <typename InputIt>
+  void reserve_range(InputIt first, InputIt last) {
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+      reserve(size_ + size_type(std::distance(first, last)));
+    }
+  }
+
+  void clear() {
+    for (size_type i = 0; i < capacity_; i++) {
+      if (ctrl_[i] != kEmptyCtrl) slots_[i].~value_type();
+    }
+    if (capacity_) {
+      std::memset(ctrl_, kEmptyCtrl, capacity_ + kHashGroupWidth - 1);
+    }
+    size_ = 0;
+  }
+
+  size_type find(const key_type &key) const {
+    if (size_ == 0) return npos;
+    std::uint64_t hash = hashOf(key);
+    hash_ctrl_t tag = h2(hash);
+    size_type pos = h1(hash) & mask();
+    for (;;) {
+      hash_group group(ctrl_ + pos);
+      for (std::uint32_t match = group.match(tag); match; match &= match - 1) {
+        size_type i = (pos + __builtin_ctz(match)) & mask();
+        if (eq_(keyOf(slots_[i]), key)) return i;
+      }
+      if (group.match_empty()) return npos;
+      pos = (pos + kHashGroupWidth) & mask();
+    }
+  }
+
+  // Counts the values equal to key; they all lie on key's probe run.
+  size_type count(const key_type &key) const {
+    if (size_ == 0) return 0;
+    std::uint64_t hash = hashOf(key);
+    hash_ctrl_t tag = h2(hash);
+    size_type res = 0;
+    for (size_type i = h1(hash) & mask(); ctrl_[i] != kEmptyCtrl;
+         i = (i + 1) & mask()) {
+      if (ctrl_[i] == tag && eq_(keyOf(slots_[i]), key)) res++;
+    }
+    return res;
+  }
+
+  // Calls make(place) to construct a value with key in raw storage unless
+  // key is already present. Returns the slot and whether it was inserted.
+  // If the table has to grow, the value is built aside first, since key
+  // and whatever make reads may refer into the table.
+  template <typename Make>
+  std::pair<size_type, bool> insert_unique(const key_type &key, Make &&make) {
+    size_type pos = find(key);
+    if (pos != npos) return {pos, false};
+    std::uint64_t hash = hashOf(key);
+    if (!needsGrowth(size_ + 1)) return {placeNew(hash, make), true};
+    alignas(value_type) unsigned char buffer[sizeof(value_type)];
+    value_type *value = reinterpret_cast<value_type *>(buffer);
+    make(value);
+    try {
+      growFor(size_ + 1);
+      pos = placeNew(hash, [value](value_type *place) {
+        new (place) value_type(std::move(*value));
+      });
+    } catch (...) {
+      value->~value_type();
+      throw;
+    }
+    value->~value_type();
+    return {pos, true};
+  }
+
+  // Inserts value even if an equal key is already present. The value is
+  // built before the table grows, since args may refer into the table.
+  template <typename... Args>
+  size_type insert_multi(Args &&...args) {
+    value_type value(std::forward<Args>(args)...);
+    growFor(size_ + 1);
+    return placeNew(hashOf(keyOf(value)), [&value](value_type *place) {
+      new (place) value_type(std::move(value));
+    });
+  }
+
+  // Removes the value in slot pos and shifts the rest of its probe run back
+  // over the hole, so that no tombstone is left behind.
+  void erase_at(size_type pos) {
+    slots_[pos].~value_type();
+    size_type hole = pos;
+    for (size_type i = (pos + 1) & mask(); ctrl_[i] != kEmptyCtrl;
+         i = (i + 1) & mask()) {
+      size_type home = h1(hashOf(keyOf(slots_[i]))) & mask();
+      bool reachable = hole <= i ? (hole < home && home <= i)
+                                 : (hole < home || home <= i);
+      if (reachable) continue;
+      new (slots_ + hole) value_type(std::move(slots_[i]));
+      slots_[i].~value_type();
+      setCtrl(hole, ctrl_[i]);
+      hole = i;
+    }
+    setCtrl(hole, kEmptyCtrl);
+    size_--;
+  }
+
+  void erase(const_iterator pos) { erase_at(size_type(pos.slot_ - slots_)); }
+
+  // Removes every value equal to key and returns how many there were.
+  size_type erase_key(const key_type &key) {
+    size_type res = 0;
+    for (size_type pos = find(key); pos != npos; pos = find(key)) {
+      erase_at(pos);
+      res++;
+    }
+    return res;
+  }
+
+  void swap(flat_hash_table &other) noexcept {
+    std::swap(ctrl_, other.ctrl_);
+    std::swap(slots_, other.slots_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(size_, other.size_);
+    std::swap(maxLoad_, other.maxLoad_);
+    std::swap(hash_, other.hash_);
+    std::swap(eq_, other.eq_);
+  }
+};
+
+// A table without slots points ctrl_ here, so lookups need no special case
+// for capacity 0 beyond the size check.
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+hash_ctrl_t flat_hash_table<Value, Key, KeyOf, Hash,
+                            KeyEqual>::emptyGroup[kHashGroupWidth] = {
+    kEmptyCtrl, kEmptyCtrl, kEmptyCtrl, kEmptyCtrl, kEmptyCtrl, kEmptyCtrl,
+    kEmptyCtrl, kEmptyCtrl, kEmptyCtrl, kEmptyCtrl, kEmptyCtrl, kEmptyCtrl,
+    kEmptyCtrl, kEmptyCtrl, kEmptyCtrl, kEmptyCtrl};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_FLAT_HASH_TABLE
@@ -0,0 +1,151 @@
+#ifndef CPP2_S21_CONTAINERS_NODE_POOL
+#define CPP2_S21_CONTAINERS_NODE_POOL
+
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace s21 {
+
+// Single-threaded allocator for the nodes of one node-based container.
+//
+// Nodes are carved out of blocks of about 4 KiB, so allocating a node is a
+// pointer bump or a free-list pop instead of a call into the global heap, and
+// nodes allocated together sit next to each other in memory. Destroyed nodes
+// go to a free list and are reused before the current block is touched.
+// Blocks are returned to the system only when the pool is destroyed. merge
+// adopts another pool's blocks in O(1), so nodes can move between containers
+// without being copied.
+template <typename T>
+class node_pool {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+
+ private:
+  union Slot {
+    Slot *next_;
+    alignas(T) unsigned char storage_[sizeof(T)];
+  };
+
+  struct Block {
+    Block *next_;
+  };
+
+  static constexpr size_type kBlockBytes = 4096;
+  static constexpr size_type kHeaderSlots =
+      (sizeof(Block) + sizeof(Slot) - 1) / sizeof(Slot);
+  static constexpr size_type kSlotsPerBlock =
+      kBlockBytes / sizeof(Slot) > kHeaderSlots + 8
+          ? kBlockBytes / sizeof(Slot) - kHeaderSlots
+          : 8;
+
+  Block *blocks_;
+  Block *lastBlock_;
+  Slot *free_;
+  Slot *lastFree_;
+  Slot *cursor_;
+  Slot *end_;
+
+  void addBlock() {
+    Slot *slots = static_cast<Slot *>(
+        ::operator new(sizeof(Slot) * (kHeaderSlots + kSlotsPerBlock)));
+    Block *block = reinterpret_cast<Block *>(slots);
+    block->next_ = blocks_;
+    blocks_ = block;
+    if (lastBlock_ == nullptr) lastBlock_ = block;
+    cursor_ = slots + kHeaderSlots;
+    end_ = cursor_ + kSlotsPerBlock;
+  }
+
+  Slot *takeSlot() {
+    if (free_ != nullptr) {
+      Slot *slot = free_;
+      free_ = slot->next_;
+      if (free_ == nullptr) lastFree_ = nullptr;
+      return slot;
+    }
+    if (cursor_ == end_) addBlock();
+    return cursor_++;
+  }
+
+ public:
+  node_pool()
+      : blocks_(nullptr),
+        lastBlock_(nullptr),
+        free_(nullptr),
+        lastFree_(nullptr),
+        cursor_(nullptr),
+        end_(nullptr) {}
+  node_pool(const node_pool &) = delete;
+  node_pool(node_pool &&other) noexcept : node_pool() { swap(other); }
+  node_pool &operator=(const node_pool &) = delete;
+  node_pool &operator=(node_pool &&other) noexcept {
+    if (this != &other) {
+      node_pool tmp(std::move(other));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  // Releases the memory of every block. Nodes that are still alive are not
+  // destroyed; the owning container must destroy them first.
+  ~node_pool() {
+    while (blocks_ != nullptr) {
+      Block *next = blocks_->next_;
+      ::operator delete(blocks_);
+      blocks_ = next;
+    }
+  }
+
+  template <typename... Args>
+  T *create(Args &&...args) {
+    Slot *slot = takeSlot();
+    try {
+      return new (slot->storage_) T(std::forward<Args>(args)...);
+    } catch (...) {
+      slot->next_ = free_;
+      free_ = slot;
+      if (lastFree_ == nullptr) lastFree_ = slot;
+      throw;
+    }
+  }
+
+  void destroy(T *node) {
+    node->~T();
+    Slot *slot = reinterpret_cast<Slot *>(node);
+    slot->next_ = free_;
+    free_ = slot;
+    if (lastFree_ == nullptr) lastFree_ = slot;
+  }
+
+  // Takes over the blocks and free nodes of other, which becomes empty. The
+  // unused tail of other's current block is given up until destruction.
+  void merge(node_pool &other) {
+    if (this == &other || other.blocks_ == nullptr) return;
+    other.lastBlock_->next_ = blocks_;
+    blocks_ = other.blocks_;
+    if (lastBlock_ == nullptr) lastBlock_ = other.lastBlock_;
+    if (other.free_ != nullptr) {
+      other.lastFree_->next_ = free_;
+      if (free_ == nullptr) lastFree_ = other.lastFree_;
+      free_ = other.free_;
+    }
+    other.blocks_ = other.lastBlock_ = nullptr;
+    other.free_ = other.lastFree_ = nullptr;
+    other.cursor_ = other.end_ = nullptr;
+  }
+
+  void swap(node_pool &other) noexcept {
+    std::swap(blocks_, other.blocks_);
+    std::swap(lastBlock_, other.lastBlock_);
+    std::swap(free_, other.free_);
+    std::swap(lastFree_, other.lastFree_);
+    std::swap(cursor_, other.cursor_);
+    std::swap(end_, other.end_);
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_NODE_POOL
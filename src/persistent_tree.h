@@ -0,0 +1,389 @@
+#ifndef CPP2_S21_CONTAINERS_PERSISTENT_TREE
+#define CPP2_S21_CONTAINERS_PERSISTENT_TREE
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <utility>
+
+namespace s21 {
+
+// AVL tree whose nodes are shared between versions. Every node counts the
+// parents and handles that point to it; a node with a count of one is
+// reachable only through the path that led to it, so it is edited in place,
+// and any other node on the way down is copied first. Copying a tree is
+// therefore O(1), and editing a copy copies only the O(log n) nodes on the
+// edited path while every untouched subtree stays shared with the original.
+//
+// Shared nodes are never written, so different threads may read, copy and
+// edit trees that share nodes; one tree object itself is not synchronized.
+template <typename Value, typename Key, typename KeyOf, typename Compare>
+class persistent_tree {
+ public:
+  using value_type = Value;
+  using key_type = Key;
+  using size_type = std::size_t;
+
+ private:
+  struct Node {
+    std::atomic<size_type> refs_;
+    Node *left_;
+    Node *right_;
+    int height_;
+    value_type value_;
+
+    template <typename... Args>
+    Node(Node *left, Node *right, int height, Args &&...args)
+        : refs_(1),
+          left_(left),
+          right_(right),
+          height_(height),
+          value_(std::forward<Args>(args)...) {}
+  };
+
+  Node *root_;
+  size_type size_;
+  Compare comp_;
+
+  // Enough for any AVL tree that fits in memory: its height is below
+  // 1.45 * log2(size + 2).
+  static constexpr int kMaxDepth = 96;
+
+  static const key_type &keyOf(const Node *node) {
+    return KeyOf()(node->value_);
+  }
+  static int height(const Node *node) { return node ? node->height_ : 0; }
+  static int balance(const Node *node) {
+    return height(node->left_) - height(node->right_);
+  }
+  static void updateHeight(Node *node) {
+    int left = height(node->left_);
+    int right = height(node->right_);
+    node->height_ = (left > right ? left : right) + 1;
+  }
+
+  static Node *retain(Node *node) {
+    if (node) node->refs_.fetch_add(1, std::memory_order_relaxed);
+    return node;
+  }
+  // Drops one reference; the last one frees the node and releases its
+  // children in turn.
+  static void release(Node *node) {
+    while (node && node->refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      Node *right = node->right_;
+      release(node->left_);
+      delete node;
+      node = right;
+    }
+  }
+
+  // Makes the node in slot safe to edit, copying it if it is shared. A
+  // failed copy leaves slot as it was.
+  static void makeUnique(Node *&slot) {
+    if (slot->refs_.load(std::memory_order_acquire) == 1) return;
+    Node *copy = new Node(slot->left_, slot->right_, slot->height_,
+                          slot->value_);
+    retain(copy->left_);
+    retain(copy->right_);
+    release(slot);
+    slot = copy;
+  }
+
+  // The rotations and rebalance expect slot to be unique already.
+  static void rotateRight(Node *&slot) {
+    makeUnique(slot->left_);
+    Node *node = slot;
+    Node *left = node->left_;
+    node->left_ = left->right_;
+    left->right_ = node;
+    updateHeight(node);
+    updateHeight(left);
+    slot = left;
+  }
+  static void rotateLeft(Node *&slot) {
+    makeUnique(slot->right_);
+    Node *node = slot;
+    Node *right = node->right_;
+    node->right_ = right->left_;
+    right->left_ = node;
+    updateHeight(node);
+    updateHeight(right);
+    slot = right;
+  }
+  static void rebalance(Node *&slot) {
+    updateHeight(slot);
+    int factor = balance(slot);
+    if (factor > 1) {
+      if (balance(slot->left_) < 0) {
+        makeUnique(slot->left_);
+        rotateLeft(slot->left_);
+      }
+      rotateRight(slot);
+    } else if (factor < -1) {
+      if (balance(slot->right_) > 0) {
+        makeUnique(slot->right_);
+        rotateRight(slot->right_);
+      }
+      rotateLeft(slot);
+    }
+  }
+
+  template <typename Make>
+  void insertAt(Node *&slot, const key_type &key, Make &make) {
+    if (slot == nullptr) {
+      slot = make();
+      return;
+    }
+    makeUnique(slot);
+    if (comp_(key, keyOf(slot))) {
+      insertAt(slot->left_, key, make);
+    } else {
+      insertAt(slot->right_, key, make);
+    }
+    rebalance(slot);
+  }
+
+  // Unlinks the smallest node of a non-empty subtree and returns it, unique
+  // and with no children.
+  static Node *removeMin(Node *&slot) {
+    makeUnique(slot);
+    if (slot->left_ == nullptr) {
+      Node *node = slot;
+      slot = node->right_;
+      node->right_ = nullptr;
+      return node;
+    }
+    Node *node = removeMin(slot->left_);
+    rebalance(slot);
+    return node;
+  }
+
+  // Expects key to be present below slot.
+  void eraseAt(Node *&slot, const key_type &key) {
+    makeUnique(slot);
+    if (comp_(key, keyOf(slot))) {
+      eraseAt(slot->left_, key);
+    } else if (comp_(keyOf(slot), key)) {
+      eraseAt(slot->right_, key);
+    } else {
+      Node *node = slot;
+      if (node->left_ == nullptr || node->right_ == nullptr) {
+        // The only child takes the node's place unchanged. It is balanced
+        // already and may be shared, so it is not rebalanced.
+        slot = node->left_ ? node->left_ : node->right_;
+        node->left_ = node->right_ = nullptr;
+        release(node);
+        return;
+      }
+      Node *successor = removeMin(node->right_);
+      successor->left_ = node->left_;
+      successor->right_ = node->right_;
+      slot = successor;
+      node->left_ = node->right_ = nullptr;
+      release(node);
+    }
+    rebalance(slot);
+  }
+
+  // One comparison per level, which the compiler can turn into a
+  // conditional move, and an equality check at the end.
+  Node *findNode(const key_type &key) const {
+    Node *candidate = nullptr;
+    for (Node *node = root_; node;) {
+      bool less = comp_(keyOf(node), key);
+      candidate = less ? candidate : node;
+      node = less ? node->right_ : node->left_;
+    }
+    if (candidate == nullptr || comp_(key, keyOf(candidate))) return nullptr;
+    return candidate;
+  }
+
+ public:
+  // In-order walk that keeps the path to the current node, since nodes have
+  // no parent pointers. Valid while the tree it came from is not edited.
+  class PersistentTreeIterator {
+    friend class persistent_tree;
+
+    const Node *stack_[kMaxDepth];
+    int depth_;
+
+    void pushLeft(const Node *node) {
+      for (; node; node = node->left_) stack_[depth_++] = node;
+    }
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Value;
+    using difference_type = std::ptrdiff_t;
+    using reference = const Value &;
+    using pointer = const Value *;
+
+    PersistentTreeIterator() : depth_(0) {}
+
+    reference operator*() const { return stack_[depth_ - 1]->value_; }
+    pointer operator->() const { return &stack_[depth_ - 1]->value_; }
+
+    PersistentTreeIterator &operator++() {
+      const Node *node = stack_[--depth_];
+      pushLeft(node->right_);
+      return *this;
+    }
+    PersistentTreeIterator operator++(int) {
+      PersistentTreeIterator tmp(*this);
+      ++*this;
+      return tmp;
+    }
+
+    bool operator==(const PersistentTreeIterator &other) const {
+      if (depth_ == 0 || other.depth_ == 0) return depth_ == other.depth_;
+      return stack_[depth_ - 1] == other.stack_[other.depth_ - 1];
+    }
+    bool operator!=(const PersistentTreeIterator &other) const {
+      return !(*this == other);
+    }
+  };
+  using iterator = PersistentTreeIterator;
+
+  persistent_tree() : root_(nullptr), size_(0), comp_() {}
+  persistent_tree(const persistent_tree &other)
+      : root_(retain(other.root_)), size_(other.size_), comp_(other.comp_) {}
+  persistent_tree(persistent_tree &&other) noexcept : persistent_tree() {
+    swap(other);
+  }
+  ~persistent_tree() { release(root_); }
+
+  persistent_tree &operator=(const persistent_tree &other) {
+    if (this != &other) {
+      persistent_tree tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+  persistent_tree &operator=(persistent_tree &&other) noexcept {
+    if (this != &other) {
+      persistent_tree tmp(std::move(other));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  void swap(persistent_tree &other) noexcept {
+    std::swap(root_, other.root_);
+    std::swap(size_, other.size_);
+    std::swap(comp_, other.comp_);
+  }
+
+  size_type getSize() const { return size_; }
+  // Whether both trees are the same version, e.g. because no edit in
+  // between changed anything.
+  bool sameRoot(const persistent_tree &other) const {
+    return root_ == other.root_;
+  }
+
+  void clear() {
+    release(root_);
+    root_ = nullptr;
+    size_ = 0;
+  }
+
+  iterator begin() const {
+    iterator res;
+    res.pushLeft(root_);
+    return res;
+  }
+  iterator end() const { return iterator(); }
+
+  // Walks down once, keeping on the stack only the nodes that are still
+  // ahead of the result in key order.
+  iterator lowerBound(const key_type &key) const {
+    iterator res;
+    for (const Node *node = root_; node;) {
+      if (comp_(keyOf(node), key)) {
+        node = node->right_;
+      } else {
+        res.stack_[res.depth_++] = node;
+        node = node->left_;
+      }
+    }
+    return res;
+  }
+  iterator upperBound(const key_type &key) const {
+    iterator res;
+    for (const Node *node = root_; node;) {
+      if (comp_(key, keyOf(node))) {
+        res.stack_[res.depth_++] = node;
+        node = node->left_;
+      } else {
+        node = node->right_;
+      }
+    }
+    return res;
+  }
+  iterator find(const key_type &key) const {
+    iterator res = lowerBound(key);
+    if (res != end() && comp_(key, keyOf(res.stack_[res.depth_ - 1]))) {
+      return end();
+    }
+    return res;
+  }
+  const value_type *findValue(const key_type &key) const {
+    const Node *node = findNode(key);
+    return node ? &node->value_ : nullptr;
+  }
+
+  // Inserts a value built from args unless key is present. Returns whether
+  // it was inserted; a present key leaves the tree untouched and shared.
+  template <typename... Args>
+  bool insertUnique(const key_type &key, Args &&...args) {
+    if (findNode(key) != nullptr) return false;
+    auto make = [&] {
+      return new Node(nullptr, nullptr, 1, std::forward<Args>(args)...);
+    };
+    insertAt(root_, key, make);
+    size_++;
+    return true;
+  }
+
+  // Replaces the value of key with one built from args, or inserts it.
+  // Returns whether key was new.
+  template <typename... Args>
+  bool assign(const key_type &key, Args &&...args) {
+    if (findNode(key) == nullptr) {
+      return insertUnique(key, std::forward<Args>(args)...);
+    }
+    Node **slot = &root_;
+    for (;;) {
+      makeUnique(*slot);
+      if (comp_(key, keyOf(*slot))) {
+        slot = &(*slot)->left_;
+      } else if (comp_(keyOf(*slot), key)) {
+        slot = &(*slot)->right_;
+      } else {
+        break;
+      }
+    }
+    // Built only now: args may refer to the old value, which the path
+    // copies above keep alive until it is released below.
+    Node *fresh = new Node(nullptr, nullptr, 1, std::forward<Args>(args)...);
+    Node *old = *slot;
+    fresh->left_ = old->left_;
+    fresh->right_ = old->right_;
+    fresh->height_ = old->height_;
+    old->left_ = old->right_ = nullptr;
+    release(old);
+    *slot = fresh;
+    return false;
+  }
+
+  size_type erase(const key_type &key) {
+    if (findNode(key) == nullptr) return 0;
+    eraseAt(root_, key);
+    size_--;
+    return 1;
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_PERSISTENT_TREE
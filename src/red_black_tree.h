@@ -1,6 +1,11 @@
 #ifndef CPP2_S21_CONTAINERS_BINARY_TREE
 #define CPP2_S21_CONTAINERS_BINARY_TREE
 
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <utility>
+
 namespace s21 {
 
 enum node_colors { RED, BLACK };
@@ -293,13 +298,13 @@ class RBTree {
     }
   }
 
-  Node<K, V> *copyTree(Node<K, V> *node) {
+  Node<K, V> *copyTree(Node<K, V> *node, Node<K, V> *parent = nullptr) {
     if (node == nullptr) {
       return nullptr;
     }
-    Node<K, V> *newNode = new Node<K, V>(node, node->parent);
-    newNode->left = copyTree(node->left);
-    newNode->right = copyTree(node->right);
+    Node<K, V> *newNode = new Node<K, V>(node, parent);
+    newNode->left = copyTree(node->left, newNode);
+    newNode->right = copyTree(node->right, newNode);
     return newNode;
   }
 
@@ -370,7 +375,9 @@ class RBTree {
       if (node->left && node->right) {
         delNode = maximum(node->left);
         Node<K, V> *tmp = new Node<K, V>{delNode, node->key, node->value};
-        new Node<K, V>{node, delNode->key, delNode->value};
+        Node<K, V> *replacement =
+            new Node<K, V>{node, delNode->key, delNode->value};
+        if (root == node) root = replacement;
         delete delNode;
         delete node;
         delNode = tmp;
@@ -388,7 +395,9 @@ class RBTree {
       if (node->left && node->right) {
         delNode = maximum(node->left);
         Node<K, V> *tmp = new Node<K, V>{delNode, node->key, node->value};
-        new Node<K, V>{node, delNode->key, delNode->value};
+        Node<K, V> *replacement =
+            new Node<K, V>{node, delNode->key, delNode->value};
+        if (root == node) root = replacement;
         delete delNode;
         delete node;
         delNode = tmp;
@@ -430,6 +439,74 @@ class RBTree {
     return res;
   }
 
+  // The interface map, set and multiset use, shared with BPlusTree.
+  iterator begin() { return iterator(minimum(root), *this); }
+  iterator end() { return iterator(nullptr, *this); }
+
+  iterator find(const K &key) { return iterator(search(key), *this); }
+
+  // First node whose key is not less than key.
+  iterator lowerBound(const K &key) {
+    Node<K, V> *res = nullptr;
+    for (Node<K, V> *x = root; x != nullptr;) {
+      if (x->key < key) {
+        x = x->right;
+      } else {
+        res = x;
+        x = x->left;
+      }
+    }
+    return iterator(res, *this);
+  }
+
+  // First node whose key is greater than key.
+  iterator upperBound(const K &key) {
+    Node<K, V> *res = nullptr;
+    for (Node<K, V> *x = root; x != nullptr;) {
+      if (key < x->key) {
+        res = x;
+        x = x->left;
+      } else {
+        x = x->right;
+      }
+    }
+    return iterator(res, *this);
+  }
+
+  std::size_t count(const K &key) {
+    std::size_t res = 0;
+    for (iterator it = lowerBound(key);
+         it.current != nullptr && !(key < it.current->key); ++it) {
+      res++;
+    }
+    return res;
+  }
+
+  std::pair<iterator, bool> insertUnique(const K &key, const V &value) {
+    Node<K, V> *node = search(key);
+    if (node != nullptr) return {iterator(node, *this), false};
+    return {iterator(insert(key, value), *this), true};
+  }
+
+  iterator insertMulti(const K &key, const V &value) {
+    return iterator(insert(key, value), *this);
+  }
+
+  void erase(iterator pos) {
+    if (pos.current != nullptr) removeByNode(pos.current);
+  }
+
+  void clear() {
+    freeTree(root);
+    root = nullptr;
+    size = 0;
+  }
+
+  void swap(RBTree &other) {
+    std::swap(root, other.root);
+    std::swap(size, other.size);
+  }
+
   int count_elements_equal_to_key(Node<K, V> *root, int key) {
     if (root == nullptr) return 0;
     int count = 0;
@@ -509,7 +586,7 @@ class RBTreeIterator {
 
   RBTree<K, V> &tree;
   Node<K, V> *current;
-  RBTreeIterator(Node<K, V> *node, RBTree<K, V> tree)
+  RBTreeIterator(Node<K, V> *node, RBTree<K, V> &tree)
       : tree{tree}, current{node} {};
   RBTreeIterator(const RBTreeIterator &other)
       : tree{other.tree}, current{other.current} {};
@@ -538,8 +615,12 @@ class RBTreeIterator {
     return *this;
   }
 
+  // Decrementing end() steps to the greatest element of the tree as it is
+  // now, not as it was when the iterator was made.
   RBTreeIterator &operator--() {
-    if (current != nullptr) {
+    if (current == nullptr) {
+      current = tree.maximum(tree.root);
+    } else {
       if (current->left == nullptr) {
         Node<K, V> *tmp = nullptr;
         while ((tmp = current->parent) != nullptr && (current == tmp->left)) {
@@ -0,0 +1,550 @@
+#ifndef CPP2_S21_CONTAINERS_ROARING_CONTAINER
+#define CPP2_S21_CONTAINERS_ROARING_CONTAINER
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+#include "s21_vector.h"
+#include "sorted_columns.h"
+
+#if defined(__SSE2__) && !defined(S21_NO_SIMD)
+#include <emmintrin.h>
+#endif
+
+namespace s21 {
+
+enum class roaring_op { unite, intersect, subtract };
+
+// The low 16 bits of the values of a roaring_set that share their high 16
+// bits, in whichever of three layouts is smallest for them:
+//
+//  - kArray: the sorted values, 2 bytes each, for at most 4096 values;
+//  - kBitmap: one bit per possible value, 8 KiB, for more than 4096;
+//  - kRun: sorted (start, length - 1) pairs, 4 bytes per run of
+//    consecutive values, chosen by runOptimize() for clustered values.
+//
+// insert and erase keep arrays and bitmaps on the right side of 4096 and
+// leave a run layout as soon as it stops being the smallest, so the layout
+// never costs more than 8 KiB plus a little.
+class roaring_container {
+ public:
+  using size_type = std::size_t;
+  enum Kind : std::uint8_t { kArray, kBitmap, kRun };
+  static constexpr size_type kArrayMax = 4096;
+  static constexpr size_type kBitmapWords = 1024;
+  static constexpr std::uint32_t kNone = 1u << 16;
+
+  // Position of one value during iteration. pos_ indexes the array or the
+  // run; bitmaps only use value_.
+  struct Cursor {
+    std::uint32_t pos_;
+    std::uint32_t value_;
+  };
+
+ private:
+  Kind kind_;
+  std::uint32_t card_;
+  // Sorted values of an array, or start and length - 1 of each run.
+  vector<std::uint16_t> values_;
+  vector<std::uint64_t> words_;
+
+  size_type runCount() const { return values_.size() / 2; }
+  std::uint32_t runStart(size_type i) const { return values_[2 * i]; }
+  std::uint32_t runEnd(size_type i) const {
+    return std::uint32_t(values_[2 * i]) + values_[2 * i + 1];
+  }
+
+  size_type arrayIndex(std::uint16_t value) const {
+    return sorted_lower_bound(values_.data(), values_.size(), value,
+                              std::less<std::uint16_t>());
+  }
+  // Index of the last run that starts at or before value, or runCount() if
+  // every run starts after it.
+  size_type runIndex(std::uint16_t value) const {
+    size_type lo = 0;
+    size_type hi = runCount();
+    while (lo < hi) {
+      size_type mid = (lo + hi) / 2;
+      if (runStart(mid) <= value) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    return lo == 0 ? runCount() : lo - 1;
+  }
+
+  bool testBit(std::uint32_t value) const {
+    return (words_[value >> 6] >> (value & 63)) & 1;
+  }
+  // First set bit at or after from, or kNone.
+  std::uint32_t nextBit(std::uint32_t from) const {
+    if (from >= kNone) return kNone;
+    size_type w = from >> 6;
+    std::uint64_t bits = words_[w] & (~std::uint64_t(0) << (from & 63));
+    while (bits == 0) {
+      if (++w == kBitmapWords) return kNone;
+      bits = words_[w];
+    }
+    return std::uint32_t(w * 64 + __builtin_ctzll(bits));
+  }
+
+  // Number of runs of consecutive values, whatever the layout.
+  size_type countRuns() const {
+    if (kind_ == kRun) return runCount();
+    size_type res = 0;
+    if (kind_ == kArray) {
+      for (size_type i = 0; i < values_.size(); i++) {
+        res += i == 0 || values_[i] != values_[i - 1] + 1;
+      }
+      return res;
+    }
+    std::uint64_t carry = 0;
+    for (size_type w = 0; w < kBitmapWords; w++) {
+      res += __builtin_popcountll(words_[w] & ~((words_[w] << 1) | carry));
+      carry = words_[w] >> 63;
+    }
+    return res;
+  }
+
+  void becomeArray() {
+    vector<std::uint16_t> values;
+    values.reserve(card_);
+    Cursor c;
+    for (bool ok = first(c); ok; ok = next(c)) {
+      values.push_back(std::uint16_t(c.value_));
+    }
+    values_.swap(values);
+    vector<std::uint64_t>().swap(words_);
+    kind_ = kArray;
+  }
+  void becomeBitmap() {
+    vector<std::uint64_t> words(kBitmapWords);
+    Cursor c;
+    for (bool ok = first(c); ok; ok = next(c)) {
+      words[c.value_ >> 6] |= std::uint64_t(1) << (c.value_ & 63);
+    }
+    words_.swap(words);
+    vector<std::uint16_t>().swap(values_);
+    kind_ = kBitmap;
+  }
+  void becomeRuns(size_type runs) {
+    vector<std::uint16_t> values;
+    values.reserve(2 * runs);
+    Cursor c;
+    for (bool ok = first(c); ok; ok = next(c)) {
+      if (!values.empty() &&
+          std::uint32_t(values[values.size() - 2]) + values.back() + 1 ==
+              c.value_) {
+        values.back()++;
+      } else {
+        values.push_back(std::uint16_t(c.value_));
+        values.push_back(0);
+      }
+    }
+    values_.swap(values);
+    vector<std::uint64_t>().swap(words_);
+    kind_ = kRun;
+  }
+  // Leaves the run layout once an edit makes it larger than the array or
+  // the bitmap would be.
+  void leaveRunsIfLarger() {
+    if (4 * runCount() <= std::min<size_type>(2 * card_, 8192)) return;
+    if (card_ <= kArrayMax) {
+      becomeArray();
+    } else {
+      becomeBitmap();
+    }
+  }
+  // Moves an array or a bitmap to the other side of kArrayMax if needed.
+  void normalize() {
+    if (kind_ == kArray && card_ > kArrayMax) becomeBitmap();
+    if (kind_ == kBitmap && card_ <= kArrayMax) becomeArray();
+  }
+
+  bool insertRun(std::uint16_t value) {
+    size_type i = runIndex(value);
+    size_type n = runCount();
+    if (i != n && value <= runEnd(i)) return false;
+    size_type after = i == n ? 0 : i + 1;
+    bool joins_prev = i != n && runEnd(i) + 1 == value;
+    bool joins_next = after < n && std::uint32_t(value) + 1 == runStart(after);
+    if (joins_prev && joins_next) {
+      values_[2 * i + 1] = std::uint16_t(runEnd(after) - runStart(i));
+      column_erase(values_, 2 * after);
+      column_erase(values_, 2 * after);
+    } else if (joins_prev) {
+      values_[2 * i + 1]++;
+    } else if (joins_next) {
+      values_[2 * after]--;
+      values_[2 * after + 1]++;
+    } else {
+      column_insert(values_, 2 * after, std::uint16_t(0));
+      column_insert(values_, 2 * after, value);
+    }
+    card_++;
+    leaveRunsIfLarger();
+    return true;
+  }
+  bool eraseRun(std::uint16_t value) {
+    size_type i = runIndex(value);
+    if (i == runCount() || value > runEnd(i)) return false;
+    std::uint32_t start = runStart(i);
+    std::uint32_t end = runEnd(i);
+    if (start == end) {
+      column_erase(values_, 2 * i);
+      column_erase(values_, 2 * i);
+    } else if (value == start) {
+      values_[2 * i]++;
+      values_[2 * i + 1]--;
+    } else if (value == end) {
+      values_[2 * i + 1]--;
+    } else {
+      values_[2 * i + 1] = std::uint16_t(value - start - 1);
+      column_insert(values_, 2 * i + 2, std::uint16_t(end - value - 1));
+      column_insert(values_, 2 * i + 2, std::uint16_t(value + 1));
+    }
+    card_--;
+    if (card_ != 0) leaveRunsIfLarger();
+    return true;
+  }
+
+  // Copy of c as an array or a bitmap, for the set algebra, which does not
+  // work on runs.
+  static roaring_container expanded(const roaring_container &c) {
+    roaring_container res(c);
+    if (c.card_ <= kArrayMax) {
+      res.becomeArray();
+    } else {
+      res.becomeBitmap();
+    }
+    return res;
+  }
+
+#if defined(__SSE2__) && !defined(S21_NO_SIMD)
+  // Rotates the eight 16-bit lanes of v down by Lanes.
+  template <int Lanes>
+  static __m128i rotateLanes(__m128i v) {
+    return _mm_or_si128(_mm_srli_si128(v, 2 * Lanes),
+                        _mm_slli_si128(v, 16 - 2 * Lanes));
+  }
+  // Bit k is set when lane k of a equals any lane of b: eight compares of a
+  // against every rotation of b, packed to one bit per lane.
+  static unsigned matchAnyLane(__m128i a, __m128i b) {
+    __m128i hit = _mm_cmpeq_epi16(a, b);
+    hit = _mm_or_si128(hit, _mm_cmpeq_epi16(a, rotateLanes<1>(b)));
+    hit = _mm_or_si128(hit, _mm_cmpeq_epi16(a, rotateLanes<2>(b)));
+    hit = _mm_or_si128(hit, _mm_cmpeq_epi16(a, rotateLanes<3>(b)));
+    hit = _mm_or_si128(hit, _mm_cmpeq_epi16(a, rotateLanes<4>(b)));
+    hit = _mm_or_si128(hit, _mm_cmpeq_epi16(a, rotateLanes<5>(b)));
+    hit = _mm_or_si128(hit, _mm_cmpeq_epi16(a, rotateLanes<6>(b)));
+    hit = _mm_or_si128(hit, _mm_cmpeq_epi16(a, rotateLanes<7>(b)));
+    return unsigned(
+        _mm_movemask_epi8(_mm_packs_epi16(hit, _mm_setzero_si128())));
+  }
+#endif
+
+  // Appends to out the values of a that are in b (keep_common) or that are
+  // not. With SSE2 both arrays are walked eight values at a time: a block of
+  // a is matched against a block of b in one step, and whichever block ends
+  // lower is consumed. The matches of a block of a are collected over every
+  // block of b it meets before it is written out.
+  static void mergeArrays(const std::uint16_t *a, size_type na,
+                          const std::uint16_t *b, size_type nb,
+                          bool keep_common, vector<std::uint16_t> &out) {
+    size_type i = 0;
+    size_type j = 0;
+    unsigned matched = 0;
+#if defined(__SSE2__) && !defined(S21_NO_SIMD)
+    while (i + 8 <= na && j + 8 <= nb) {
+      matched |= matchAnyLane(
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i)),
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + j)));
+      std::uint16_t a_max = a[i + 7];
+      std::uint16_t b_max = b[j + 7];
+      if (a_max <= b_max) {
+        for (unsigned k = 0; k < 8; k++) {
+          if (bool((matched >> k) & 1) == keep_common) out.push_back(a[i + k]);
+        }
+        matched = 0;
+        i += 8;
+      }
+      if (b_max <= a_max) j += 8;
+    }
+#endif
+    // The first values left may have matched earlier blocks of b already.
+    for (size_type block = i; i < na; i++) {
+      bool hit = i - block < 8 && ((matched >> (i - block)) & 1);
+      if (!hit) {
+        while (j < nb && b[j] < a[i]) j++;
+        hit = j < nb && b[j] == a[i];
+      }
+      if (hit == keep_common) out.push_back(a[i]);
+    }
+  }
+
+  // Combines two bitmaps a word at a time into out and returns the number
+  // of values in the result.
+  template <roaring_op Op>
+  static std::uint32_t combineWords(const std::uint64_t *a,
+                                    const std::uint64_t *b,
+                                    std::uint64_t *out) {
+    size_type w = 0;
+#if defined(__SSE2__) && !defined(S21_NO_SIMD)
+    for (; w < kBitmapWords; w += 2) {
+      __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + w));
+      __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + w));
+      __m128i r = Op == roaring_op::unite       ? _mm_or_si128(x, y)
+                  : Op == roaring_op::intersect ? _mm_and_si128(x, y)
+                                                : _mm_andnot_si128(y, x);
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(out + w), r);
+    }
+#endif
+    for (; w < kBitmapWords; w++) {
+      out[w] = Op == roaring_op::unite       ? a[w] | b[w]
+               : Op == roaring_op::intersect ? a[w] & b[w]
+                                             : a[w] & ~b[w];
+    }
+    std::uint32_t card = 0;
+    for (w = 0; w < kBitmapWords; w++) card += __builtin_popcountll(out[w]);
+    return card;
+  }
+
+  static roaring_container combineBitmaps(const roaring_container &a,
+                                          const roaring_container &b,
+                                          roaring_op op) {
+    roaring_container res;
+    res.kind_ = kBitmap;
+    res.words_ = vector<std::uint64_t>(kBitmapWords);
+    const std::uint64_t *x = a.words_.data();
+    const std::uint64_t *y = b.words_.data();
+    std::uint64_t *out = res.words_.data();
+    if (op == roaring_op::unite) {
+      res.card_ = combineWords<roaring_op::unite>(x, y, out);
+    } else if (op == roaring_op::intersect) {
+      res.card_ = combineWords<roaring_op::intersect>(x, y, out);
+    } else {
+      res.card_ = combineWords<roaring_op::subtract>(x, y, out);
+    }
+    res.normalize();
+    return res;
+  }
+
+  static roaring_container uniteArrays(const roaring_container &a,
+                                       const roaring_container &b) {
+    roaring_container res;
+    if (a.card_ + b.card_ > kArrayMax) {
+      res = a;
+      res.becomeBitmap();
+      for (std::uint16_t value : b.values_) res.setBit(value);
+      res.normalize();
+      return res;
+    }
+    res.values_.reserve(a.card_ + b.card_);
+    size_type i = 0;
+    size_type j = 0;
+    while (i < a.values_.size() || j < b.values_.size()) {
+      if (j == b.values_.size() ||
+          (i < a.values_.size() && a.values_[i] < b.values_[j])) {
+        res.values_.push_back(a.values_[i++]);
+      } else {
+        if (i < a.values_.size() && a.values_[i] == b.values_[j]) i++;
+        res.values_.push_back(b.values_[j++]);
+      }
+    }
+    res.card_ = std::uint32_t(res.values_.size());
+    return res;
+  }
+
+  void setBit(std::uint16_t value) {
+    std::uint64_t &word = words_[value >> 6];
+    std::uint64_t bit = std::uint64_t(1) << (value & 63);
+    card_ += (word & bit) == 0;
+    word |= bit;
+  }
+  void clearBit(std::uint16_t value) {
+    std::uint64_t &word = words_[value >> 6];
+    std::uint64_t bit = std::uint64_t(1) << (value & 63);
+    card_ -= (word & bit) != 0;
+    word &= ~bit;
+  }
+
+  // Values of array a filtered by whether bitmap b holds them.
+  static roaring_container filterArray(const roaring_container &a,
+                                       const roaring_container &b,
+                                       bool keep_common) {
+    roaring_container res;
+    for (std::uint16_t value : a.values_) {
+      if (b.testBit(value) == keep_common) res.values_.push_back(value);
+    }
+    res.card_ = std::uint32_t(res.values_.size());
+    return res;
+  }
+
+ public:
+  roaring_container() : kind_(kArray), card_(0), values_(), words_() {}
+
+  Kind kind() const { return kind_; }
+  size_type cardinality() const { return card_; }
+  bool empty() const { return card_ == 0; }
+
+  // Bytes held by this container, including its heap storage.
+  size_type memoryUsage() const {
+    return sizeof(*this) + values_.capacity() * sizeof(std::uint16_t) +
+           words_.capacity() * sizeof(std::uint64_t);
+  }
+
+  bool contains(std::uint16_t value) const {
+    if (kind_ == kArray) {
+      size_type pos = arrayIndex(value);
+      return pos < values_.size() && values_[pos] == value;
+    }
+    if (kind_ == kBitmap) return testBit(value);
+    size_type i = runIndex(value);
+    return i != runCount() && value <= runEnd(i);
+  }
+
+  bool insert(std::uint16_t value) {
+    if (kind_ == kRun) return insertRun(value);
+    if (kind_ == kArray) {
+      size_type pos = arrayIndex(value);
+      if (pos < values_.size() && values_[pos] == value) return false;
+      if (card_ < kArrayMax) {
+        column_insert(values_, pos, value);
+        card_++;
+        return true;
+      }
+      becomeBitmap();
+    }
+    std::uint32_t card = card_;
+    setBit(value);
+    return card_ != card;
+  }
+
+  bool erase(std::uint16_t value) {
+    if (kind_ == kRun) return eraseRun(value);
+    if (kind_ == kArray) {
+      size_type pos = arrayIndex(value);
+      if (pos == values_.size() || values_[pos] != value) return false;
+      column_erase(values_, pos);
+      card_--;
+      return true;
+    }
+    std::uint32_t card = card_;
+    clearBit(value);
+    if (card_ == card) return false;
+    normalize();
+    return true;
+  }
+
+  // Switches to the run layout if it is the smallest, or away from it if
+  // not, and releases spare capacity. Returns whether the layout changed.
+  bool runOptimize() {
+    size_type runs = countRuns();
+    size_type other = card_ <= kArrayMax ? 2 * card_ : 8192;
+    Kind before = kind_;
+    if (4 * runs < other) {
+      if (kind_ != kRun) becomeRuns(runs);
+    } else if (kind_ == kRun) {
+      if (card_ <= kArrayMax) {
+        becomeArray();
+      } else {
+        becomeBitmap();
+      }
+    }
+    values_.shrink_to_fit();
+    return kind_ != before;
+  }
+
+  bool first(Cursor &c) const {
+    c.pos_ = 0;
+    if (card_ == 0) return false;
+    if (kind_ == kBitmap) {
+      c.value_ = nextBit(0);
+    } else {
+      c.value_ = values_[0];
+    }
+    return true;
+  }
+  // Moves c to the next value; returns false after the last one.
+  bool next(Cursor &c) const {
+    if (kind_ == kArray) {
+      if (++c.pos_ == values_.size()) return false;
+      c.value_ = values_[c.pos_];
+    } else if (kind_ == kBitmap) {
+      c.value_ = nextBit(c.value_ + 1);
+      if (c.value_ == kNone) return false;
+    } else if (c.value_ < runEnd(c.pos_)) {
+      c.value_++;
+    } else {
+      if (++c.pos_ == runCount()) return false;
+      c.value_ = runStart(c.pos_);
+    }
+    return true;
+  }
+
+  bool operator==(const roaring_container &other) const {
+    if (card_ != other.card_) return false;
+    if (kind_ == other.kind_) {
+      return values_.size() == other.values_.size() &&
+             std::equal(values_.begin(), values_.end(),
+                        other.values_.begin()) &&
+             std::equal(words_.begin(), words_.end(), other.words_.begin());
+    }
+    Cursor c;
+    Cursor d;
+    bool ok = first(c);
+    for (other.first(d); ok; ok = next(c), other.next(d)) {
+      if (c.value_ != d.value_) return false;
+    }
+    return true;
+  }
+
+  // a op b as a new container; the result may be empty. Runs are expanded
+  // first; the result is an array or a bitmap.
+  static roaring_container combine(const roaring_container &a,
+                                   const roaring_container &b,
+                                   roaring_op op) {
+    if (a.kind_ == kRun || b.kind_ == kRun) {
+      return combine(a.kind_ == kRun ? expanded(a) : a,
+                     b.kind_ == kRun ? expanded(b) : b, op);
+    }
+    if (a.kind_ == kBitmap && b.kind_ == kBitmap) {
+      return combineBitmaps(a, b, op);
+    }
+    if (a.kind_ == kArray && b.kind_ == kArray) {
+      if (op == roaring_op::unite) return uniteArrays(a, b);
+      roaring_container res;
+      mergeArrays(a.values_.data(), a.values_.size(), b.values_.data(),
+                  b.values_.size(), op == roaring_op::intersect, res.values_);
+      res.card_ = std::uint32_t(res.values_.size());
+      return res;
+    }
+    if (op == roaring_op::intersect) {
+      return a.kind_ == kArray ? filterArray(a, b, true)
+                               : filterArray(b, a, true);
+    }
+    if (op == roaring_op::subtract && a.kind_ == kArray) {
+      return filterArray(a, b, false);
+    }
+    // A bitmap with the values of an array set or cleared.
+    roaring_container res(a.kind_ == kBitmap ? a : b);
+    const roaring_container &array = a.kind_ == kBitmap ? b : a;
+    for (std::uint16_t value : array.values_) {
+      if (op == roaring_op::unite) {
+        res.setBit(value);
+      } else {
+        res.clearBit(value);
+      }
+    }
+    res.normalize();
+    return res;
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_ROARING_CONTAINER
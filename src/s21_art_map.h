@@ -0,0 +1,132 @@
+#ifndef S21_ART_MAP_H
+#define S21_ART_MAP_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "adaptive_radix_tree.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Ordered map with the interface of s21::map on an adaptive radix tree (see
+// adaptive_radix_tree.h). A lookup reads one byte of the key per level and
+// compares whole keys only once, at the leaf, so it pays off for integer
+// IDs and for string keys with long shared prefixes such as URL paths.
+//
+// Keys are ordered by their art_key_traits encoding: numerically for
+// integers and bytewise for std::string. Iterators and references stay
+// valid until their entry is erased.
+template <typename Key, typename T, typename Traits = art_key_traits<Key>>
+class art_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+
+ private:
+  struct KeyOf {
+    const key_type &operator()(const value_type &value) const {
+      return value.first;
+    }
+  };
+  using Tree = adaptive_radix_tree<value_type, key_type, KeyOf, Traits>;
+
+  Tree tree_;
+
+ public:
+  using iterator = typename Tree::iterator;
+  using const_iterator = typename Tree::const_iterator;
+
+  art_map() : tree_() {}
+  art_map(std::initializer_list<value_type> const &items) : art_map() {
+    for (const_reference item : items) insert(item);
+  }
+  art_map(const art_map &m) : tree_(m.tree_) {}
+  art_map(art_map &&m) noexcept : tree_(std::move(m.tree_)) {}
+  ~art_map() {}
+
+  art_map &operator=(const art_map &m) {
+    tree_ = m.tree_;
+    return *this;
+  }
+  art_map &operator=(art_map &&m) noexcept {
+    tree_ = std::move(m.tree_);
+    return *this;
+  }
+
+  T &at(const Key &key) {
+    iterator it = tree_.find(key);
+    if (it == tree_.end()) {
+      throw std::out_of_range("This key is not in the map.");
+    }
+    return it->second;
+  }
+  const T &at(const Key &key) const {
+    return const_cast<art_map *>(this)->at(key);
+  }
+  T &operator[](const Key &key) {
+    return tree_.insertUnique(key, key, mapped_type()).first->second;
+  }
+
+  iterator begin() { return tree_.begin(); }
+  iterator end() { return tree_.end(); }
+  const_iterator begin() const { return tree_.begin(); }
+  const_iterator end() const { return tree_.end(); }
+
+  bool empty() const { return tree_.getSize() == 0; }
+  size_type size() const { return tree_.getSize(); }
+  size_type max_size() const {
+    return size_type(-1) / (sizeof(value_type) + 4 * sizeof(void *));
+  }
+
+  void clear() { tree_.clear(); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return tree_.insertUnique(value.first, value);
+  }
+  std::pair<iterator, bool> insert(const Key &key, const T &obj) {
+    return tree_.insertUnique(key, key, obj);
+  }
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj) {
+    std::pair<iterator, bool> res = insert(key, obj);
+    if (!res.second) res.first->second = obj;
+    return res;
+  }
+
+  void erase(iterator pos) {
+    if (pos != end()) tree_.erase(pos);
+  }
+  size_type erase(const Key &key) { return tree_.erase(key); }
+
+  void swap(art_map &other) { tree_.swap(other.tree_); }
+
+  // Inserts every pair of other whose key is not present yet, then empties
+  // other, as s21::map::merge does.
+  void merge(art_map &other) {
+    if (this == &other) return;
+    for (const_reference value : other) insert(value);
+    other.clear();
+  }
+
+  iterator find(const Key &key) { return tree_.find(key); }
+  const_iterator find(const Key &key) const { return tree_.find(key); }
+  bool contains(const Key &key) const { return find(key) != end(); }
+  size_type count(const Key &key) const { return contains(key) ? 1 : 0; }
+  iterator lower_bound(const Key &key) { return tree_.lowerBound(key); }
+  iterator upper_bound(const Key &key) { return tree_.upperBound(key); }
+
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    vector<std::pair<iterator, bool>> res;
+    (res.push_back(insert(std::forward<Args>(args))), ...);
+    return res;
+  }
+};
+}  // namespace s21
+
+#endif
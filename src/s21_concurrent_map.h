@@ -0,0 +1,84 @@
+#ifndef S21_CONCURRENT_MAP_H
+#define S21_CONCURRENT_MAP_H
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+#include "concurrent_skip_list.h"
+
+namespace s21 {
+// Ordered map that any number of threads may use at once, on a lock-free
+// skip list. find, contains and lower_bound never write to shared memory
+// and never wait for other threads; insert and erase are lock-free. Erased
+// nodes are reclaimed through the epoch_domain, so iterators and references
+// stay valid while the iterator they came from is alive, even if the entry
+// is erased meanwhile. Iteration visits keys in ascending order and sees
+// every entry that is present throughout the walk.
+//
+// Entries cannot be changed once inserted: dereferencing an iterator gives
+// a const value_type. Iterators pin their thread and must stay on it.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class concurrent_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+
+ private:
+  struct KeyOf {
+    const key_type &operator()(const value_type &value) const {
+      return value.first;
+    }
+  };
+  using List = concurrent_skip_list<value_type, key_type, KeyOf, key_compare>;
+
+  List list_;
+
+ public:
+  using iterator = typename List::iterator;
+  using const_iterator = typename List::iterator;
+
+  concurrent_map() : list_() {}
+  concurrent_map(std::initializer_list<value_type> const &items)
+      : concurrent_map() {
+    for (const_reference item : items) list_.emplace(item);
+  }
+  concurrent_map(const concurrent_map &) = delete;
+  concurrent_map &operator=(const concurrent_map &) = delete;
+  ~concurrent_map() {}
+
+  iterator begin() const { return list_.begin(); }
+  iterator end() const { return list_.end(); }
+
+  // Snapshots that may be stale by the time they are returned.
+  bool empty() const { return list_.size() == 0; }
+  size_type size() const { return list_.size(); }
+
+  void clear() { list_.clear(); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return list_.emplace(value);
+  }
+  std::pair<iterator, bool> insert(const Key &key, const T &obj) {
+    return list_.emplace(key, obj);
+  }
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return list_.emplace(std::forward<Args>(args)...);
+  }
+
+  size_type erase(const Key &key) { return list_.erase(key); }
+
+  iterator find(const Key &key) const { return list_.find(key); }
+  bool contains(const Key &key) const { return list_.contains(key); }
+  iterator lower_bound(const Key &key) const { return list_.lower_bound(key); }
+};
+}  // namespace s21
+
+#endif
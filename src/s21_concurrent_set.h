@@ -0,0 +1,73 @@
+#ifndef S21_CONCURRENT_SET_H
+#define S21_CONCURRENT_SET_H
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+#include "concurrent_skip_list.h"
+
+namespace s21 {
+// Ordered set that any number of threads may use at once, on the same
+// lock-free skip list as s21::concurrent_map and with the same guarantees.
+template <typename Key, typename Compare = std::less<Key>>
+class concurrent_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+
+ private:
+  struct KeyOf {
+    const key_type &operator()(const value_type &value) const {
+      return value;
+    }
+  };
+  using List = concurrent_skip_list<value_type, key_type, KeyOf, key_compare>;
+
+  List list_;
+
+ public:
+  using iterator = typename List::iterator;
+  using const_iterator = typename List::iterator;
+
+  concurrent_set() : list_() {}
+  concurrent_set(std::initializer_list<value_type> const &items)
+      : concurrent_set() {
+    for (const_reference item : items) list_.emplace(item);
+  }
+  concurrent_set(const concurrent_set &) = delete;
+  concurrent_set &operator=(const concurrent_set &) = delete;
+  ~concurrent_set() {}
+
+  iterator begin() const { return list_.begin(); }
+  iterator end() const { return list_.end(); }
+
+  // Snapshots that may be stale by the time they are returned.
+  bool empty() const { return list_.size() == 0; }
+  size_type size() const { return list_.size(); }
+
+  void clear() { list_.clear(); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return list_.emplace(value);
+  }
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return list_.emplace(std::forward<Args>(args)...);
+  }
+
+  size_type erase(const Key &key) { return list_.erase(key); }
+
+  iterator find(const Key &key) const { return list_.find(key); }
+  bool contains(const Key &key) const { return list_.contains(key); }
+  size_type count(const Key &key) const { return contains(key) ? 1 : 0; }
+  iterator lower_bound(const Key &key) const { return list_.lower_bound(key); }
+};
+}  // namespace s21
+
+#endif
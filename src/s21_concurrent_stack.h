@@ -0,0 +1,136 @@
+#ifndef S21_CONCURRENT_STACK_H
+#define S21_CONCURRENT_STACK_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "concurrency_utils.h"
+#include "epoch_reclamation.h"
+
+namespace s21 {
+// Lock-free LIFO (Treiber stack) for any number of threads.
+//
+// The head is a single 64-bit word that packs the top node pointer with a
+// 16-bit tag bumped by every successful CAS, so a head that was popped and
+// pushed back between a thread's load and its CAS is never mistaken for the
+// one it saw (ABA). Every operation that reads a node runs pinned under an
+// epoch_guard, and popped nodes go to epoch_domain::retire, so a node is freed
+// only after no thread can still be reading it.
+//
+// top and try_pop copy the value out, because another thread may still be
+// reading the same node through top.
+template <typename T>
+class concurrent_stack {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+  static_assert(sizeof(void *) == 8, "tagged pointers need 64-bit pointers");
+
+ private:
+  struct Node {
+    value_type value_;
+    Node *next_;
+    template <typename... Args>
+    explicit Node(Args &&...args) : value_(std::forward<Args>(args)...) {}
+  };
+
+  static constexpr std::uint64_t kPointerMask = (std::uint64_t(1) << 48) - 1;
+
+  alignas(kCacheLineSize) std::atomic<std::uint64_t> head_;
+  alignas(kCacheLineSize) std::atomic<size_type> size_;
+
+  static Node *pointerOf(std::uint64_t head) {
+    return reinterpret_cast<Node *>(head & kPointerMask);
+  }
+
+  // Packs node with the tag of previous plus one.
+  static std::uint64_t tagged(Node *node, std::uint64_t previous) {
+    return reinterpret_cast<std::uint64_t>(node) |
+           ((previous & ~kPointerMask) + (kPointerMask + 1));
+  }
+
+  void pushNode(Node *node) {
+    std::uint64_t head = head_.load(std::memory_order_relaxed);
+    do {
+      node->next_ = pointerOf(head);
+    } while (!head_.compare_exchange_weak(head, tagged(node, head),
+                                          std::memory_order_release,
+                                          std::memory_order_relaxed));
+    size_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  // Unlinks the top node and retires it. The caller must be pinned and may
+  // read the node until it unpins.
+  Node *popNode() {
+    std::uint64_t head = head_.load(std::memory_order_acquire);
+    for (;;) {
+      Node *node = pointerOf(head);
+      if (node == nullptr) return nullptr;
+      if (head_.compare_exchange_weak(head, tagged(node->next_, head),
+                                      std::memory_order_acquire,
+                                      std::memory_order_acquire)) {
+        size_.fetch_sub(1, std::memory_order_relaxed);
+        epoch_domain::instance().retire(node);
+        return node;
+      }
+    }
+  }
+
+ public:
+  concurrent_stack() : head_(0), size_(0) {}
+  concurrent_stack(const concurrent_stack &) = delete;
+  concurrent_stack &operator=(const concurrent_stack &) = delete;
+  ~concurrent_stack() {
+    Node *node = pointerOf(head_.load(std::memory_order_relaxed));
+    while (node != nullptr) {
+      Node *next = node->next_;
+      delete node;
+      node = next;
+    }
+  }
+
+  // A snapshot that may be stale by the time it is returned.
+  size_type size() const { return size_.load(std::memory_order_relaxed); }
+  bool empty() const {
+    return pointerOf(head_.load(std::memory_order_acquire)) == nullptr;
+  }
+
+  void push(const_reference value) { pushNode(new Node(value)); }
+  void push(value_type &&value) { pushNode(new Node(std::move(value))); }
+
+  template <typename... Args>
+  void emplace(Args &&...args) {
+    pushNode(new Node(std::forward<Args>(args)...));
+  }
+
+  // Copies the top value into out. Returns false when the stack is empty.
+  bool top(reference out) const {
+    epoch_guard guard;
+    Node *node = pointerOf(head_.load(std::memory_order_acquire));
+    if (node != nullptr) out = node->value_;
+    return node != nullptr;
+  }
+
+  // Drops the top value. Returns false when the stack is empty.
+  bool pop() {
+    epoch_guard guard;
+    return popNode() != nullptr;
+  }
+
+  // Copies the top value into out and drops it. Returns false when the stack
+  // is empty.
+  bool try_pop(reference out) {
+    epoch_guard guard;
+    Node *node = popNode();
+    if (node != nullptr) out = node->value_;
+    return node != nullptr;
+  }
+};
+}  // namespace s21
+
+#endif
@@ -0,0 +1,228 @@
+#ifndef S21_CONCURRENT_UNORDERED_MAP_H
+#define S21_CONCURRENT_UNORDERED_MAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <tuple>
+#include <utility>
+
+#include "concurrency_utils.h"
+#include "flat_hash_table.h"
+#include "s21_thread_pool.h"
+
+namespace s21 {
+// Hash map for counters and caches shared by many threads. Keys are spread
+// over a power-of-two number of shards, each a flat_hash_table behind its own
+// spin_lock, and each shard sits on its own cache line so that threads
+// working on different shards never touch the same line.
+//
+// Values are only reachable under their shard's lock, so there are no
+// iterators: find_and and update run a callback on the value instead, and
+// for_each visits the shards one lock at a time. Callbacks must not call
+// back into the map.
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class concurrent_unordered_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+
+ private:
+  struct KeyOf {
+    const key_type &operator()(const value_type &value) const {
+      return value.first;
+    }
+  };
+  using Table =
+      flat_hash_table<value_type, key_type, KeyOf, hasher, key_equal>;
+  using Guard = std::lock_guard<spin_lock>;
+
+  struct alignas(kCacheLineSize) Shard {
+    spin_lock lock_;
+    Table table_;
+  };
+
+  Shard *shards_;
+  size_type shardCount_;
+  int shardShift_;
+  hasher hash_;
+
+  static constexpr size_type kMinShards = 16;
+  static constexpr size_type kShardsPerThread = 8;
+
+  // Picks the shard from the top bits of a Fibonacci hash; the tables
+  // themselves probe with the low bits.
+  Shard &shardOf(const key_type &key) const {
+    std::uint64_t h = static_cast<std::uint64_t>(hash_(key));
+    h *= 0x9E3779B97F4A7C15ull;
+    return shards_[shardShift_ == 64 ? 0 : h >> shardShift_];
+  }
+
+  template <typename... Args>
+  static std::pair<size_type, bool> tryEmplace(Table &table,
+                                               const key_type &key,
+                                               Args &&...args) {
+    return table.insert_unique(key, [&](value_type *place) {
+      new (place)
+          value_type(std::piecewise_construct, std::forward_as_tuple(key),
+                     std::forward_as_tuple(std::forward<Args>(args)...));
+    });
+  }
+
+ public:
+  concurrent_unordered_map() : concurrent_unordered_map(0) {}
+  // Rounds shards up to a power of two; zero picks eight shards per hardware
+  // thread, and never fewer than sixteen.
+  explicit concurrent_unordered_map(size_type shards)
+      : shards_(nullptr), shardCount_(0), shardShift_(64), hash_() {
+    if (shards == 0) {
+      shards = std::max(kMinShards, kShardsPerThread *
+                                        std::thread::hardware_concurrency());
+    }
+    shardCount_ = round_up_to_power_of_two(shards);
+    for (size_type n = shardCount_; n > 1; n >>= 1) shardShift_--;
+    shards_ = new Shard[shardCount_];
+  }
+  concurrent_unordered_map(std::initializer_list<value_type> const &items)
+      : concurrent_unordered_map() {
+    for (const_reference item : items) insert(item);
+  }
+  concurrent_unordered_map(const concurrent_unordered_map &) = delete;
+  concurrent_unordered_map &operator=(const concurrent_unordered_map &) =
+      delete;
+  ~concurrent_unordered_map() { delete[] shards_; }
+
+  size_type shard_count() const { return shardCount_; }
+
+  // Sums the shards one at a time, so the result is only a snapshot when
+  // other threads are writing.
+  size_type size() const {
+    size_type res = 0;
+    for (size_type i = 0; i < shardCount_; i++) {
+      Guard guard(shards_[i].lock_);
+      res += shards_[i].table_.size();
+    }
+    return res;
+  }
+  bool empty() const { return size() == 0; }
+
+  void clear() {
+    for (size_type i = 0; i < shardCount_; i++) {
+      Guard guard(shards_[i].lock_);
+      shards_[i].table_.clear();
+    }
+  }
+  // Spreads room for count values evenly over the shards.
+  void reserve(size_type count) {
+    size_type per_shard = (count + shardCount_ - 1) / shardCount_;
+    for (size_type i = 0; i < shardCount_; i++) {
+      Guard guard(shards_[i].lock_);
+      shards_[i].table_.reserve(per_shard);
+    }
+  }
+
+  // The inserting members return whether key was new.
+  bool insert(const value_type &value) {
+    return try_emplace(value.first, value.second);
+  }
+  bool insert(const Key &key, const T &obj) { return try_emplace(key, obj); }
+  template <typename... Args>
+  bool try_emplace(const Key &key, Args &&...args) {
+    Shard &shard = shardOf(key);
+    Guard guard(shard.lock_);
+    return tryEmplace(shard.table_, key, std::forward<Args>(args)...).second;
+  }
+  bool insert_or_assign(const Key &key, const T &obj) {
+    Shard &shard = shardOf(key);
+    Guard guard(shard.lock_);
+    auto res = tryEmplace(shard.table_, key, obj);
+    if (!res.second) shard.table_.at_slot(res.first).second = obj;
+    return res.second;
+  }
+
+  size_type erase(const Key &key) {
+    Shard &shard = shardOf(key);
+    Guard guard(shard.lock_);
+    return shard.table_.erase_key(key);
+  }
+
+  bool contains(const Key &key) const {
+    Shard &shard = shardOf(key);
+    Guard guard(shard.lock_);
+    return shard.table_.find(key) != Table::npos;
+  }
+  size_type count(const Key &key) const { return contains(key) ? 1 : 0; }
+
+  // Calls fn(const T &) on the value of key under its shard's lock. Returns
+  // false, without calling fn, if key is not present.
+  template <typename F>
+  bool find_and(const Key &key, F &&fn) const {
+    Shard &shard = shardOf(key);
+    Guard guard(shard.lock_);
+    size_type pos = shard.table_.find(key);
+    if (pos == Table::npos) return false;
+    const T &value = shard.table_.at_slot(pos).second;
+    fn(value);
+    return true;
+  }
+
+  // Calls fn(T &) on the value of key under its shard's lock, so that a
+  // read-modify-write is atomic. Returns false if key is not present.
+  template <typename F>
+  bool update(const Key &key, F &&fn) {
+    Shard &shard = shardOf(key);
+    Guard guard(shard.lock_);
+    size_type pos = shard.table_.find(key);
+    if (pos == Table::npos) return false;
+    fn(shard.table_.at_slot(pos).second);
+    return true;
+  }
+  // Like update, but default-constructs the value of a missing key first.
+  // Returns whether key was inserted.
+  template <typename F>
+  bool upsert(const Key &key, F &&fn) {
+    Shard &shard = shardOf(key);
+    Guard guard(shard.lock_);
+    auto res = tryEmplace(shard.table_, key);
+    fn(shard.table_.at_slot(res.first).second);
+    return res.second;
+  }
+
+  // Calls fn(value_type &) on every entry, holding one shard's lock at a
+  // time. Entries inserted or erased meanwhile may or may not be visited.
+  template <typename F>
+  void for_each(F &&fn) {
+    for (size_type i = 0; i < shardCount_; i++) {
+      Guard guard(shards_[i].lock_);
+      for (reference value : shards_[i].table_) fn(value);
+    }
+  }
+  // Parallel for_each: one task per shard on pool, so fn runs concurrently
+  // on entries of different shards. Returns once every entry was visited.
+  template <typename F>
+  void for_each(thread_pool &pool, F &&fn) {
+    task_group group(pool);
+    for (size_type i = 0; i < shardCount_; i++) {
+      group.run([this, i, &fn] {
+        Guard guard(shards_[i].lock_);
+        for (reference value : shards_[i].table_) fn(value);
+      });
+    }
+    group.wait();
+  }
+};
+}  // namespace s21
+
+#endif
@@ -2,6 +2,31 @@
 #define CPP2_S21_CONTAINERS_1_SRC_S21_CONTAINERSPLUS_H_
 
 #include "s21_array.h"
+#include "s21_art_map.h"
+#include "s21_concurrent_map.h"
+#include "s21_concurrent_set.h"
+#include "s21_concurrent_stack.h"
+#include "s21_concurrent_unordered_map.h"
+#include "s21_deque.h"
+#include "s21_flat_map.h"
+#include "s21_flat_set.h"
+#include "s21_frozen_map.h"
+#include "s21_frozen_set.h"
+#include "s21_intrusive_list.h"
+#include "s21_mpmc_queue.h"
 #include "s21_multiset.h"
+#include "s21_pairing_heap.h"
+#include "s21_persistent_map.h"
+#include "s21_persistent_set.h"
+#include "s21_priority_queue.h"
+#include "s21_rcu_map.h"
+#include "s21_roaring_set.h"
+#include "s21_spsc_queue.h"
+#include "s21_thread_pool.h"
+#include "s21_unordered_map.h"
+#include "s21_unordered_multiset.h"
+#include "s21_unordered_set.h"
+#include "s21_unrolled_list.h"
+#include "s21_work_stealing_deque.h"
 
 #endif  // CPP2_S21_CONTAINERS_1_SRC_S21_CONTAINERSPLUS_H_
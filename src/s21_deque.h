@@ -0,0 +1,390 @@
+#ifndef S21_DEQUE_H
+#define S21_DEQUE_H
+
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+// Double-ended sequence stored in fixed-size blocks of about 4 KiB. A map of
+// block pointers gives O(1) random access; pushing at either end fills the
+// first or last block and allocates a new block only when that one is full.
+// Values never move once constructed, so references and pointers to them stay
+// valid across insertions at both ends. Iterators are invalidated when the
+// map itself has to grow.
+//
+// Element g of the map's coordinate space lives at map_[g / kBlockSize]
+// [g % kBlockSize]; the deque holds elements [start_, start_ + size_). One
+// emptied block is kept beyond each end so that a sequence pushing and
+// popping across a block boundary does not allocate every time.
+template <typename T>
+class deque {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+  static constexpr size_type kBlockSize =
+      sizeof(T) < 256 ? 4096 / sizeof(T) : 16;
+
+ private:
+  value_type **map_;
+  size_type mapCapacity_;
+  size_type start_;
+  size_type size_;
+
+  static constexpr size_type kMinMapCapacity = 8;
+
+  static value_type *allocateBlock() {
+    return static_cast<value_type *>(
+        ::operator new(sizeof(value_type) * kBlockSize));
+  }
+
+  value_type *slot(size_type g) const {
+    return map_[g / kBlockSize] + g % kBlockSize;
+  }
+
+  void freeBlock(size_type block) {
+    if (block < mapCapacity_ && map_[block] != nullptr) {
+      ::operator delete(map_[block]);
+      map_[block] = nullptr;
+    }
+  }
+
+  // Moves the allocated blocks to the middle of a map that has room for at
+  // least one more block at each end. The map is reused when it is at most
+  // half full, and doubled otherwise.
+  void growMap() {
+    size_type lo = 0;
+    size_type hi = mapCapacity_;
+    while (lo < hi && map_[lo] == nullptr) lo++;
+    while (hi > lo && map_[hi - 1] == nullptr) hi--;
+    size_type used = hi - lo;
+    size_type capacity = mapCapacity_ ? mapCapacity_ : kMinMapCapacity;
+    while (capacity < 2 * used + 2) capacity *= 2;
+    size_type new_lo = (capacity - used) / 2;
+    if (capacity == mapCapacity_) {
+      std::memmove(map_ + new_lo, map_ + lo, used * sizeof(value_type *));
+      for (size_type i = 0; i < new_lo; i++) map_[i] = nullptr;
+      for (size_type i = new_lo + used; i < capacity; i++) map_[i] = nullptr;
+    } else {
+      value_type **map = new value_type *[capacity + 1]();
+      if (used) {
+        std::memcpy(map + new_lo, map_ + lo, used * sizeof(value_type *));
+      }
+      delete[] map_;
+      map_ = map;
+    }
+    if (used == 0) {
+      start_ = capacity / 2 * kBlockSize;
+    } else {
+      start_ = start_ + new_lo * kBlockSize - lo * kBlockSize;
+    }
+    mapCapacity_ = capacity;
+  }
+
+  // Returns the raw slot for a new value at the back.
+  value_type *backSlot() {
+    size_type g = start_ + size_;
+    if (g / kBlockSize >= mapCapacity_) {
+      growMap();
+      g = start_ + size_;
+    }
+    value_type *&block = map_[g / kBlockSize];
+    if (block == nullptr) block = allocateBlock();
+    return block + g % kBlockSize;
+  }
+
+  // Returns the raw slot for a new value at the front.
+  value_type *frontSlot() {
+    if (start_ == 0) growMap();
+    size_type g = start_ - 1;
+    value_type *&block = map_[g / kBlockSize];
+    if (block == nullptr) block = allocateBlock();
+    return block + g % kBlockSize;
+  }
+
+ public:
+  template <bool Const>
+  class DequeIterator {
+    friend class deque;
+    template <bool>
+    friend class DequeIterator;
+    using block_pointer = T *const *;
+
+    block_pointer node_;
+    T *cur_;
+
+    DequeIterator(block_pointer node, T *cur)
+        : node_(node), cur_(cur) {}
+
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T *, T *>;
+    using reference = std::conditional_t<Const, const T &, T &>;
+
+    DequeIterator() : node_(nullptr), cur_(nullptr) {}
+    template <bool OtherConst,
+              typename = std::enable_if_t<Const && !OtherConst>>
+    DequeIterator(const DequeIterator<OtherConst> &other)
+        : node_(other.node_), cur_(other.cur_) {}
+
+    reference operator*() const { return *cur_; }
+    pointer operator->() const { return cur_; }
+    reference operator[](difference_type n) const { return *(*this + n); }
+
+    DequeIterator &operator++() {
+      if (++cur_ == *node_ + kBlockSize) {
+        ++node_;
+        cur_ = *node_;
+      }
+      return *this;
+    }
+    DequeIterator operator++(int) {
+      DequeIterator tmp(*this);
+      ++*this;
+      return tmp;
+    }
+    DequeIterator &operator--() {
+      if (cur_ == *node_) {
+        --node_;
+        cur_ = *node_ + kBlockSize;
+      }
+      --cur_;
+      return *this;
+    }
+    DequeIterator operator--(int) {
+      DequeIterator tmp(*this);
+      --*this;
+      return tmp;
+    }
+
+    DequeIterator &operator+=(difference_type n) {
+      const difference_type block = kBlockSize;
+      difference_type offset = (cur_ - *node_) + n;
+      if (offset >= 0 && offset < block) {
+        cur_ += n;
+      } else {
+        difference_type nodes =
+            offset >= 0 ? offset / block : -((-offset - 1) / block) - 1;
+        node_ += nodes;
+        cur_ = *node_ + (offset - nodes * block);
+      }
+      return *this;
+    }
+    DequeIterator &operator-=(difference_type n) { return *this += -n; }
+    DequeIterator operator+(difference_type n) const {
+      DequeIterator tmp(*this);
+      return tmp += n;
+    }
+    friend DequeIterator operator+(difference_type n, DequeIterator it) {
+      return it += n;
+    }
+    DequeIterator operator-(difference_type n) const {
+      DequeIterator tmp(*this);
+      return tmp -= n;
+    }
+    difference_type operator-(const DequeIterator &other) const {
+      return (node_ - other.node_) * difference_type(kBlockSize) +
+             (cur_ - *node_) - (other.cur_ - *other.node_);
+    }
+
+    bool operator==(const DequeIterator &other) const {
+      return cur_ == other.cur_ && node_ == other.node_;
+    }
+    bool operator!=(const DequeIterator &other) const {
+      return !(*this == other);
+    }
+    bool operator<(const DequeIterator &other) const {
+      return node_ == other.node_ ? cur_ < other.cur_ : node_ < other.node_;
+    }
+    bool operator>(const DequeIterator &other) const { return other < *this; }
+    bool operator<=(const DequeIterator &other) const {
+      return !(other < *this);
+    }
+    bool operator>=(const DequeIterator &other) const {
+      return !(*this < other);
+    }
+  };
+
+  using iterator = DequeIterator<false>;
+  using const_iterator = DequeIterator<true>;
+
+  deque() : map_(nullptr), mapCapacity_(0), start_(0), size_(0) {}
+
+  explicit deque(size_type n) : deque() {
+    for (size_type i = 0; i < n; i++) emplace_back();
+  }
+
+  deque(std::initializer_list<value_type> const &items) : deque() {
+    for (const_reference item : items) push_back(item);
+  }
+
+  deque(const deque &d) : deque() {
+    for (size_type i = 0; i < d.size_; i++) push_back(d[i]);
+  }
+
+  deque(deque &&d) noexcept : deque() { swap(d); }
+
+  ~deque() {
+    clear();
+    for (size_type i = 0; i < mapCapacity_; i++) freeBlock(i);
+    delete[] map_;
+  }
+
+  deque &operator=(const deque &d) {
+    if (this != &d) {
+      deque tmp(d);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  deque &operator=(deque &&d) noexcept {
+    if (this != &d) {
+      deque tmp(std::move(d));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  reference operator[](size_type pos) { return *slot(start_ + pos); }
+  const_reference operator[](size_type pos) const {
+    return *slot(start_ + pos);
+  }
+
+  reference at(size_type pos) {
+    if (pos >= size_) throw std::out_of_range("Index out of range");
+    return (*this)[pos];
+  }
+  const_reference at(size_type pos) const {
+    if (pos >= size_) throw std::out_of_range("Index out of range");
+    return (*this)[pos];
+  }
+
+  reference front() { return *slot(start_); }
+  const_reference front() const { return *slot(start_); }
+  reference back() { return *slot(start_ + size_ - 1); }
+  const_reference back() const { return *slot(start_ + size_ - 1); }
+
+  iterator begin() { return iteratorAt(start_); }
+  iterator end() { return iteratorAt(start_ + size_); }
+  const_iterator begin() const { return iteratorAt(start_); }
+  const_iterator end() const { return iteratorAt(start_ + size_); }
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type max_size() const {
+    return size_type(-1) / sizeof(value_type) / 2;
+  }
+
+  void clear() {
+    while (size_ > 0) pop_back();
+  }
+
+  // Frees the spare blocks kept beyond both ends.
+  void shrink_to_fit() {
+    if (size_ == 0) {
+      for (size_type i = 0; i < mapCapacity_; i++) freeBlock(i);
+      return;
+    }
+    size_type first = start_ / kBlockSize;
+    size_type last = (start_ + size_ - 1) / kBlockSize;
+    for (size_type i = 0; i < first; i++) freeBlock(i);
+    for (size_type i = last + 1; i < mapCapacity_; i++) freeBlock(i);
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+  void push_front(const_reference value) { emplace_front(value); }
+  void push_front(value_type &&value) { emplace_front(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    value_type *place = backSlot();
+    new (place) value_type(std::forward<Args>(args)...);
+    size_++;
+    return *place;
+  }
+
+  template <typename... Args>
+  reference emplace_front(Args &&...args) {
+    value_type *place = frontSlot();
+    new (place) value_type(std::forward<Args>(args)...);
+    start_--;
+    size_++;
+    return *place;
+  }
+
+  void pop_back() {
+    if (empty()) return;
+    size_type g = start_ + --size_;
+    slot(g)->~value_type();
+    if (g % kBlockSize == 0) freeBlock(g / kBlockSize + 1);
+  }
+
+  void pop_front() {
+    if (empty()) return;
+    size_type g = start_++;
+    slot(g)->~value_type();
+    size_--;
+    if (g % kBlockSize == kBlockSize - 1 && g / kBlockSize > 0) {
+      freeBlock(g / kBlockSize - 1);
+    }
+  }
+
+  // Appends [first, last).
+  template <typename InputIt>
+  void push_range(InputIt first, InputIt last) {
+    for (; first != last; ++first) push_back(*first);
+  }
+
+  // Moves up to n values from the front into out and returns how many were
+  // moved.
+  template <typename OutputIt>
+  size_type pop_into(OutputIt out, size_type n) {
+    size_type count = n < size_ ? n : size_;
+    for (size_type i = 0; i < count; i++) {
+      *out = std::move(front());
+      ++out;
+      pop_front();
+    }
+    return count;
+  }
+
+  void swap(deque &other) noexcept {
+    std::swap(map_, other.map_);
+    std::swap(mapCapacity_, other.mapCapacity_);
+    std::swap(start_, other.start_);
+    std::swap(size_, other.size_);
+  }
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    (push_back(std::forward<Args>(args)), ...);
+  }
+
+  template <typename... Args>
+  void insert_many_front(Args &&...args) {
+    (push_front(std::forward<Args>(args)), ...);
+  }
+
+ private:
+  iterator iteratorAt(size_type g) const {
+    if (map_ == nullptr) return iterator();
+    value_type *const *node = map_ + g / kBlockSize;
+    value_type *cur = *node == nullptr ? nullptr : *node + g % kBlockSize;
+    return iterator(node, cur);
+  }
+};
+}  // namespace s21
+
+#endif
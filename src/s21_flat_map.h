@@ -0,0 +1,390 @@
+#ifndef S21_FLAT_MAP_H
+#define S21_FLAT_MAP_H
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+#include "sorted_columns.h"
+
+namespace s21 {
+// Map with the interface of s21::map, stored as two parallel s21::vector
+// columns: the sorted keys and, at the same indices, their values. A lookup
+// is a branchless binary search over the keys alone, so the values never
+// take up cache lines while searching and no per-entry node is allocated.
+//
+// Since a key and its value are not stored together, dereferencing an
+// iterator yields a std::pair of references, (*it).second and it->second
+// work as with s21::map. Inserting or erasing a single entry moves the
+// entries after it; bulk loads should use insert(first, last),
+// insert(sorted_unique, ...) or replace. Any modification invalidates
+// iterators.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class flat_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<key_type, mapped_type>;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+
+ private:
+  vector<key_type> keys_;
+  vector<mapped_type> values_;
+  key_compare comp_;
+
+  size_type lowerIndex(const key_type &key) const {
+    return sorted_lower_bound(keys_.data(), keys_.size(), key, comp_);
+  }
+  size_type findIndex(const key_type &key) const {
+    size_type pos = lowerIndex(key);
+    if (pos < keys_.size() && !comp_(key, keys_[pos])) return pos;
+    return keys_.size();
+  }
+
+  // Puts a new entry at pos, keeping both columns the same length if
+  // building the key throws.
+  template <typename... Args>
+  void insertAt(size_type pos, const key_type &key, Args &&...args) {
+    column_insert(values_, pos, std::forward<Args>(args)...);
+    try {
+      column_insert(keys_, pos, key);
+    } catch (...) {
+      column_erase(values_, pos);
+      throw;
+    }
+  }
+
+  template <typename... Args>
+  std::pair<size_type, bool> tryEmplace(const key_type &key, Args &&...args) {
+    size_type pos = lowerIndex(key);
+    if (pos < keys_.size() && !comp_(key, keys_[pos])) return {pos, false};
+    insertAt(pos, key, std::forward<Args>(args)...);
+    return {pos, true};
+  }
+
+ public:
+  template <bool Const>
+  class FlatMapIterator {
+    friend class flat_map;
+    template <bool>
+    friend class FlatMapIterator;
+    using mapped_pointer = std::conditional_t<Const, const T *, T *>;
+
+    const Key *key_;
+    mapped_pointer value_;
+
+    FlatMapIterator(const Key *key, mapped_pointer value)
+        : key_(key), value_(value) {}
+
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::pair<Key, T>;
+    using difference_type = std::ptrdiff_t;
+    using reference =
+        std::pair<const Key &, std::conditional_t<Const, const T &, T &>>;
+
+    // Gives operator-> something to point at.
+    struct pointer {
+      reference ref_;
+      const reference *operator->() const { return &ref_; }
+    };
+
+    FlatMapIterator() : key_(nullptr), value_(nullptr) {}
+    template <bool OtherConst,
+              typename = std::enable_if_t<Const && !OtherConst>>
+    FlatMapIterator(const FlatMapIterator<OtherConst> &other)
+        : key_(other.key_), value_(other.value_) {}
+
+    reference operator*() const { return reference(*key_, *value_); }
+    pointer operator->() const { return pointer{**this}; }
+    reference operator[](difference_type n) const { return *(*this + n); }
+
+    FlatMapIterator &operator++() {
+      ++key_;
+      ++value_;
+      return *this;
+    }
+    FlatMapIterator operator++(int) {
+      FlatMapIterator tmp(*this);
+      ++*this;
+      return tmp;
+    }
+    FlatMapIterator &operator--() {
+      --key_;
+      --value_;
+      return *this;
+    }
+    FlatMapIterator operator--(int) {
+      FlatMapIterator tmp(*this);
+      --*this;
+      return tmp;
+    }
+    FlatMapIterator &operator+=(difference_type n) {
+      key_ += n;
+      value_ += n;
+      return *this;
+    }
+    FlatMapIterator &operator-=(difference_type n) { return *this += -n; }
+    FlatMapIterator operator+(difference_type n) const {
+      FlatMapIterator tmp(*this);
+      return tmp += n;
+    }
+    FlatMapIterator operator-(difference_type n) const {
+      FlatMapIterator tmp(*this);
+      return tmp -= n;
+    }
+    difference_type operator-(const FlatMapIterator &other) const {
+      return key_ - other.key_;
+    }
+
+    bool operator==(const FlatMapIterator &other) const {
+      return key_ == other.key_;
+    }
+    bool operator!=(const FlatMapIterator &other) const {
+      return key_ != other.key_;
+    }
+    bool operator<(const FlatMapIterator &other) const {
+      return key_ < other.key_;
+    }
+  };
+
+  using iterator = FlatMapIterator<false>;
+  using const_iterator = FlatMapIterator<true>;
+
+  flat_map() : keys_(), values_(), comp_() {}
+  explicit flat_map(const key_compare &comp)
+      : keys_(), values_(), comp_(comp) {}
+  flat_map(std::initializer_list<value_type> const &items) : flat_map() {
+    insert(items.begin(), items.end());
+  }
+  template <typename InputIt, typename = typename std::iterator_traits<
+                                  InputIt>::iterator_category>
+  flat_map(InputIt first, InputIt last) : flat_map() {
+    insert(first, last);
+  }
+  flat_map(sorted_unique_t, vector<key_type> keys, vector<mapped_type> values)
+      : flat_map() {
+    replace(std::move(keys), std::move(values));
+  }
+  flat_map(const flat_map &m)
+      : keys_(m.keys_), values_(m.values_), comp_(m.comp_) {}
+  flat_map(flat_map &&m) noexcept : flat_map() { swap(m); }
+  ~flat_map() {}
+
+  flat_map &operator=(const flat_map &m) {
+    if (this != &m) {
+      flat_map tmp(m);
+      swap(tmp);
+    }
+    return *this;
+  }
+  flat_map &operator=(flat_map &&m) noexcept {
+    if (this != &m) {
+      flat_map tmp(std::move(m));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  T &at(const Key &key) {
+    size_type pos = findIndex(key);
+    if (pos == size()) throw std::out_of_range("This key is not in the map.");
+    return values_[pos];
+  }
+  const T &at(const Key &key) const {
+    return const_cast<flat_map *>(this)->at(key);
+  }
+  T &operator[](const Key &key) { return values_[tryEmplace(key).first]; }
+
+  iterator begin() { return iteratorAt(0); }
+  iterator end() { return iteratorAt(size()); }
+  const_iterator begin() const { return iteratorAt(0); }
+  const_iterator end() const { return iteratorAt(size()); }
+
+  bool empty() const { return keys_.empty(); }
+  size_type size() const { return keys_.size(); }
+  size_type max_size() const { return values_.max_size(); }
+
+  void clear() {
+    keys_.clear();
+    values_.clear();
+  }
+  void reserve(size_type count) {
+    keys_.reserve(count);
+    values_.reserve(count);
+  }
+  void shrink_to_fit() {
+    keys_.shrink_to_fit();
+    values_.shrink_to_fit();
+  }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    auto res = tryEmplace(value.first, value.second);
+    return {iteratorAt(res.first), res.second};
+  }
+  std::pair<iterator, bool> insert(const Key &key, const T &obj) {
+    auto res = tryEmplace(key, obj);
+    return {iteratorAt(res.first), res.second};
+  }
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj) {
+    auto res = tryEmplace(key, obj);
+    if (!res.second) values_[res.first] = obj;
+    return {iteratorAt(res.first), res.second};
+  }
+
+  // Inserts an unsorted range of pairs: they are sorted by key once and
+  // merged in. Of several pairs with the same key, the first one wins.
+  template <typename InputIt, typename = typename std::iterator_traits<
+                                  InputIt>::iterator_category>
+  void insert(InputIt first, InputIt last) {
+    vector<value_type> items;
+    for (; first != last; ++first) items.emplace_back(*first);
+    auto less = [this](const value_type &a, const value_type &b) {
+      return comp_(a.first, b.first);
+    };
+    sort_unique_keys(items, less);
+    insert(sorted_unique, std::make_move_iterator(items.begin()),
+           std::make_move_iterator(items.end()));
+  }
+
+  // Merges a range of pairs that is already sorted by key and free of
+  // duplicate keys in one linear pass. Keys that are already present keep
+  // their values. The current entries are moved, not copied, into the
+  // merged columns, so this gives only the basic guarantee: if constructing
+  // an entry throws, the map is left empty.
+  template <typename InputIt>
+  void insert(sorted_unique_t, InputIt first, InputIt last) {
+    if (first == last) return;
+    size_type capacity = size();
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+      capacity += size_type(std::distance(first, last));
+    }
+    vector<key_type> keys;
+    vector<mapped_type> values;
+    keys.reserve(capacity);
+    values.reserve(capacity);
+    try {
+      size_type i = 0;
+      for (; first != last; ++first) {
+        auto &&item = *first;
+        while (i < size() && comp_(keys_[i], item.first)) {
+          keys.emplace_back(std::move(keys_[i]));
+          values.emplace_back(std::move(values_[i++]));
+        }
+        if (i < size() && !comp_(item.first, keys_[i])) continue;
+        keys.emplace_back(std::forward<decltype(item)>(item).first);
+        values.emplace_back(std::forward<decltype(item)>(item).second);
+      }
+      for (; i < size(); i++) {
+        keys.emplace_back(std::move(keys_[i]));
+        values.emplace_back(std::move(values_[i]));
+      }
+    } catch (...) {
+      keys_.clear();
+      values_.clear();
+      throw;
+    }
+    keys_.swap(keys);
+    values_.swap(values);
+  }
+
+  // Adopts both columns as the whole contents. keys must be sorted and
+  // unique and as long as values; otherwise std::invalid_argument is thrown
+  // and the map is left unchanged.
+  void replace(vector<key_type> &&keys, vector<mapped_type> &&values) {
+    if (keys.size() != values.size()) {
+      throw std::invalid_argument("keys and values differ in length");
+    }
+    if (!sorted_unique_keys(keys.data(), keys.size(), comp_)) {
+      throw std::invalid_argument("keys are not sorted and unique");
+    }
+    keys_ = std::move(keys);
+    values_ = std::move(values);
+  }
+
+  const vector<key_type> &keys() const { return keys_; }
+  const vector<mapped_type> &values() const { return values_; }
+
+  void erase(iterator pos) {
+    if (pos != end()) eraseAt(size_type(pos - begin()));
+  }
+  size_type erase(const Key &key) {
+    size_type pos = findIndex(key);
+    if (pos == size()) return 0;
+    eraseAt(pos);
+    return 1;
+  }
+
+  void swap(flat_map &other) noexcept {
+    keys_.swap(other.keys_);
+    values_.swap(other.values_);
+    std::swap(comp_, other.comp_);
+  }
+
+  // Inserts every entry of other whose key is not present yet, then empties
+  // other, as s21::map::merge does.
+  void merge(flat_map &other) {
+    if (this == &other) return;
+    vector<value_type> items;
+    items.reserve(other.size());
+    for (size_type i = 0; i < other.size(); i++) {
+      items.emplace_back(std::move(other.keys_[i]),
+                         std::move(other.values_[i]));
+    }
+    other.clear();
+    insert(sorted_unique, std::make_move_iterator(items.begin()),
+           std::make_move_iterator(items.end()));
+  }
+
+  iterator find(const Key &key) { return iteratorAt(findIndex(key)); }
+  const_iterator find(const Key &key) const {
+    return iteratorAt(findIndex(key));
+  }
+  bool contains(const Key &key) const { return findIndex(key) != size(); }
+  size_type count(const Key &key) const { return contains(key) ? 1 : 0; }
+  iterator lower_bound(const Key &key) { return iteratorAt(lowerIndex(key)); }
+  iterator upper_bound(const Key &key) {
+    return iteratorAt(
+        sorted_upper_bound(keys_.data(), keys_.size(), key, comp_));
+  }
+
+  // Each insertion moves the entries after it, so the iterators are looked
+  // up once everything is in place.
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    vector<value_type> items;
+    (items.emplace_back(std::forward<Args>(args)), ...);
+    vector<bool> inserted;
+    for (const value_type &item : items) {
+      inserted.push_back(insert(item).second);
+    }
+    vector<std::pair<iterator, bool>> res;
+    for (size_type i = 0; i < items.size(); i++) {
+      res.push_back({find(items[i].first), inserted[i]});
+    }
+    return res;
+  }
+
+ private:
+  iterator iteratorAt(size_type pos) {
+    return iterator(keys_.data() + pos, values_.data() + pos);
+  }
+  const_iterator iteratorAt(size_type pos) const {
+    return const_iterator(keys_.data() + pos, values_.data() + pos);
+  }
+
+  void eraseAt(size_type pos) {
+    column_erase(keys_, pos);
+    column_erase(values_, pos);
+  }
+};
+}  // namespace s21
+
+#endif
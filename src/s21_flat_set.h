@@ -0,0 +1,209 @@
+#ifndef S21_FLAT_SET_H
+#define S21_FLAT_SET_H
+
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+#include "sorted_columns.h"
+
+namespace s21 {
+// Set with the interface of s21::set, stored as one sorted s21::vector. It
+// suits sets that are built once and then mostly searched: there is no
+// per-key node, and a lookup is a branchless binary search over contiguous
+// keys. Inserting or erasing a single key moves the keys after it, so bulk
+// loads should go through insert(first, last), insert(sorted_unique, ...)
+// or replace, which sort or merge once. Any modification invalidates
+// iterators.
+template <typename Key, typename Compare = std::less<Key>>
+class flat_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+  using iterator = const value_type *;
+  using const_iterator = const value_type *;
+
+ private:
+  vector<key_type> keys_;
+  key_compare comp_;
+
+  size_type lowerIndex(const key_type &key) const {
+    return sorted_lower_bound(keys_.data(), keys_.size(), key, comp_);
+  }
+  size_type findIndex(const key_type &key) const {
+    size_type pos = lowerIndex(key);
+    if (pos < keys_.size() && !comp_(key, keys_[pos])) return pos;
+    return keys_.size();
+  }
+  iterator at(size_type pos) const { return keys_.data() + pos; }
+
+ public:
+  flat_set() : keys_(), comp_() {}
+  explicit flat_set(const key_compare &comp) : keys_(), comp_(comp) {}
+  flat_set(std::initializer_list<value_type> const &items) : flat_set() {
+    insert(items.begin(), items.end());
+  }
+  template <typename InputIt, typename = typename std::iterator_traits<
+                                  InputIt>::iterator_category>
+  flat_set(InputIt first, InputIt last) : flat_set() {
+    insert(first, last);
+  }
+  flat_set(sorted_unique_t, vector<key_type> keys) : flat_set() {
+    replace(std::move(keys));
+  }
+  flat_set(const flat_set &s) : keys_(s.keys_), comp_(s.comp_) {}
+  flat_set(flat_set &&s) noexcept : flat_set() { swap(s); }
+  ~flat_set() {}
+
+  flat_set &operator=(const flat_set &s) {
+    if (this != &s) {
+      flat_set tmp(s);
+      swap(tmp);
+    }
+    return *this;
+  }
+  flat_set &operator=(flat_set &&s) noexcept {
+    if (this != &s) {
+      flat_set tmp(std::move(s));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  iterator begin() const { return keys_.data(); }
+  iterator end() const { return keys_.data() + keys_.size(); }
+
+  bool empty() const { return keys_.empty(); }
+  size_type size() const { return keys_.size(); }
+  size_type max_size() const { return keys_.max_size(); }
+
+  void clear() { keys_.clear(); }
+  void reserve(size_type count) { keys_.reserve(count); }
+  void shrink_to_fit() { keys_.shrink_to_fit(); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    size_type pos = lowerIndex(value);
+    if (pos < keys_.size() && !comp_(value, keys_[pos])) {
+      return {at(pos), false};
+    }
+    column_insert(keys_, pos, value);
+    return {at(pos), true};
+  }
+
+  // Inserts an unsorted range: the keys are sorted once and merged in, so a
+  // bulk load costs O((n + m) log m) instead of O(n * m).
+  template <typename InputIt, typename = typename std::iterator_traits<
+                                  InputIt>::iterator_category>
+  void insert(InputIt first, InputIt last) {
+    vector<key_type> keys;
+    for (; first != last; ++first) keys.emplace_back(*first);
+    sort_unique_keys(keys, comp_);
+    insert(sorted_unique, std::make_move_iterator(keys.begin()),
+           std::make_move_iterator(keys.end()));
+  }
+
+  // Merges a range that is already sorted and free of duplicates in one
+  // linear pass. Keys that are already present are kept. The current keys
+  // are moved, not copied, into the merged vector, so this gives only the
+  // basic guarantee: if constructing a key throws, the set is left empty.
+  template <typename InputIt>
+  void insert(sorted_unique_t, InputIt first, InputIt last) {
+    if (first == last) return;
+    size_type capacity = keys_.size();
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+      capacity += size_type(std::distance(first, last));
+    }
+    vector<key_type> merged;
+    merged.reserve(capacity);
+    try {
+      size_type i = 0;
+      for (; first != last; ++first) {
+        auto &&key = *first;
+        while (i < keys_.size() && comp_(keys_[i], key)) {
+          merged.emplace_back(std::move(keys_[i++]));
+        }
+        if (i < keys_.size() && !comp_(key, keys_[i])) continue;
+        merged.emplace_back(std::forward<decltype(key)>(key));
+      }
+      while (i < keys_.size()) merged.emplace_back(std::move(keys_[i++]));
+    } catch (...) {
+      keys_.clear();
+      throw;
+    }
+    keys_.swap(merged);
+  }
+
+  // Adopts keys, which must be sorted and unique, as the whole contents.
+  // Throws std::invalid_argument otherwise.
+  void replace(vector<key_type> &&keys) {
+    if (!sorted_unique_keys(keys.data(), keys.size(), comp_)) {
+      throw std::invalid_argument("keys are not sorted and unique");
+    }
+    keys_ = std::move(keys);
+  }
+
+  // Hands the sorted keys over to the caller and leaves the set empty.
+  vector<key_type> extract() {
+    vector<key_type> res;
+    res.swap(keys_);
+    return res;
+  }
+  const vector<key_type> &keys() const { return keys_; }
+
+  void erase(iterator pos) {
+    if (pos != end()) column_erase(keys_, size_type(pos - begin()));
+  }
+  size_type erase(const Key &key) {
+    size_type pos = findIndex(key);
+    if (pos == keys_.size()) return 0;
+    column_erase(keys_, pos);
+    return 1;
+  }
+
+  void swap(flat_set &other) noexcept {
+    keys_.swap(other.keys_);
+    std::swap(comp_, other.comp_);
+  }
+
+  // Inserts every key of other that is not present yet, then empties other,
+  // as s21::set::merge does.
+  void merge(flat_set &other) {
+    if (this == &other) return;
+    insert(sorted_unique, other.begin(), other.end());
+    other.clear();
+  }
+
+  iterator find(const Key &key) const { return at(findIndex(key)); }
+  bool contains(const Key &key) const { return findIndex(key) != size(); }
+  size_type count(const Key &key) const { return contains(key) ? 1 : 0; }
+  iterator lower_bound(const Key &key) const { return at(lowerIndex(key)); }
+  iterator upper_bound(const Key &key) const {
+    return at(sorted_upper_bound(keys_.data(), keys_.size(), key, comp_));
+  }
+
+  // Each insertion moves the keys after it, so the iterators are looked up
+  // once everything is in place.
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    vector<key_type> keys;
+    (keys.emplace_back(std::forward<Args>(args)), ...);
+    vector<std::pair<iterator, bool>> res;
+    for (const key_type &key : keys) {
+      res.push_back({nullptr, insert(key).second});
+    }
+    for (size_type i = 0; i < keys.size(); i++) res[i].first = find(keys[i]);
+    return res;
+  }
+};
+}  // namespace s21
+
+#endif
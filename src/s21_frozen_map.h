@@ -0,0 +1,216 @@
+#ifndef S21_FROZEN_MAP_H
+#define S21_FROZEN_MAP_H
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "eytzinger_array.h"
+#include "s21_map.h"
+#include "s21_vector.h"
+#include "sorted_columns.h"
+
+namespace s21 {
+// Read-only map laid out like s21::frozen_set: the keys in Eytzinger order
+// in one aligned array, and the values in a second array at the same
+// positions, so a search touches only keys. As with s21::flat_map,
+// dereferencing an iterator yields a std::pair of references.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class frozen_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<key_type, mapped_type>;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+
+  class FrozenMapIterator {
+    friend class frozen_map;
+
+    const frozen_map *map_;
+    size_type pos_;
+
+    FrozenMapIterator(const frozen_map *map, size_type pos)
+        : map_(map), pos_(pos) {}
+
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = std::pair<Key, T>;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::pair<const Key &, const T &>;
+
+    // Gives operator-> something to point at.
+    struct pointer {
+      reference ref_;
+      const reference *operator->() const { return &ref_; }
+    };
+
+    FrozenMapIterator() : map_(nullptr), pos_(0) {}
+
+    reference operator*() const {
+      return reference(map_->keys_[pos_], map_->values_[pos_]);
+    }
+    pointer operator->() const { return pointer{**this}; }
+
+    FrozenMapIterator &operator++() {
+      pos_ = eytzinger_next(pos_, map_->size());
+      return *this;
+    }
+    FrozenMapIterator operator++(int) {
+      FrozenMapIterator tmp(*this);
+      ++*this;
+      return tmp;
+    }
+    // Decrementing end() gives the entry with the largest key.
+    FrozenMapIterator &operator--() {
+      pos_ = eytzinger_prev(pos_, map_->size());
+      return *this;
+    }
+    FrozenMapIterator operator--(int) {
+      FrozenMapIterator tmp(*this);
+      --*this;
+      return tmp;
+    }
+
+    bool operator==(const FrozenMapIterator &other) const {
+      return pos_ == other.pos_;
+    }
+    bool operator!=(const FrozenMapIterator &other) const {
+      return pos_ != other.pos_;
+    }
+  };
+
+  using iterator = FrozenMapIterator;
+  using const_iterator = FrozenMapIterator;
+
+ private:
+  EytzingerArray<key_type> keys_;
+  EytzingerArray<mapped_type> values_;
+  key_compare comp_;
+
+  iterator iteratorAt(size_type pos) const { return iterator(this, pos); }
+  size_type findPos(const Key &key) const {
+    size_type pos = keys_.lowerBound(key, comp_);
+    if (pos != 0 && comp_(key, keys_[pos])) pos = 0;
+    return pos;
+  }
+
+  void assign(vector<key_type> &&keys, vector<mapped_type> &&values) {
+    keys_ = EytzingerArray<key_type>(std::move(keys));
+    values_ = EytzingerArray<mapped_type>(std::move(values));
+  }
+
+  // Sorts entries by key, keeps the first of several equal keys and splits
+  // them into the two arrays.
+  void assign(vector<value_type> &&entries) {
+    auto less = [this](const value_type &a, const value_type &b) {
+      return comp_(a.first, b.first);
+    };
+    if (!sorted_unique_keys(entries.data(), entries.size(), less)) {
+      sort_unique_keys(entries, less);
+    }
+    vector<key_type> keys;
+    vector<mapped_type> values;
+    keys.reserve(entries.size());
+    values.reserve(entries.size());
+    for (value_type &entry : entries) {
+      keys.push_back(std::move(entry.first));
+      values.push_back(std::move(entry.second));
+    }
+    assign(std::move(keys), std::move(values));
+  }
+
+ public:
+  frozen_map() : keys_(), values_(), comp_() {}
+  explicit frozen_map(const key_compare &comp)
+      : keys_(), values_(), comp_(comp) {}
+  frozen_map(std::initializer_list<value_type> const &items) : frozen_map() {
+    vector<value_type> entries;
+    for (const value_type &entry : items) entries.push_back(entry);
+    assign(std::move(entries));
+  }
+  // Takes the entries of any range; if several have equal keys, the first
+  // one is kept.
+  template <typename InputIt, typename = typename std::iterator_traits<
+                                  InputIt>::iterator_category>
+  frozen_map(InputIt first, InputIt last) : frozen_map() {
+    vector<value_type> entries;
+    for (; first != last; ++first) entries.emplace_back(*first);
+    assign(std::move(entries));
+  }
+  // Takes keys that must be sorted and unique and their values at the same
+  // indices; throws std::invalid_argument otherwise.
+  frozen_map(sorted_unique_t, vector<key_type> keys,
+             vector<mapped_type> values)
+      : frozen_map() {
+    if (keys.size() != values.size()) {
+      throw std::invalid_argument("keys and values differ in length");
+    }
+    if (!sorted_unique_keys(keys.data(), keys.size(), comp_)) {
+      throw std::invalid_argument("keys are not sorted and unique");
+    }
+    assign(std::move(keys), std::move(values));
+  }
+  template <template <typename, typename> class Tree>
+  explicit frozen_map(map<Key, T, Tree> &m) : frozen_map() {
+    vector<value_type> entries;
+    for (auto it = m.begin(); it != m.end(); ++it) entries.push_back(*it);
+    assign(std::move(entries));
+  }
+  frozen_map(const frozen_map &m)
+      : keys_(m.keys_), values_(m.values_), comp_(m.comp_) {}
+  frozen_map(frozen_map &&m) noexcept : frozen_map() { swap(m); }
+  ~frozen_map() {}
+
+  frozen_map &operator=(const frozen_map &m) {
+    if (this != &m) {
+      frozen_map tmp(m);
+      swap(tmp);
+    }
+    return *this;
+  }
+  frozen_map &operator=(frozen_map &&m) noexcept {
+    if (this != &m) {
+      frozen_map tmp(std::move(m));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  const T &at(const Key &key) const {
+    size_type pos = findPos(key);
+    if (pos == 0) throw std::out_of_range("This key is not in the map.");
+    return values_[pos];
+  }
+
+  iterator begin() const { return iteratorAt(eytzinger_first(keys_.size())); }
+  iterator end() const { return iteratorAt(0); }
+
+  bool empty() const { return keys_.size() == 0; }
+  size_type size() const { return keys_.size(); }
+  size_type max_size() const {
+    return size_type(-1) / (sizeof(key_type) + sizeof(mapped_type)) / 2;
+  }
+
+  void swap(frozen_map &other) noexcept {
+    keys_.swap(other.keys_);
+    values_.swap(other.values_);
+    std::swap(comp_, other.comp_);
+  }
+
+  iterator lower_bound(const Key &key) const {
+    return iteratorAt(keys_.lowerBound(key, comp_));
+  }
+  iterator upper_bound(const Key &key) const {
+    return iteratorAt(keys_.upperBound(key, comp_));
+  }
+  iterator find(const Key &key) const { return iteratorAt(findPos(key)); }
+  bool contains(const Key &key) const { return findPos(key) != 0; }
+  size_type count(const Key &key) const { return contains(key) ? 1 : 0; }
+};
+}  // namespace s21
+
+#endif
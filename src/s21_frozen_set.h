@@ -0,0 +1,177 @@
+#ifndef S21_FROZEN_SET_H
+#define S21_FROZEN_SET_H
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "eytzinger_array.h"
+#include "s21_set.h"
+#include "s21_vector.h"
+#include "sorted_columns.h"
+
+namespace s21 {
+// Read-only set for lookup tables that are built once and then only
+// searched. The keys sit in one cache-line aligned array in Eytzinger
+// order, the order of a breadth-first walk of a balanced search tree, so
+// the first levels of every search share the same few cache lines, and the
+// search descends with no branch on the comparison while prefetching the
+// keys a few levels further down. Iteration still visits the keys in
+// sorted order.
+template <typename Key, typename Compare = std::less<Key>>
+class frozen_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+
+  class FrozenSetIterator {
+    friend class frozen_set;
+
+    const EytzingerArray<Key> *keys_;
+    size_type pos_;
+
+    FrozenSetIterator(const EytzingerArray<Key> *keys, size_type pos)
+        : keys_(keys), pos_(pos) {}
+
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Key;
+    using difference_type = std::ptrdiff_t;
+    using reference = const Key &;
+    using pointer = const Key *;
+
+    FrozenSetIterator() : keys_(nullptr), pos_(0) {}
+
+    reference operator*() const { return (*keys_)[pos_]; }
+    pointer operator->() const { return &(*keys_)[pos_]; }
+
+    FrozenSetIterator &operator++() {
+      pos_ = eytzinger_next(pos_, keys_->size());
+      return *this;
+    }
+    FrozenSetIterator operator++(int) {
+      FrozenSetIterator tmp(*this);
+      ++*this;
+      return tmp;
+    }
+    // Decrementing end() gives the largest key.
+    FrozenSetIterator &operator--() {
+      pos_ = eytzinger_prev(pos_, keys_->size());
+      return *this;
+    }
+    FrozenSetIterator operator--(int) {
+      FrozenSetIterator tmp(*this);
+      --*this;
+      return tmp;
+    }
+
+    bool operator==(const FrozenSetIterator &other) const {
+      return pos_ == other.pos_;
+    }
+    bool operator!=(const FrozenSetIterator &other) const {
+      return pos_ != other.pos_;
+    }
+  };
+
+  using iterator = FrozenSetIterator;
+  using const_iterator = FrozenSetIterator;
+
+ private:
+  EytzingerArray<key_type> keys_;
+  key_compare comp_;
+
+  iterator at(size_type pos) const { return iterator(&keys_, pos); }
+
+  void assign(vector<key_type> &&keys) {
+    if (!sorted_unique_keys(keys.data(), keys.size(), comp_)) {
+      sort_unique_keys(keys, comp_);
+    }
+    keys_ = EytzingerArray<key_type>(std::move(keys));
+  }
+
+ public:
+  frozen_set() : keys_(), comp_() {}
+  explicit frozen_set(const key_compare &comp) : keys_(), comp_(comp) {}
+  frozen_set(std::initializer_list<value_type> const &items) : frozen_set() {
+    vector<key_type> keys;
+    for (const_reference key : items) keys.push_back(key);
+    assign(std::move(keys));
+  }
+  // Takes the keys of any range; a range that is already sorted and free
+  // of duplicates is not sorted again.
+  template <typename InputIt, typename = typename std::iterator_traits<
+                                  InputIt>::iterator_category>
+  frozen_set(InputIt first, InputIt last) : frozen_set() {
+    vector<key_type> keys;
+    for (; first != last; ++first) keys.emplace_back(*first);
+    assign(std::move(keys));
+  }
+  // Takes keys that must be sorted and unique; throws std::invalid_argument
+  // otherwise.
+  frozen_set(sorted_unique_t, vector<key_type> keys) : frozen_set() {
+    if (!sorted_unique_keys(keys.data(), keys.size(), comp_)) {
+      throw std::invalid_argument("keys are not sorted and unique");
+    }
+    keys_ = EytzingerArray<key_type>(std::move(keys));
+  }
+  template <template <typename, typename> class Tree>
+  explicit frozen_set(set<Key, Tree> &s) : frozen_set() {
+    vector<key_type> keys;
+    for (auto it = s.begin(); it != s.end(); ++it) keys.push_back(*it);
+    assign(std::move(keys));
+  }
+  frozen_set(const frozen_set &s) : keys_(s.keys_), comp_(s.comp_) {}
+  frozen_set(frozen_set &&s) noexcept : frozen_set() { swap(s); }
+  ~frozen_set() {}
+
+  frozen_set &operator=(const frozen_set &s) {
+    if (this != &s) {
+      frozen_set tmp(s);
+      swap(tmp);
+    }
+    return *this;
+  }
+  frozen_set &operator=(frozen_set &&s) noexcept {
+    if (this != &s) {
+      frozen_set tmp(std::move(s));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  iterator begin() const { return at(eytzinger_first(keys_.size())); }
+  iterator end() const { return at(0); }
+
+  bool empty() const { return keys_.size() == 0; }
+  size_type size() const { return keys_.size(); }
+  size_type max_size() const { return size_type(-1) / sizeof(key_type) / 2; }
+
+  void swap(frozen_set &other) noexcept {
+    keys_.swap(other.keys_);
+    std::swap(comp_, other.comp_);
+  }
+
+  iterator lower_bound(const Key &key) const {
+    return at(keys_.lowerBound(key, comp_));
+  }
+  iterator upper_bound(const Key &key) const {
+    return at(keys_.upperBound(key, comp_));
+  }
+  iterator find(const Key &key) const {
+    size_type pos = keys_.lowerBound(key, comp_);
+    if (pos != 0 && comp_(key, keys_[pos])) pos = 0;
+    return at(pos);
+  }
+  bool contains(const Key &key) const { return find(key) != end(); }
+  size_type count(const Key &key) const { return contains(key) ? 1 : 0; }
+};
+}  // namespace s21
+
+#endif
@@ -0,0 +1,220 @@
+#ifndef S21_INTRUSIVE_LIST_H
+#define S21_INTRUSIVE_LIST_H
+
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "s21_list.h"
+
+namespace s21 {
+// Doubly linked list of objects that carry their own links in a list_hook
+// member. The list never allocates, copies or destroys the linked objects: it
+// only rewires their hooks, so an object must outlive its membership and may
+// belong to only one list per hook at a time. Unlinked hooks hold nullptr.
+// T must be standard-layout, so that the hook sits at a fixed offset from
+// the start of every object and the object can be found from its hook.
+template <typename T, list_hook T::*Hook>
+class intrusive_list {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+ private:
+  mutable list_hook fakeNode;
+  size_type size_;
+
+  static list_hook *hookOf(reference value) { return &(value.*Hook); }
+
+  // Byte offset of Hook within T, read once from the member pointer, which
+  // GCC and Clang store as exactly that offset.
+  static std::ptrdiff_t hookOffset() {
+    static_assert(std::is_standard_layout_v<T>,
+                  "intrusive_list needs a standard-layout T");
+    static const std::ptrdiff_t offset = [] {
+      list_hook T::*member = Hook;
+      static_assert(sizeof(member) == sizeof(std::ptrdiff_t),
+                    "a pointer to data member is expected to be an offset");
+      std::ptrdiff_t res;
+      std::memcpy(&res, &member, sizeof(res));
+      return res;
+    }();
+    return offset;
+  }
+
+  static T *ownerOf(list_hook *hook) {
+    return reinterpret_cast<T *>(reinterpret_cast<unsigned char *>(hook) -
+                                 hookOffset());
+  }
+
+  static void linkBefore(list_hook *pos, list_hook *hook) {
+    hook->next_ = pos;
+    hook->prev_ = pos->prev_;
+    pos->prev_->next_ = hook;
+    pos->prev_ = hook;
+  }
+
+  static void unlink(list_hook *hook) {
+    hook->prev_->next_ = hook->next_;
+    hook->next_->prev_ = hook->prev_;
+    hook->next_ = nullptr;
+    hook->prev_ = nullptr;
+  }
+
+ public:
+  class IntrusiveListIterator {
+    list_hook *pos_;
+    friend class intrusive_list;
+
+   public:
+    IntrusiveListIterator() : pos_(nullptr) {}
+    IntrusiveListIterator(list_hook *hook) : pos_(hook) {}
+    reference operator*() { return *ownerOf(pos_); }
+    T *operator->() { return ownerOf(pos_); }
+    IntrusiveListIterator &operator++() {
+      pos_ = pos_->next_;
+      return *this;
+    }
+    IntrusiveListIterator &operator--() {
+      pos_ = pos_->prev_;
+      return *this;
+    }
+    bool operator==(const IntrusiveListIterator &other) const {
+      return pos_ == other.pos_;
+    }
+    bool operator!=(const IntrusiveListIterator &other) const {
+      return pos_ != other.pos_;
+    }
+  };
+
+  class IntrusiveListConstIterator : public IntrusiveListIterator {
+   public:
+    IntrusiveListConstIterator() : IntrusiveListIterator() {}
+    IntrusiveListConstIterator(IntrusiveListIterator iter)
+        : IntrusiveListIterator(iter) {}
+    const_reference operator*() { return IntrusiveListIterator::operator*(); }
+    const T *operator->() { return IntrusiveListIterator::operator->(); }
+  };
+
+  using iterator = IntrusiveListIterator;
+  using const_iterator = IntrusiveListConstIterator;
+
+  intrusive_list() : fakeNode{&fakeNode, &fakeNode}, size_(0) {}
+  intrusive_list(const intrusive_list &) = delete;
+  intrusive_list(intrusive_list &&l) : intrusive_list() { swap(l); }
+  ~intrusive_list() { clear(); }
+
+  intrusive_list &operator=(const intrusive_list &) = delete;
+  intrusive_list &operator=(intrusive_list &&l) {
+    if (this != &l) {
+      clear();
+      swap(l);
+    }
+    return *this;
+  }
+
+  reference front() { return *ownerOf(fakeNode.next_); }
+  reference back() { return *ownerOf(fakeNode.prev_); }
+
+  iterator begin() { return iterator(fakeNode.next_); }
+  iterator end() { return iterator(&fakeNode); }
+  const_iterator begin() const { return iterator(fakeNode.next_); }
+  const_iterator end() const { return iterator(&fakeNode); }
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type max_size() const { return std::numeric_limits<size_type>::max(); }
+
+  // Returns whether value is currently linked into some list through Hook.
+  static bool is_linked(const_reference value) {
+    return (value.*Hook).next_ != nullptr;
+  }
+
+  // Returns an iterator to a value linked into this list.
+  static iterator iterator_to(reference value) {
+    return iterator(hookOf(value));
+  }
+
+  void clear() {
+    while (!empty()) pop_front();
+  }
+
+  void push_back(reference value) { insert(end(), value); }
+  void push_front(reference value) { insert(begin(), value); }
+
+  void pop_back() {
+    if (!empty()) erase(iterator(fakeNode.prev_));
+  }
+
+  void pop_front() {
+    if (!empty()) erase(iterator(fakeNode.next_));
+  }
+
+  iterator insert(iterator pos, reference value) {
+    list_hook *hook = hookOf(value);
+    linkBefore(pos.pos_, hook);
+    size_++;
+    return iterator(hook);
+  }
+
+  // Unlinks the value at pos and returns an iterator to the value after it.
+  iterator erase(iterator pos) {
+    if (empty() || pos.pos_ == nullptr || pos.pos_ == &fakeNode) return pos;
+    iterator next(pos.pos_->next_);
+    unlink(pos.pos_);
+    size_--;
+    return next;
+  }
+
+  // Unlinks value, which must belong to this list, in O(1).
+  void erase(reference value) {
+    if (is_linked(value)) erase(iterator_to(value));
+  }
+
+  // Moves every value of other in front of pos in O(1).
+  void splice(const_iterator pos, intrusive_list &other) {
+    if (other.empty() || this == &other) return;
+    list_hook *first = other.fakeNode.next_;
+    list_hook *last = other.fakeNode.prev_;
+    first->prev_ = pos.pos_->prev_;
+    pos.pos_->prev_->next_ = first;
+    last->next_ = pos.pos_;
+    pos.pos_->prev_ = last;
+    size_ += other.size_;
+    other.fakeNode.next_ = &(other.fakeNode);
+    other.fakeNode.prev_ = &(other.fakeNode);
+    other.size_ = 0;
+  }
+
+  // Moves the single value at it from other in front of pos in O(1).
+  void splice(const_iterator pos, intrusive_list &other, const_iterator it) {
+    if (it.pos_ == pos.pos_ || it.pos_->next_ == pos.pos_) return;
+    unlink(it.pos_);
+    other.size_--;
+    linkBefore(pos.pos_, it.pos_);
+    size_++;
+  }
+
+  void swap(intrusive_list &other) {
+    if (this == &other) return;
+    intrusive_list tmp;
+    tmp.splice(tmp.end(), *this);
+    splice(end(), other);
+    other.splice(other.end(), tmp);
+  }
+
+  void reverse() {
+    list_hook *cur = &fakeNode;
+    do {
+      std::swap(cur->next_, cur->prev_);
+      cur = cur->prev_;
+    } while (cur != &fakeNode);
+  }
+};
+}  // namespace s21
+
+#endif
@@ -6,6 +6,13 @@
 #include <limits>
 
 namespace s21 {
+// Links of a circular doubly linked list. s21::list embeds it in each of its
+// nodes, s21::intrusive_list expects it as a member of the linked objects.
+struct list_hook {
+  list_hook* next_ = nullptr;
+  list_hook* prev_ = nullptr;
+};
+
 template <typename T>
 class list {
  public:
@@ -15,10 +22,7 @@ class list {
   using size_type = std::size_t;
 
  private:
-  struct BaseNode {
-    BaseNode* next_;
-    BaseNode* prev_;
-  };
+  using BaseNode = list_hook;
   struct Node : BaseNode {
     value_type value_;
   };
@@ -30,9 +34,9 @@ class list {
   list(size_type n);
   list(std::initializer_list<value_type> const& items);
   list(const list& l);
-  list(list&& l);
+  list(list&& l) noexcept;
   ~list();
-  list& operator=(list&& l);
+  list& operator=(list&& l) noexcept;
   list& operator=(const list& l);
 
   const_reference front();
@@ -130,7 +134,10 @@ list<value_type>::list(const list& l) : list() {
 }
 
 template <typename value_type>
-list<value_type>::list(list&& l) : list() {
+list<value_type>::list(list&& l) noexcept : list() {
+  // An empty source has no nodes to take over; its sentinel links to
+  // itself, not to ours.
+  if (l.empty()) return;
   fakeNode.next_ = l.fakeNode.next_;
   fakeNode.prev_ = l.fakeNode.prev_;
   l.fakeNode.next_->prev_ = &fakeNode;
@@ -149,7 +156,7 @@ list<value_type>::~list() {
 }
 
 template <typename value_type>
-list<value_type>& list<value_type>::operator=(list&& l) {
+list<value_type>& list<value_type>::operator=(list&& l) noexcept {
   if (this != &l) {
     clear();
     swap(l);
@@ -0,0 +1,261 @@
+#ifndef S21_MPMC_QUEUE_H
+#define S21_MPMC_QUEUE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <utility>
+
+#include "concurrency_utils.h"
+
+namespace s21 {
+// Bounded lock-free FIFO for any number of producer and consumer threads.
+//
+// Every slot carries a sequence number. A slot at position pos is free for the
+// producer that claims pos when its sequence equals pos, and holds a value for
+// the consumer that claims pos when its sequence equals pos + 1. Producers and
+// consumers claim positions with a CAS on tail_ and head_, which live on
+// separate cache lines, so the two sides contend only within their own group.
+//
+// The blocking push and pop spin briefly and then sleep on a condition
+// variable; the sleepers are woken only when someone is actually waiting, so
+// the try_ path never touches the mutex.
+template <typename T>
+class mpmc_queue {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+ private:
+  struct alignas(kCacheLineSize) Slot {
+    std::atomic<size_type> sequence_;
+    alignas(value_type) unsigned char storage_[sizeof(value_type)];
+    value_type *value() {
+      return std::launder(reinterpret_cast<value_type *>(storage_));
+    }
+  };
+
+  alignas(kCacheLineSize) std::atomic<size_type> tail_;
+  alignas(kCacheLineSize) std::atomic<size_type> head_;
+  alignas(kCacheLineSize) Slot *slots_;
+  size_type mask_;
+
+  alignas(kCacheLineSize) std::atomic<int> pushSleepers_;
+  std::atomic<int> popSleepers_;
+  std::mutex mutex_;
+  std::condition_variable notFull_;
+  std::condition_variable notEmpty_;
+
+  static constexpr int kSpinsBeforeSleep = 128;
+
+  // Claims the next free slot, or returns nullptr when the queue is full.
+  Slot *claimForPush() {
+    size_type pos = tail_.load(std::memory_order_relaxed);
+    for (;;) {
+      Slot *slot = &slots_[pos & mask_];
+      size_type seq = slot->sequence_.load(std::memory_order_acquire);
+      std::ptrdiff_t diff =
+          static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+      if (diff == 0) {
+        if (tail_.compare_exchange_weak(pos, pos + 1,
+                                        std::memory_order_relaxed)) {
+          return slot;
+        }
+      } else if (diff < 0) {
+        return nullptr;
+      } else {
+        pos = tail_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // Claims the oldest filled slot, or returns nullptr when the queue is empty.
+  Slot *claimForPop(size_type &claimed) {
+    size_type pos = head_.load(std::memory_order_relaxed);
+    for (;;) {
+      Slot *slot = &slots_[pos & mask_];
+      size_type seq = slot->sequence_.load(std::memory_order_acquire);
+      std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) -
+                            static_cast<std::ptrdiff_t>(pos + 1);
+      if (diff == 0) {
+        if (head_.compare_exchange_weak(pos, pos + 1,
+                                        std::memory_order_relaxed)) {
+          claimed = pos;
+          return slot;
+        }
+      } else if (diff < 0) {
+        return nullptr;
+      } else {
+        pos = head_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // Pops the oldest value into consume(value_type &) and frees its slot.
+  template <typename Consume>
+  bool tryPopWith(Consume consume) {
+    size_type pos = 0;
+    Slot *slot = claimForPop(pos);
+    if (slot == nullptr) return false;
+    consume(*slot->value());
+    slot->value()->~value_type();
+    slot->sequence_.store(pos + mask_ + 1, std::memory_order_release);
+    wakeSleepers(notFull_, pushSleepers_);
+    return true;
+  }
+
+  bool canPush() const {
+    size_type pos = tail_.load(std::memory_order_relaxed);
+    return slots_[pos & mask_].sequence_.load(std::memory_order_acquire) ==
+           pos;
+  }
+
+  bool canPop() const {
+    size_type pos = head_.load(std::memory_order_relaxed);
+    return slots_[pos & mask_].sequence_.load(std::memory_order_acquire) ==
+           pos + 1;
+  }
+
+  // The fence pairs with the one in waitFor: either the sleeper sees the slot
+  // that was just released or the releasing thread sees the sleeper.
+  void wakeSleepers(std::condition_variable &cv, std::atomic<int> &sleepers) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleepers.load(std::memory_order_relaxed) > 0) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      cv.notify_all();
+    }
+  }
+
+  // Retries attempt until it succeeds. After a short spin the thread sleeps
+  // on cv whenever ready() says that retrying is pointless.
+  template <typename Attempt, typename Ready>
+  void waitFor(std::condition_variable &cv, std::atomic<int> &sleepers,
+               Attempt attempt, Ready ready) {
+    for (int spins = 0; !attempt(); spins++) {
+      if (spins < kSpinsBeforeSleep) {
+        cpu_relax();
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(mutex_);
+      sleepers.fetch_add(1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (!ready()) cv.wait(lock);
+      sleepers.fetch_sub(1, std::memory_order_relaxed);
+    }
+  }
+
+ public:
+  // The capacity is rounded up to a power of two, and is at least two.
+  explicit mpmc_queue(size_type capacity)
+      : tail_(0),
+        head_(0),
+        mask_(round_up_to_power_of_two(capacity < 2 ? 2 : capacity) - 1),
+        pushSleepers_(0),
+        popSleepers_(0) {
+    slots_ = new Slot[mask_ + 1];
+    for (size_type i = 0; i <= mask_; i++) {
+      slots_[i].sequence_.store(i, std::memory_order_relaxed);
+    }
+  }
+  mpmc_queue(const mpmc_queue &) = delete;
+  mpmc_queue &operator=(const mpmc_queue &) = delete;
+  ~mpmc_queue() {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    for (size_type pos = head_.load(std::memory_order_relaxed); pos != tail;
+         pos++) {
+      slots_[pos & mask_].value()->~value_type();
+    }
+    delete[] slots_;
+  }
+
+  size_type capacity() const { return mask_ + 1; }
+
+  // A snapshot that may be stale by the time it is returned.
+  size_type size() const {
+    size_type head = head_.load(std::memory_order_acquire);
+    size_type tail = tail_.load(std::memory_order_acquire);
+    return tail > head ? tail - head : 0;
+  }
+  bool empty() const { return size() == 0; }
+
+  template <typename... Args>
+  bool try_emplace(Args &&...args) {
+    Slot *slot = claimForPush();
+    if (slot == nullptr) return false;
+    size_type pos = slot->sequence_.load(std::memory_order_relaxed);
+    new (slot->storage_) value_type(std::forward<Args>(args)...);
+    slot->sequence_.store(pos + 1, std::memory_order_release);
+    wakeSleepers(notEmpty_, popSleepers_);
+    return true;
+  }
+
+  bool try_push(const_reference value) { return try_emplace(value); }
+  bool try_push(value_type &&value) { return try_emplace(std::move(value)); }
+
+  bool try_pop(reference out) {
+    return tryPopWith([&out](reference value) { out = std::move(value); });
+  }
+
+  // Blocks while the queue is full.
+  void push(const_reference value) {
+    waitFor(
+        notFull_, pushSleepers_, [&] { return try_push(value); },
+        [this] { return canPush(); });
+  }
+
+  // Blocks while the queue is empty.
+  void pop(reference out) {
+    waitFor(
+        notEmpty_, popSleepers_, [&] { return try_pop(out); },
+        [this] { return canPop(); });
+  }
+
+  // Pushes values from first until n are in or the queue is full. Returns how
+  // many values were pushed.
+  template <typename InputIt>
+  size_type try_push_n(InputIt first, size_type n) {
+    size_type count = 0;
+    for (; count < n && try_push(*first); ++first) count++;
+    return count;
+  }
+
+  // Pops up to n values into out without blocking and returns how many
+  // values were popped.
+  template <typename OutputIt>
+  size_type try_pop_n(OutputIt out, size_type n) {
+    size_type count = 0;
+    auto consume = [&out](reference value) {
+      *out = std::move(value);
+      ++out;
+    };
+    while (count < n && tryPopWith(consume)) count++;
+    return count;
+  }
+
+  // Pushes all n values, blocking whenever the queue is full.
+  template <typename InputIt>
+  void push_n(InputIt first, size_type n) {
+    for (size_type i = 0; i < n; i++, ++first) push(*first);
+  }
+
+  // Blocks until at least one value is available, then pops up to n values
+  // into out. Returns how many values were popped.
+  template <typename OutputIt>
+  size_type pop_n(OutputIt out, size_type n) {
+    if (n == 0) return 0;
+    auto consume = [&out](reference value) {
+      *out = std::move(value);
+      ++out;
+    };
+    waitFor(
+        notEmpty_, popSleepers_, [&] { return tryPopWith(consume); },
+        [this] { return canPop(); });
+    return 1 + try_pop_n(out, n - 1);
+  }
+};
+}  // namespace s21
+
+#endif
@@ -3,78 +3,61 @@
 
 #include <initializer_list>
 
+#include "b_plus_tree.h"
+#include "bloom_filtered_tree.h"
 #include "red_black_tree.h"
 #include "s21_vector.h"
 
 namespace s21 {
 
-template <typename Key>
+// Tree is the backing structure, as for s21::map.
+template <typename Key, template <typename, typename> class Tree = RBTree>
 class multiset {
  private:
   using value_type = Key;
   using key_type = Key;
   using reference = value_type&;
   using const_reference = const value_type&;
-  using BinaryTree = RBTree<Key, Key>;
+  using BinaryTree = Tree<Key, Key>;
   using iterator = typename BinaryTree::iterator;
   using const_iterator = typename BinaryTree::const_iterator;
   using size_type = std::size_t;
 
-  RBTree<key_type, value_type> tree;
+  BinaryTree tree;
 
  public:
   multiset() : tree{} {}
   multiset(std::initializer_list<value_type> const& items) : multiset{} {
     for (const_reference i : items) {
-      tree.insert(i, i);
+      tree.insertMulti(i, i);
     }
   }
-  multiset(const multiset& s) : multiset() {
-    tree.root = tree.copyTree(s.tree.root);
-    tree.size = s.tree.size;
-  }
+  multiset(const multiset& s) : tree{s.tree} {}
   multiset(multiset&& s) : tree{std::move(s.tree)} {};
   ~multiset() {}
 
   multiset operator=(multiset&& s) {
-    if (tree.root != nullptr) tree.freeTree(tree.root);
-    tree.moveTree(std::move(s.tree));
+    BinaryTree tmp{std::move(s.tree)};
+    tree.swap(tmp);
     return *this;
   }
 
-  iterator begin() { return iterator(tree.minimum(tree.root), tree); }
+  iterator begin() { return tree.begin(); }
 
-  iterator end() { return iterator(nullptr, tree); }
+  iterator end() { return tree.end(); }
 
-  bool empty() { return tree.size == 0; }
-  size_type size() { return tree.size; }
+  bool empty() { return tree.getSize() == 0; }
+  size_type size() { return tree.getSize(); }
   size_type max_size() { return size_t(-1) / (sizeof(BinaryTree)) / 5; }
 
-  void clear() {
-    tree.freeTree(tree.root);
-    tree.root = nullptr;
-    tree.size = 0;
-  }
+  void clear() { tree.clear(); }
   iterator insert(const value_type& value) {
-    auto node = tree.insert(value, value);
-    iterator iter = iterator(node, tree);
-    return iter;
+    return tree.insertMulti(value, value);
   }
   void erase(iterator pos) {
-    if (pos.current != nullptr) {
-      auto node = pos.current;
-      tree.removeByNode(node);
-    }
-  }
-  void swap(multiset& other) {
-    auto tmp = other.tree.root;
-    other.tree.root = tree.root;
-    tree.root = tmp;
-
-    unsigned size_tmp = other.tree.size;
-    other.tree.size = tree.size;
-    tree.size = size_tmp;
+    if (pos != tree.end()) tree.erase(pos);
   }
+  void swap(multiset& other) { tree.swap(other.tree); }
   void merge(multiset& other) {
     for (auto iter = other.begin(); iter != other.end(); ++iter) {
       insert(*iter);
@@ -82,29 +65,22 @@ class multiset {
     other.clear();
   }
 
-  size_type count(const Key& key) {
-    return tree.count_elements_equal_to_key(tree.root, key);
+  size_type count(const Key& key) { return tree.count(key); }
+  iterator find(const Key& key) {
+    iterator iter = lower_bound(key);
+    if (iter != end() && key < *iter) return end();
+    return iter;
   }
-  iterator find(const Key& key) { return lower_bound(key); }
-  bool contains(const Key& key) { return (tree.search(key)) ? true : false; }
+  bool contains(const Key& key) { return tree.find(key) != tree.end(); }
+  // Lookup counters of the negative-lookup filter, for the BloomRBTree and
+  // BloomBPlusTree backends only.
+  bloom_filter_stats filter_stats() const { return tree.filterStats(); }
   std::pair<iterator, iterator> equal_range(const Key& key) {
     std::pair<iterator, iterator> res = {lower_bound(key), upper_bound(key)};
     return res;
   }
-  iterator lower_bound(const Key& key) {
-    auto iter = begin();
-    for (; iter != end(); ++iter) {
-      if (*iter >= key) break;
-    }
-    return iter;
-  }
-  iterator upper_bound(const Key& key) {
-    auto iter = lower_bound(key);
-    for (; iter != end(); ++iter) {
-      if (*iter > key) break;
-    }
-    return iter;
-  }
+  iterator lower_bound(const Key& key) { return tree.lowerBound(key); }
+  iterator upper_bound(const Key& key) { return tree.upperBound(key); }
 
   template <typename... Args>
   vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
@@ -0,0 +1,274 @@
+#ifndef S21_PAIRING_HEAP_H
+#define S21_PAIRING_HEAP_H
+
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "node_pool.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Addressable min-heap: top() is the least value under Compare, which suits
+// shortest-path searches. push returns a handle that stays valid until its
+// value is popped or erased, so a value can later be improved in place with
+// decrease_key.
+//
+// Every node keeps its leftmost child, its next sibling and a back link to
+// its previous sibling, or to its parent when it is the leftmost child. Two
+// heaps are linked by making the worse root the leftmost child of the better
+// one, which gives O(1) push, meld and decrease_key. pop pairs up the root's
+// children left to right and folds the pairs right to left, which is
+// O(log n) amortized. Nodes come from a node_pool owned by the heap; meld
+// adopts the other heap's pool, so no node is copied or reallocated.
+template <typename T, typename Compare = std::less<T>>
+class pairing_heap {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using value_compare = Compare;
+
+ private:
+  struct Node {
+    value_type value_;
+    Node *child_ = nullptr;
+    Node *next_ = nullptr;
+    Node *prev_ = nullptr;
+    template <typename... Args>
+    explicit Node(Args &&...args) : value_(std::forward<Args>(args)...) {}
+  };
+
+  Node *root_;
+  size_type size_;
+  value_compare comp_;
+  node_pool<Node> pool_;
+
+  // Links two detached roots and returns the new root.
+  Node *link(Node *a, Node *b) {
+    if (a == nullptr) return b;
+    if (b == nullptr) return a;
+    if (comp_(b->value_, a->value_)) std::swap(a, b);
+    b->prev_ = a;
+    b->next_ = a->child_;
+    if (a->child_ != nullptr) a->child_->prev_ = b;
+    a->child_ = b;
+    return a;
+  }
+
+  // Detaches node, together with its subtree, from its parent and siblings.
+  static void cut(Node *node) {
+    if (node->prev_->child_ == node) {
+      node->prev_->child_ = node->next_;
+    } else {
+      node->prev_->next_ = node->next_;
+    }
+    if (node->next_ != nullptr) node->next_->prev_ = node->prev_;
+    node->next_ = nullptr;
+    node->prev_ = nullptr;
+  }
+
+  // Two-pass pairing of a sibling list; returns the single resulting root.
+  Node *combine(Node *first) {
+    Node *pairs = nullptr;
+    while (first != nullptr) {
+      Node *a = first;
+      Node *b = a->next_;
+      first = b != nullptr ? b->next_ : nullptr;
+      a->next_ = a->prev_ = nullptr;
+      if (b != nullptr) b->next_ = b->prev_ = nullptr;
+      Node *pair = link(a, b);
+      pair->next_ = pairs;
+      pairs = pair;
+    }
+    Node *res = nullptr;
+    while (pairs != nullptr) {
+      Node *next = pairs->next_;
+      pairs->next_ = nullptr;
+      res = link(res, pairs);
+      pairs = next;
+    }
+    return res;
+  }
+
+  Node *insertNode(Node *node) {
+    root_ = link(root_, node);
+    size_++;
+    return node;
+  }
+
+  // Destroys every node reachable from first through child and next links.
+  void destroyAll(Node *first) {
+    vector<Node *> pending;
+    if (first != nullptr) pending.push_back(first);
+    while (!pending.empty()) {
+      Node *node = pending.back();
+      pending.pop_back();
+      if (node->child_ != nullptr) pending.push_back(node->child_);
+      if (node->next_ != nullptr) pending.push_back(node->next_);
+      pool_.destroy(node);
+    }
+  }
+
+ public:
+  class handle {
+    Node *node_;
+    friend class pairing_heap;
+    explicit handle(Node *node) : node_(node) {}
+
+   public:
+    handle() : node_(nullptr) {}
+    const_reference operator*() const { return node_->value_; }
+    const value_type *operator->() const { return &node_->value_; }
+    bool operator==(const handle &other) const { return node_ == other.node_; }
+    bool operator!=(const handle &other) const { return node_ != other.node_; }
+  };
+
+  pairing_heap() : root_(nullptr), size_(0), comp_(), pool_() {}
+  explicit pairing_heap(const value_compare &comp)
+      : root_(nullptr), size_(0), comp_(comp), pool_() {}
+
+  pairing_heap(std::initializer_list<value_type> const &items)
+      : pairing_heap() {
+    for (const_reference item : items) push(item);
+  }
+
+  // The copy has the same values but its own nodes, so handles into the
+  // original do not refer to it.
+  pairing_heap(const pairing_heap &h) : pairing_heap(h.comp_) {
+    vector<Node *> pending;
+    if (h.root_ != nullptr) pending.push_back(h.root_);
+    while (!pending.empty()) {
+      Node *node = pending.back();
+      pending.pop_back();
+      if (node->child_ != nullptr) pending.push_back(node->child_);
+      if (node->next_ != nullptr) pending.push_back(node->next_);
+      push(node->value_);
+    }
+  }
+
+  pairing_heap(pairing_heap &&h) noexcept : pairing_heap() { swap(h); }
+
+  ~pairing_heap() { destroyAll(root_); }
+
+  pairing_heap &operator=(const pairing_heap &h) {
+    if (this != &h) {
+      pairing_heap tmp(h);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  pairing_heap &operator=(pairing_heap &&h) noexcept {
+    if (this != &h) {
+      pairing_heap tmp(std::move(h));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  const_reference top() const { return root_->value_; }
+  handle top_handle() const { return handle(root_); }
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+
+  void clear() {
+    destroyAll(root_);
+    root_ = nullptr;
+    size_ = 0;
+  }
+
+  handle push(const_reference value) {
+    return handle(insertNode(pool_.create(value)));
+  }
+  handle push(value_type &&value) {
+    return handle(insertNode(pool_.create(std::move(value))));
+  }
+
+  template <typename... Args>
+  handle emplace(Args &&...args) {
+    return handle(insertNode(pool_.create(std::forward<Args>(args)...)));
+  }
+
+  void pop() {
+    if (root_ == nullptr) return;
+    Node *old = root_;
+    root_ = combine(old->child_);
+    pool_.destroy(old);
+    size_--;
+  }
+
+  // Replaces the value at h with one that is not greater under Compare in
+  // O(1). Throws std::invalid_argument if value would make it greater.
+  void decrease_key(handle h, const_reference value) {
+    Node *node = h.node_;
+    if (comp_(node->value_, value)) {
+      throw std::invalid_argument("decrease_key would increase the key");
+    }
+    node->value_ = value;
+    if (node != root_) {
+      cut(node);
+      root_ = link(root_, node);
+    }
+  }
+
+  // Replaces the value at h with any value. Improving a value costs O(1);
+  // worsening it re-pairs the node's children, O(log n) amortized.
+  void update(handle h, const_reference value) {
+    Node *node = h.node_;
+    if (!comp_(node->value_, value)) {
+      decrease_key(h, value);
+      return;
+    }
+    node->value_ = value;
+    if (node != root_) cut(node);
+    Node *children = combine(node->child_);
+    node->child_ = nullptr;
+    if (node == root_) {
+      root_ = link(node, children);
+    } else {
+      root_ = link(root_, link(node, children));
+    }
+  }
+
+  // Removes the value at h; other handles stay valid.
+  void erase(handle h) {
+    Node *node = h.node_;
+    if (node == root_) {
+      pop();
+      return;
+    }
+    cut(node);
+    root_ = link(root_, combine(node->child_));
+    pool_.destroy(node);
+    size_--;
+  }
+
+  // Moves every value of other into this heap in O(1). Handles into other
+  // now refer to values of this heap.
+  void meld(pairing_heap &other) {
+    if (this == &other) return;
+    root_ = link(root_, other.root_);
+    size_ += other.size_;
+    pool_.merge(other.pool_);
+    other.root_ = nullptr;
+    other.size_ = 0;
+  }
+
+  void swap(pairing_heap &other) noexcept {
+    std::swap(root_, other.root_);
+    std::swap(size_, other.size_);
+    std::swap(comp_, other.comp_);
+    pool_.swap(other.pool_);
+  }
+
+  template <typename... Args>
+  void insert_many(Args &&...args) {
+    (push(std::forward<Args>(args)), ...);
+  }
+};
+}  // namespace s21
+
+#endif
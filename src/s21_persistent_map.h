@@ -0,0 +1,167 @@
+#ifndef S21_PERSISTENT_MAP_H
+#define S21_PERSISTENT_MAP_H
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "persistent_tree.h"
+
+namespace s21 {
+// Immutable ordered map for tables that are published as snapshots. Every
+// change returns a new version and leaves this one as it was; the versions
+// share every subtree the change did not touch (see persistent_tree.h), so a
+// change costs O(log n) new nodes and copying a map, i.e. taking a snapshot,
+// is O(1). Versions may be read, copied and edited from any threads; only
+// writing one persistent_map object while another thread reads that same
+// object needs outside synchronization, as for std::shared_ptr.
+//
+// Batches of changes go through a transient_type, which edits the nodes it
+// owns alone in place instead of copying a path per change.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class persistent_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+
+ private:
+  struct KeyOf {
+    const key_type &operator()(const value_type &value) const {
+      return value.first;
+    }
+  };
+  using Tree = persistent_tree<value_type, key_type, KeyOf, key_compare>;
+
+  Tree tree_;
+
+  explicit persistent_map(Tree &&tree) : tree_(std::move(tree)) {}
+
+  static const T &atIn(const Tree &tree, const Key &key) {
+    const value_type *value = tree.findValue(key);
+    if (value == nullptr) {
+      throw std::out_of_range("This key is not in the map.");
+    }
+    return value->second;
+  }
+
+ public:
+  using iterator = typename Tree::iterator;
+  using const_iterator = typename Tree::iterator;
+
+  // Mutable builder for one new version. persistent() hands out the
+  // current state in O(1); later edits then copy what they share with it.
+  class transient_type {
+    friend class persistent_map;
+
+    Tree tree_;
+
+    explicit transient_type(const Tree &tree) : tree_(tree) {}
+
+   public:
+    transient_type() : tree_() {}
+
+    size_type size() const { return tree_.getSize(); }
+    bool empty() const { return tree_.getSize() == 0; }
+
+    const T &at(const Key &key) const { return atIn(tree_, key); }
+    bool contains(const Key &key) const {
+      return tree_.findValue(key) != nullptr;
+    }
+
+    bool insert(const value_type &value) {
+      return tree_.insertUnique(value.first, value);
+    }
+    bool insert(const Key &key, const T &obj) {
+      return tree_.insertUnique(key, key, obj);
+    }
+    bool insert_or_assign(const Key &key, const T &obj) {
+      return tree_.assign(key, key, obj);
+    }
+    size_type erase(const Key &key) { return tree_.erase(key); }
+    void clear() { tree_.clear(); }
+
+    persistent_map persistent() const { return persistent_map(Tree(tree_)); }
+  };
+
+  persistent_map() : tree_() {}
+  persistent_map(std::initializer_list<value_type> const &items)
+      : persistent_map() {
+    transient_type builder;
+    for (const_reference item : items) builder.insert(item);
+    tree_ = std::move(builder.tree_);
+  }
+  persistent_map(const persistent_map &m) : tree_(m.tree_) {}
+  persistent_map(persistent_map &&m) noexcept : tree_(std::move(m.tree_)) {}
+  ~persistent_map() {}
+
+  persistent_map &operator=(const persistent_map &m) {
+    tree_ = m.tree_;
+    return *this;
+  }
+  persistent_map &operator=(persistent_map &&m) noexcept {
+    tree_ = std::move(m.tree_);
+    return *this;
+  }
+
+  const T &at(const Key &key) const { return atIn(tree_, key); }
+
+  const_iterator begin() const { return tree_.begin(); }
+  const_iterator end() const { return tree_.end(); }
+
+  bool empty() const { return tree_.getSize() == 0; }
+  size_type size() const { return tree_.getSize(); }
+
+  // The editing members return the new version. When nothing changes, it
+  // is this version again and shares all of its nodes.
+  persistent_map insert(const value_type &value) const {
+    Tree res(tree_);
+    res.insertUnique(value.first, value);
+    return persistent_map(std::move(res));
+  }
+  persistent_map insert(const Key &key, const T &obj) const {
+    Tree res(tree_);
+    res.insertUnique(key, key, obj);
+    return persistent_map(std::move(res));
+  }
+  persistent_map insert_or_assign(const Key &key, const T &obj) const {
+    Tree res(tree_);
+    res.assign(key, key, obj);
+    return persistent_map(std::move(res));
+  }
+  persistent_map erase(const Key &key) const {
+    Tree res(tree_);
+    res.erase(key);
+    return persistent_map(std::move(res));
+  }
+
+  transient_type transient() const { return transient_type(tree_); }
+
+  void swap(persistent_map &other) { tree_.swap(other.tree_); }
+
+  const_iterator find(const Key &key) const { return tree_.find(key); }
+  bool contains(const Key &key) const {
+    return tree_.findValue(key) != nullptr;
+  }
+  size_type count(const Key &key) const { return contains(key) ? 1 : 0; }
+  const_iterator lower_bound(const Key &key) const {
+    return tree_.lowerBound(key);
+  }
+  const_iterator upper_bound(const Key &key) const {
+    return tree_.upperBound(key);
+  }
+
+  // Whether both maps are the same version, which is O(1) to check.
+  bool shares_root_with(const persistent_map &other) const {
+    return tree_.sameRoot(other.tree_);
+  }
+};
+}  // namespace s21
+
+#endif
@@ -0,0 +1,125 @@
+#ifndef S21_PERSISTENT_SET_H
+#define S21_PERSISTENT_SET_H
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+#include "persistent_tree.h"
+
+namespace s21 {
+// Immutable ordered set on the same shared-node tree as s21::persistent_map,
+// with the same O(1) snapshots, path-copying edits and transient_type
+// builder.
+template <typename Key, typename Compare = std::less<Key>>
+class persistent_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+
+ private:
+  struct KeyOf {
+    const key_type &operator()(const value_type &value) const {
+      return value;
+    }
+  };
+  using Tree = persistent_tree<value_type, key_type, KeyOf, key_compare>;
+
+  Tree tree_;
+
+  explicit persistent_set(Tree &&tree) : tree_(std::move(tree)) {}
+
+ public:
+  using iterator = typename Tree::iterator;
+  using const_iterator = typename Tree::iterator;
+
+  class transient_type {
+    friend class persistent_set;
+
+    Tree tree_;
+
+    explicit transient_type(const Tree &tree) : tree_(tree) {}
+
+   public:
+    transient_type() : tree_() {}
+
+    size_type size() const { return tree_.getSize(); }
+    bool empty() const { return tree_.getSize() == 0; }
+    bool contains(const Key &key) const {
+      return tree_.findValue(key) != nullptr;
+    }
+
+    bool insert(const value_type &value) {
+      return tree_.insertUnique(value, value);
+    }
+    size_type erase(const Key &key) { return tree_.erase(key); }
+    void clear() { tree_.clear(); }
+
+    persistent_set persistent() const { return persistent_set(Tree(tree_)); }
+  };
+
+  persistent_set() : tree_() {}
+  persistent_set(std::initializer_list<value_type> const &items)
+      : persistent_set() {
+    transient_type builder;
+    for (const_reference item : items) builder.insert(item);
+    tree_ = std::move(builder.tree_);
+  }
+  persistent_set(const persistent_set &s) : tree_(s.tree_) {}
+  persistent_set(persistent_set &&s) noexcept : tree_(std::move(s.tree_)) {}
+  ~persistent_set() {}
+
+  persistent_set &operator=(const persistent_set &s) {
+    tree_ = s.tree_;
+    return *this;
+  }
+  persistent_set &operator=(persistent_set &&s) noexcept {
+    tree_ = std::move(s.tree_);
+    return *this;
+  }
+
+  const_iterator begin() const { return tree_.begin(); }
+  const_iterator end() const { return tree_.end(); }
+
+  bool empty() const { return tree_.getSize() == 0; }
+  size_type size() const { return tree_.getSize(); }
+
+  persistent_set insert(const value_type &value) const {
+    Tree res(tree_);
+    res.insertUnique(value, value);
+    return persistent_set(std::move(res));
+  }
+  persistent_set erase(const Key &key) const {
+    Tree res(tree_);
+    res.erase(key);
+    return persistent_set(std::move(res));
+  }
+
+  transient_type transient() const { return transient_type(tree_); }
+
+  void swap(persistent_set &other) { tree_.swap(other.tree_); }
+
+  const_iterator find(const Key &key) const { return tree_.find(key); }
+  bool contains(const Key &key) const {
+    return tree_.findValue(key) != nullptr;
+  }
+  size_type count(const Key &key) const { return contains(key) ? 1 : 0; }
+  const_iterator lower_bound(const Key &key) const {
+    return tree_.lowerBound(key);
+  }
+  const_iterator upper_bound(const Key &key) const {
+    return tree_.upperBound(key);
+  }
+
+  bool shares_root_with(const persistent_set &other) const {
+    return tree_.sameRoot(other.tree_);
+  }
+};
+}  // namespace s21
+
+#endif
@@ -0,0 +1,181 @@
+#ifndef S21_PRIORITY_QUEUE_H
+#define S21_PRIORITY_QUEUE_H
+
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+// Heap-ordered adapter over Container, which needs operator[], back, empty,
+// size, emplace_back, pop_back and swap. top() is the greatest value under
+// Compare, as with std::priority_queue.
+//
+// The heap is Arity-ary: the children of slot i are slots Arity * i + 1 up
+// to Arity * i + Arity. A wider node makes the tree shallower, so pop moves
+// a value through fewer levels, and the Arity children it compares at each
+// level are adjacent in memory. Four children of an int fit in 16 bytes.
+template <typename T, typename Container = vector<T>,
+          typename Compare = std::less<T>, std::size_t Arity = 4>
+class priority_queue {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using container_type = Container;
+  using value_compare = Compare;
+
+  static_assert(Arity >= 2, "a heap node needs at least two children");
+
+ private:
+  container_type heap_;
+  value_compare comp_;
+
+  // Moves the value at pos towards the root while it beats its parent.
+  void siftUp(size_type pos) {
+    value_type value(std::move(heap_[pos]));
+    while (pos > 0) {
+      size_type parent = (pos - 1) / Arity;
+      if (!comp_(heap_[parent], value)) break;
+      heap_[pos] = std::move(heap_[parent]);
+      pos = parent;
+    }
+    heap_[pos] = std::move(value);
+  }
+
+  // Moves the value at pos towards the leaves while a child beats it.
+  void siftDown(size_type pos) {
+    size_type size = heap_.size();
+    value_type value(std::move(heap_[pos]));
+    for (;;) {
+      size_type first = Arity * pos + 1;
+      if (first >= size) break;
+      size_type last = first + Arity < size ? first + Arity : size;
+      size_type best = first;
+      for (size_type child = first + 1; child < last; child++) {
+        if (comp_(heap_[best], heap_[child])) best = child;
+      }
+      if (!comp_(value, heap_[best])) break;
+      heap_[pos] = std::move(heap_[best]);
+      pos = best;
+    }
+    heap_[pos] = std::move(value);
+  }
+
+  // Floyd's bottom-up construction: sifts every inner node down, starting
+  // from the last one, in O(n) total.
+  void heapify() {
+    size_type size = heap_.size();
+    if (size < 2) return;
+    for (size_type pos = (size - 2) / Arity + 1; pos-- > 0;) siftDown(pos);
+  }
+
+ public:
+  priority_queue() : heap_(), comp_() {}
+  explicit priority_queue(const value_compare &comp) : heap_(), comp_(comp) {}
+
+  priority_queue(std::initializer_list<value_type> const &items)
+      : priority_queue() {
+    push_range(items.begin(), items.end());
+  }
+
+  template <typename InputIt>
+  priority_queue(InputIt first, InputIt last,
+                 const value_compare &comp = value_compare())
+      : heap_(), comp_(comp) {
+    push_range(first, last);
+  }
+
+  priority_queue(const priority_queue &q) : heap_(q.heap_), comp_(q.comp_) {}
+  priority_queue(priority_queue &&q) noexcept
+      : heap_(std::move(q.heap_)), comp_(std::move(q.comp_)) {}
+  ~priority_queue() {}
+
+  priority_queue &operator=(const priority_queue &q) {
+    if (this != &q) {
+      heap_ = q.heap_;
+      comp_ = q.comp_;
+    }
+    return *this;
+  }
+  priority_queue &operator=(priority_queue &&q) noexcept {
+    if (this != &q) {
+      heap_ = std::move(q.heap_);
+      comp_ = std::move(q.comp_);
+    }
+    return *this;
+  }
+
+  const_reference top() { return heap_[0]; }
+  bool empty() { return heap_.empty(); }
+  size_type size() { return heap_.size(); }
+
+  void push(const_reference value) {
+    heap_.emplace_back(value);
+    siftUp(heap_.size() - 1);
+  }
+  void push(value_type &&value) {
+    heap_.emplace_back(std::move(value));
+    siftUp(heap_.size() - 1);
+  }
+
+  template <typename... Args>
+  void emplace(Args &&...args) {
+    heap_.emplace_back(std::forward<Args>(args)...);
+    siftUp(heap_.size() - 1);
+  }
+
+  void pop() {
+    if (heap_.empty()) return;
+    if (heap_.size() > 1) {
+      heap_[0] = std::move(heap_.back());
+      heap_.pop_back();
+      siftDown(0);
+    } else {
+      heap_.pop_back();
+    }
+  }
+
+  // Adds [first, last). When the range is at least as large as the heap, the
+  // whole heap is rebuilt with Floyd's method instead of sifting each value
+  // up.
+  template <typename InputIt>
+  void push_range(InputIt first, InputIt last) {
+    size_type old_size = heap_.size();
+    for (; first != last; ++first) heap_.emplace_back(*first);
+    size_type added = heap_.size() - old_size;
+    if (added >= old_size) {
+      heapify();
+    } else {
+      for (size_type pos = old_size; pos < heap_.size(); pos++) siftUp(pos);
+    }
+  }
+
+  // Moves up to n values into out, greatest first, and returns how many
+  // were moved.
+  template <typename OutputIt>
+  size_type pop_n(OutputIt out, size_type n) {
+    size_type count = 0;
+    for (; count < n && !heap_.empty(); count++) {
+      *out = std::move(heap_[0]);
+      ++out;
+      pop();
+    }
+    return count;
+  }
+
+  void swap(priority_queue &other) {
+    heap_.swap(other.heap_);
+    std::swap(comp_, other.comp_);
+  }
+
+  template <typename... Args>
+  void insert_many(Args &&...args) {
+    (push(std::forward<Args>(args)), ...);
+  }
+};
+}  // namespace s21
+
+#endif
@@ -2,20 +2,27 @@
 #define S21_QUEUE_H
 
 #include <initializer_list>
+#include <utility>
 
 #include "s21_list.h"
+#include "s21_ring_buffer.h"
 
 namespace s21 {
-template <typename T>
+// FIFO adapter over Container, which needs front, back, empty, size,
+// push_back, pop_front, swap and insert_many_back. The default ring_buffer
+// keeps the values contiguous, so push and pop allocate only on growth.
+// push_range and pop_into are available when Container provides them.
+template <typename T, typename Container = ring_buffer<T>>
 class queue {
  public:
   using value_type = T;
   using reference = T &;
   using const_reference = const T &;
   using size_type = std::size_t;
+  using container_type = Container;
 
  private:
-  list<value_type> que_;
+  container_type que_;
 
  public:
   queue() : que_() {}
@@ -25,14 +32,20 @@ class queue {
     }
   }
   queue(const queue &q) : que_(q.que_) {}
-  queue(queue &&q) : que_(std::move(q.que_)) {}
+  queue(queue &&q) noexcept : que_(std::move(q.que_)) {}
   ~queue() {}
-  queue &operator=(queue &&q) {
+  queue &operator=(const queue &q) {
     if (this != &q) {
       que_ = q.que_;
     }
     return *this;
   }
+  queue &operator=(queue &&q) noexcept {
+    if (this != &q) {
+      que_ = std::move(q.que_);
+    }
+    return *this;
+  }
 
   const_reference front() { return que_.front(); }
   const_reference back() { return que_.back(); }
@@ -44,6 +57,16 @@ class queue {
   void pop() { que_.pop_front(); }
   void swap(queue &other) { que_.swap(other.que_); }
 
+  template <typename InputIt>
+  void push_range(InputIt first, InputIt last) {
+    que_.push_range(first, last);
+  }
+
+  template <typename OutputIt>
+  size_type pop_into(OutputIt out, size_type n) {
+    return que_.pop_into(out, n);
+  }
+
   template <typename... Args>
   void insert_many_back(Args &&...args) {
     que_.insert_many_back(args...);
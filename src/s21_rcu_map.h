@@ -0,0 +1,138 @@
+#ifndef S21_RCU_MAP_H
+#define S21_RCU_MAP_H
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <mutex>
+#include <utility>
+
+#include "epoch_reclamation.h"
+#include "s21_persistent_map.h"
+
+namespace s21 {
+// Read-copy-update map for tables that are read far more often than they
+// change, such as routing tables. Readers pin their thread in the
+// epoch_domain, which costs two stores and a fence to a line of their own,
+// and then search the current version; they never write to shared memory,
+// never take a lock and never wait for a writer.
+//
+// Writers serialize on a mutex, apply a whole batch of changes to a
+// transient copy of the current version and publish the result with one
+// atomic store, so readers see either none or all of a batch. The versions
+// are persistent_maps, so a batch copies only the paths it changes instead
+// of the whole table. A replaced version is retired to the epoch_domain and
+// freed once every reader that could still see it has unpinned. Each update
+// also collects, so with no reader left a version is freed by the update
+// after the one that replaced it rather than after a batch of retires.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class rcu_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+  using snapshot_type = persistent_map<Key, T, Compare>;
+  using transient_type = typename snapshot_type::transient_type;
+
+ private:
+  std::atomic<const snapshot_type *> current_;
+  std::mutex writer_;
+
+  void publish(const snapshot_type *next) {
+    const snapshot_type *old =
+        current_.exchange(next, std::memory_order_acq_rel);
+    epoch_domain &domain = epoch_domain::instance();
+    domain.retire(const_cast<snapshot_type *>(old));
+    domain.collect();
+  }
+
+ public:
+  rcu_map() : current_(new snapshot_type()) {}
+  rcu_map(std::initializer_list<value_type> const &items)
+      : current_(new snapshot_type(items)) {}
+  rcu_map(const rcu_map &) = delete;
+  rcu_map &operator=(const rcu_map &) = delete;
+  // Not thread-safe: no reader may still be inside the map.
+  ~rcu_map() { delete current_.load(std::memory_order_relaxed); }
+
+  // Calls fn(const snapshot_type &) on the current version while pinned, so
+  // that several lookups see the same version. fn must not keep references
+  // into it; take a snapshot() for that.
+  template <typename F>
+  decltype(auto) read(F &&fn) const {
+    epoch_guard guard;
+    return fn(*current_.load(std::memory_order_acquire));
+  }
+
+  // Copy of the current version that stays valid and unchanged for as long
+  // as it lives. Costs one reference count increment.
+  snapshot_type snapshot() const {
+    return read([](const snapshot_type &version) { return version; });
+  }
+
+  size_type size() const {
+    return read([](const snapshot_type &version) { return version.size(); });
+  }
+  bool empty() const { return size() == 0; }
+
+  bool contains(const Key &key) const {
+    return read(
+        [&](const snapshot_type &version) { return version.contains(key); });
+  }
+  // Calls fn(const T &) on the value of key while pinned. Returns false,
+  // without calling fn, if key is not present.
+  template <typename F>
+  bool find_and(const Key &key, F &&fn) const {
+    return read([&](const snapshot_type &version) {
+      auto it = version.find(key);
+      if (it == version.end()) return false;
+      fn(it->second);
+      return true;
+    });
+  }
+
+  // Applies fn(transient_type &) to a private copy of the current version
+  // and publishes the result as one change, unless the batch changed
+  // nothing. Concurrent writers wait for each other; readers are never
+  // blocked.
+  template <typename F>
+  void update(F &&fn) {
+    std::lock_guard<std::mutex> lock(writer_);
+    transient_type batch =
+        current_.load(std::memory_order_relaxed)->transient();
+    fn(batch);
+    snapshot_type next = batch.persistent();
+    if (next.shares_root_with(*current_.load(std::memory_order_relaxed))) {
+      return;
+    }
+    publish(new snapshot_type(std::move(next)));
+  }
+
+  // Batches of one.
+  bool insert(const Key &key, const T &obj) {
+    bool res = false;
+    update([&](transient_type &batch) { res = batch.insert(key, obj); });
+    return res;
+  }
+  bool insert_or_assign(const Key &key, const T &obj) {
+    bool res = false;
+    update([&](transient_type &batch) {
+      res = batch.insert_or_assign(key, obj);
+    });
+    return res;
+  }
+  size_type erase(const Key &key) {
+    size_type res = 0;
+    update([&](transient_type &batch) { res = batch.erase(key); });
+    return res;
+  }
+  void clear() {
+    update([](transient_type &batch) { batch.clear(); });
+  }
+};
+}  // namespace s21
+
+#endif
@@ -0,0 +1,226 @@
+#ifndef S21_RING_BUFFER_H
+#define S21_RING_BUFFER_H
+
+#include <array>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+// Growable circular buffer over one contiguous allocation. The capacity is
+// always zero or a power of two, so a logical index maps to a slot with a
+// mask instead of a division. Pushing at the back and popping at the front
+// are O(1) and allocate only when the buffer doubles.
+template <typename T>
+class ring_buffer {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+ private:
+  value_type *values_;
+  size_type capacity_;
+  size_type head_;
+  size_type size_;
+
+  static constexpr size_type kMinCapacity = 8;
+
+  size_type slot(size_type index) const {
+    return (head_ + index) & (capacity_ - 1);
+  }
+
+  // Moves the values into a fresh buffer of new_capacity slots so that the
+  // front lands in slot 0.
+  void reallocate(size_type new_capacity) {
+    value_type *tmp = static_cast<value_type *>(
+        ::operator new(sizeof(value_type) * new_capacity));
+    for (size_type i = 0; i < size_; i++) {
+      value_type &old = values_[slot(i)];
+      new (&tmp[i]) value_type(std::move(old));
+      old.~value_type();
+    }
+    if (values_) ::operator delete(values_);
+    values_ = tmp;
+    capacity_ = new_capacity;
+    head_ = 0;
+  }
+
+  void growFor(size_type required) {
+    if (required <= capacity_) return;
+    size_type new_capacity = capacity_ ? capacity_ : kMinCapacity;
+    while (new_capacity < required) new_capacity *= 2;
+    reallocate(new_capacity);
+  }
+
+ public:
+  ring_buffer() : values_(nullptr), capacity_(0), head_(0), size_(0) {}
+
+  ring_buffer(std::initializer_list<value_type> const &items) : ring_buffer() {
+    push_range(items.begin(), items.end());
+  }
+
+  ring_buffer(const ring_buffer &r) : ring_buffer() {
+    reserve(r.size_);
+    for (size_type i = 0; i < r.size_; i++) push_back(r[i]);
+  }
+
+  ring_buffer(ring_buffer &&r) noexcept : ring_buffer() { swap(r); }
+
+  ~ring_buffer() {
+    clear();
+    if (values_) ::operator delete(values_);
+  }
+
+  ring_buffer &operator=(const ring_buffer &r) {
+    if (this != &r) {
+      ring_buffer tmp(r);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  ring_buffer &operator=(ring_buffer &&r) noexcept {
+    if (this != &r) {
+      ring_buffer tmp(std::move(r));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  reference operator[](size_type pos) { return values_[slot(pos)]; }
+  const_reference operator[](size_type pos) const {
+    return values_[slot(pos)];
+  }
+
+  reference at(size_type pos) {
+    if (pos >= size_) throw std::out_of_range("Index out of range");
+    return (*this)[pos];
+  }
+
+  reference front() { return values_[head_]; }
+  const_reference front() const { return values_[head_]; }
+  reference back() { return values_[slot(size_ - 1)]; }
+  const_reference back() const { return values_[slot(size_ - 1)]; }
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type capacity() const { return capacity_; }
+  size_type max_size() const {
+    return size_type(-1) / sizeof(value_type) / 2;
+  }
+
+  // Makes room for at least n values; the capacity is rounded up to a power
+  // of two.
+  void reserve(size_type n) { growFor(n); }
+
+  void clear() {
+    while (size_ > 0) pop_front();
+    head_ = 0;
+  }
+
+  void push_back(const_reference value) {
+    if (size_ == capacity_) {
+      value_type copy(value);
+      growFor(size_ + 1);
+      new (&values_[slot(size_)]) value_type(std::move(copy));
+    } else {
+      new (&values_[slot(size_)]) value_type(value);
+    }
+    size_++;
+  }
+
+  void push_back(value_type &&value) {
+    if (size_ == capacity_) {
+      value_type tmp(std::move(value));
+      growFor(size_ + 1);
+      new (&values_[slot(size_)]) value_type(std::move(tmp));
+    } else {
+      new (&values_[slot(size_)]) value_type(std::move(value));
+    }
+    size_++;
+  }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    value_type *place;
+    if (size_ == capacity_) {
+      value_type tmp(std::forward<Args>(args)...);
+      growFor(size_ + 1);
+      place = &values_[slot(size_)];
+      new (place) value_type(std::move(tmp));
+    } else {
+      place = &values_[slot(size_)];
+      new (place) value_type(std::forward<Args>(args)...);
+    }
+    size_++;
+    return *place;
+  }
+
+  void pop_front() {
+    if (empty()) return;
+    values_[head_].~value_type();
+    head_ = (head_ + 1) & (capacity_ - 1);
+    size_--;
+  }
+
+  void pop_back() {
+    if (empty()) return;
+    values_[slot(size_ - 1)].~value_type();
+    size_--;
+  }
+
+  // Appends [first, last). Forward ranges grow the buffer at most once.
+  template <typename InputIt>
+  void push_range(InputIt first, InputIt last) {
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+      growFor(size_ + static_cast<size_type>(std::distance(first, last)));
+    }
+    for (; first != last; ++first) push_back(*first);
+  }
+
+  // Moves up to n values from the front into out and returns how many were
+  // moved.
+  template <typename OutputIt>
+  size_type pop_into(OutputIt out, size_type n) {
+    size_type count = n < size_ ? n : size_;
+    for (size_type i = 0; i < count; i++) {
+      value_type &value = values_[head_];
+      *out = std::move(value);
+      ++out;
+      value.~value_type();
+      head_ = (head_ + 1) & (capacity_ - 1);
+    }
+    size_ -= count;
+    return count;
+  }
+
+  void swap(ring_buffer &other) noexcept {
+    std::swap(values_, other.values_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(head_, other.head_);
+    std::swap(size_, other.size_);
+  }
+
+  // Grows at most once. If it has to, the values are built before the
+  // buffer moves, since args may refer to its elements.
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    if (size_ + sizeof...(Args) <= capacity_) {
+      (push_back(std::forward<Args>(args)), ...);
+      return;
+    }
+    std::array<value_type, sizeof...(Args)> values{
+        value_type(std::forward<Args>(args))...};
+    growFor(size_ + sizeof...(Args));
+    for (value_type &value : values) push_back(std::move(value));
+  }
+};
+}  // namespace s21
+
+#endif
@@ -0,0 +1,277 @@
+#ifndef S21_ROARING_SET_H
+#define S21_ROARING_SET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+
+#include "roaring_container.h"
+#include "s21_vector.h"
+#include "sorted_columns.h"
+
+namespace s21 {
+// Compressed set of 32-bit integers, such as user IDs, in the Roaring
+// layout. Values are split by their high 16 bits into chunks of up to 2^16;
+// each chunk stores its low 16 bits as a sorted array, a bitmap or a list
+// of runs, whichever is smallest (see roaring_container.h). Dense or
+// clustered sets cost from well under one byte to at most two bytes per
+// value, against a tree node per value in s21::set<std::uint32_t>.
+//
+// Union, intersection and difference work chunk by chunk: bitmaps are
+// combined 128 bits at a time and sorted arrays are matched eight values
+// per step with SSE2. Iteration is in increasing order. Iterators are
+// invalidated by any modification.
+class roaring_set {
+ public:
+  using key_type = std::uint32_t;
+  using value_type = std::uint32_t;
+  using size_type = std::size_t;
+
+ private:
+  using Container = roaring_container;
+
+  // High 16 bits of each chunk, sorted, and the chunks in the same order.
+  // Empty chunks are removed.
+  vector<std::uint16_t> keys_;
+  vector<Container> containers_;
+  size_type size_;
+
+  static std::uint16_t high(value_type value) {
+    return std::uint16_t(value >> 16);
+  }
+  static std::uint16_t low(value_type value) {
+    return std::uint16_t(value & 0xFFFF);
+  }
+
+  size_type chunkIndex(std::uint16_t key) const {
+    return sorted_lower_bound(keys_.data(), keys_.size(), key,
+                              std::less<std::uint16_t>());
+  }
+  bool hasChunk(size_type pos, std::uint16_t key) const {
+    return pos < keys_.size() && keys_[pos] == key;
+  }
+
+  void append(std::uint16_t key, Container &&container) {
+    if (container.empty()) return;
+    size_ += container.cardinality();
+    keys_.push_back(key);
+    containers_.emplace_back(std::move(container));
+  }
+
+  static roaring_set combine(const roaring_set &a, const roaring_set &b,
+                             roaring_op op) {
+    roaring_set res;
+    size_type i = 0;
+    size_type j = 0;
+    while (i < a.keys_.size() || j < b.keys_.size()) {
+      if (j == b.keys_.size() ||
+          (i < a.keys_.size() && a.keys_[i] < b.keys_[j])) {
+        if (op != roaring_op::intersect) {
+          res.append(a.keys_[i], Container(a.containers_[i]));
+        }
+        i++;
+      } else if (i == a.keys_.size() || b.keys_[j] < a.keys_[i]) {
+        if (op == roaring_op::unite) {
+          res.append(b.keys_[j], Container(b.containers_[j]));
+        }
+        j++;
+      } else {
+        res.append(a.keys_[i], Container::combine(a.containers_[i],
+                                                  b.containers_[j], op));
+        i++;
+        j++;
+      }
+    }
+    return res;
+  }
+
+ public:
+  class const_iterator {
+    friend class roaring_set;
+
+    const roaring_set *set_;
+    size_type chunk_;
+    Container::Cursor cursor_;
+
+    const_iterator(const roaring_set *set, size_type chunk)
+        : set_(set), chunk_(chunk), cursor_{0, 0} {
+      if (chunk_ < set_->containers_.size()) {
+        set_->containers_[chunk_].first(cursor_);
+      }
+    }
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = roaring_set::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type *;
+    using reference = value_type;
+
+    const_iterator() : set_(nullptr), chunk_(0), cursor_{0, 0} {}
+
+    value_type operator*() const {
+      return value_type(set_->keys_[chunk_]) << 16 | cursor_.value_;
+    }
+    const_iterator &operator++() {
+      if (!set_->containers_[chunk_].next(cursor_)) {
+        cursor_ = {0, 0};
+        if (++chunk_ < set_->containers_.size()) {
+          set_->containers_[chunk_].first(cursor_);
+        }
+      }
+      return *this;
+    }
+    const_iterator operator++(int) {
+      const_iterator res(*this);
+      ++*this;
+      return res;
+    }
+
+    bool operator==(const const_iterator &other) const {
+      return chunk_ == other.chunk_ && cursor_.value_ == other.cursor_.value_;
+    }
+    bool operator!=(const const_iterator &other) const {
+      return !(*this == other);
+    }
+  };
+  using iterator = const_iterator;
+
+  roaring_set() : keys_(), containers_(), size_(0) {}
+  roaring_set(std::initializer_list<value_type> const &items)
+      : roaring_set() {
+    for (value_type item : items) insert(item);
+  }
+  roaring_set(const roaring_set &s)
+      : keys_(s.keys_), containers_(s.containers_), size_(s.size_) {}
+  roaring_set(roaring_set &&s) noexcept : roaring_set() { swap(s); }
+  ~roaring_set() {}
+
+  roaring_set &operator=(const roaring_set &s) {
+    if (this != &s) {
+      roaring_set tmp(s);
+      swap(tmp);
+    }
+    return *this;
+  }
+  roaring_set &operator=(roaring_set &&s) noexcept {
+    if (this != &s) {
+      roaring_set tmp(std::move(s));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const {
+    return const_iterator(this, containers_.size());
+  }
+
+  bool empty() const { return size_ == 0; }
+  // The cardinality, kept up to date by every change.
+  size_type size() const { return size_; }
+  size_type max_size() const { return size_type(1) << 32; }
+
+  void clear() {
+    keys_.clear();
+    containers_.clear();
+    size_ = 0;
+  }
+
+  // Returns whether value was added; there is no iterator to return, since
+  // values are not stored as objects.
+  bool insert(value_type value) {
+    size_type pos = chunkIndex(high(value));
+    if (!hasChunk(pos, high(value))) {
+      column_insert(keys_, pos, high(value));
+      column_insert(containers_, pos);
+    }
+    bool res = containers_[pos].insert(low(value));
+    size_ += res;
+    return res;
+  }
+  size_type erase(value_type value) {
+    size_type pos = chunkIndex(high(value));
+    if (!hasChunk(pos, high(value))) return 0;
+    if (!containers_[pos].erase(low(value))) return 0;
+    if (containers_[pos].empty()) {
+      column_erase(keys_, pos);
+      column_erase(containers_, pos);
+    }
+    size_--;
+    return 1;
+  }
+
+  bool contains(value_type value) const {
+    size_type pos = chunkIndex(high(value));
+    return hasChunk(pos, high(value)) && containers_[pos].contains(low(value));
+  }
+  size_type count(value_type value) const { return contains(value) ? 1 : 0; }
+
+  void swap(roaring_set &other) {
+    keys_.swap(other.keys_);
+    containers_.swap(other.containers_);
+    std::swap(size_, other.size_);
+  }
+
+  // Moves every chunk whose values form few long runs to the run layout and
+  // releases spare capacity; worth calling once a set is built. Returns
+  // whether any chunk changed layout.
+  bool run_optimize() {
+    bool res = false;
+    for (Container &container : containers_) {
+      res = container.runOptimize() || res;
+    }
+    keys_.shrink_to_fit();
+    containers_.shrink_to_fit();
+    return res;
+  }
+
+  // Bytes held by the set, including its heap storage.
+  size_type memory_usage() const {
+    size_type res = sizeof(*this) + keys_.capacity() * sizeof(std::uint16_t) +
+                    (containers_.capacity() - containers_.size()) *
+                        sizeof(Container);
+    for (const Container &container : containers_) {
+      res += container.memoryUsage();
+    }
+    return res;
+  }
+
+  roaring_set &operator|=(const roaring_set &other) {
+    return *this = combine(*this, other, roaring_op::unite);
+  }
+  roaring_set &operator&=(const roaring_set &other) {
+    return *this = combine(*this, other, roaring_op::intersect);
+  }
+  roaring_set &operator-=(const roaring_set &other) {
+    return *this = combine(*this, other, roaring_op::subtract);
+  }
+  friend roaring_set operator|(const roaring_set &a, const roaring_set &b) {
+    return combine(a, b, roaring_op::unite);
+  }
+  friend roaring_set operator&(const roaring_set &a, const roaring_set &b) {
+    return combine(a, b, roaring_op::intersect);
+  }
+  friend roaring_set operator-(const roaring_set &a, const roaring_set &b) {
+    return combine(a, b, roaring_op::subtract);
+  }
+
+  // Equal values, whatever layout each chunk is in.
+  bool operator==(const roaring_set &other) const {
+    if (size_ != other.size_ || keys_.size() != other.keys_.size()) {
+      return false;
+    }
+    for (size_type i = 0; i < keys_.size(); i++) {
+      if (keys_[i] != other.keys_[i]) return false;
+      if (!(containers_[i] == other.containers_[i])) return false;
+    }
+    return true;
+  }
+  bool operator!=(const roaring_set &other) const { return !(*this == other); }
+};
+}  // namespace s21
+
+#endif
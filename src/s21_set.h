@@ -3,85 +3,61 @@
 
 #include <initializer_list>
 
+#include "b_plus_tree.h"
+#include "bloom_filtered_tree.h"
 #include "red_black_tree.h"
 #include "s21_vector.h"
 
 namespace s21 {
 
-template <typename Key>
+// Tree is the backing structure, as for s21::map.
+template <typename Key, template <typename, typename> class Tree = RBTree>
 class set {
  private:
   using value_type = Key;
   using key_type = Key;
   using reference = value_type&;
   using const_reference = const value_type&;
-  using BinaryTree = RBTree<Key, Key>;
+  using BinaryTree = Tree<Key, Key>;
   using iterator = typename BinaryTree::iterator;
   using const_iterator = typename BinaryTree::const_iterator;
   using size_type = std::size_t;
 
-  RBTree<key_type, value_type> tree;
+  BinaryTree tree;
 
  public:
   set() : tree{} {}
   set(std::initializer_list<value_type> const& items) : set{} {
     for (const_reference i : items) {
-      if (tree.search(i) == nullptr) {
-        tree.insert(i, i);
-      }
+      tree.insertUnique(i, i);
     }
   }
-  set(const set& s) : set() {
-    tree.root = tree.copyTree(s.tree.root);
-    tree.size = s.tree.size;
-  }
+  set(const set& s) : tree{s.tree} {}
   set(set&& s) : tree{std::move(s.tree)} {};
   ~set() {}
 
   set operator=(set&& s) {
-    tree.moveTree(std::move(s.tree));
+    BinaryTree tmp{std::move(s.tree)};
+    tree.swap(tmp);
     return *this;
   }
 
-  iterator begin() { return iterator(tree.minimum(tree.root), tree); }
+  iterator begin() { return tree.begin(); }
 
-  iterator end() { return iterator(nullptr, tree); }
+  iterator end() { return tree.end(); }
 
-  bool empty() { return tree.size == 0; }
-  size_type size() { return tree.size; }
+  bool empty() { return tree.getSize() == 0; }
+  size_type size() { return tree.getSize(); }
   size_type max_size() { return size_t(-1) / (sizeof(BinaryTree)) / 5; }
 
-  void clear() {
-    tree.freeTree(tree.root);
-    tree.root = nullptr;
-    tree.size = 0;
-  }
+  void clear() { tree.clear(); }
   std::pair<iterator, bool> insert(const value_type& value) {
-    bool res = false;
-    if (tree.search(value) == nullptr) {
-      res = true;
-      tree.insert(value, value);
-    }
-    iterator iter = iterator(tree.search(value), tree);
-    return std::pair<iterator, bool>(iter, res);
+    return tree.insertUnique(value, value);
   }
   void erase(iterator pos) {
-    if (pos.current != nullptr) {
-      key_type key = pos.current->key;
-      if (tree.search(key) != nullptr) {
-        tree.remove(key);
-      }
-    }
-  }
-  void swap(set& other) {
-    auto tmp = other.tree.root;
-    other.tree.root = tree.root;
-    tree.root = tmp;
-
-    unsigned size_tmp = other.tree.size;
-    other.tree.size = tree.size;
-    tree.size = size_tmp;
+    if (pos != tree.end()) tree.erase(pos);
   }
+  void swap(set& other) { tree.swap(other.tree); }
   void merge(set& other) {
     for (auto iter = other.begin(); iter != other.end(); ++iter) {
       insert(*iter);
@@ -89,8 +65,11 @@ class set {
     other.clear();
   }
 
-  iterator find(const Key& key) { return iterator(tree.search(key), tree); }
-  bool contains(const Key& key) { return (tree.search(key)) ? true : false; }
+  iterator find(const Key& key) { return tree.find(key); }
+  bool contains(const Key& key) { return tree.find(key) != tree.end(); }
+  // Lookup counters of the negative-lookup filter, for the BloomRBTree and
+  // BloomBPlusTree backends only.
+  bloom_filter_stats filter_stats() const { return tree.filterStats(); }
 
   template <typename... Args>
   vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
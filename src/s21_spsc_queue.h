@@ -0,0 +1,156 @@
+#ifndef S21_SPSC_QUEUE_H
+#define S21_SPSC_QUEUE_H
+
+#include <atomic>
+#include <new>
+#include <utility>
+
+#include "concurrency_utils.h"
+
+namespace s21 {
+// Bounded lock-free FIFO for exactly one producer thread and one consumer
+// thread. push, emplace and push_n may only be called by the producer; front,
+// pop, try_pop and pop_n only by the consumer.
+//
+// head_ and tail_ grow monotonically and are masked into the power-of-two
+// slot array. Each side keeps a private copy of the other side's index on its
+// own cache line and rereads the shared index only when the copy says the
+// queue is full (producer) or empty (consumer).
+template <typename T>
+class spsc_queue {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+ private:
+  alignas(kCacheLineSize) std::atomic<size_type> head_;
+  size_type cachedTail_;
+  alignas(kCacheLineSize) std::atomic<size_type> tail_;
+  size_type cachedHead_;
+  alignas(kCacheLineSize) value_type *values_;
+  size_type mask_;
+
+  value_type *slot(size_type index) const { return &values_[index & mask_]; }
+
+  // Number of free slots as seen by the producer. The consumer's index is
+  // reread only when the cached one shows fewer than wanted free slots.
+  size_type freeSlots(size_type tail, size_type wanted) {
+    size_type free = mask_ + 1 - (tail - cachedHead_);
+    if (free < wanted) {
+      cachedHead_ = head_.load(std::memory_order_acquire);
+      free = mask_ + 1 - (tail - cachedHead_);
+    }
+    return free;
+  }
+
+  // Number of filled slots as seen by the consumer.
+  size_type filledSlots(size_type head, size_type wanted) {
+    size_type filled = cachedTail_ - head;
+    if (filled < wanted) {
+      cachedTail_ = tail_.load(std::memory_order_acquire);
+      filled = cachedTail_ - head;
+    }
+    return filled;
+  }
+
+ public:
+  // The capacity is rounded up to a power of two.
+  explicit spsc_queue(size_type capacity)
+      : head_(0),
+        cachedTail_(0),
+        tail_(0),
+        cachedHead_(0),
+        mask_(round_up_to_power_of_two(capacity) - 1) {
+    values_ = static_cast<value_type *>(
+        ::operator new(sizeof(value_type) * (mask_ + 1)));
+  }
+  spsc_queue(const spsc_queue &) = delete;
+  spsc_queue &operator=(const spsc_queue &) = delete;
+  ~spsc_queue() {
+    while (pop()) {
+    }
+    ::operator delete(values_);
+  }
+
+  size_type capacity() const { return mask_ + 1; }
+
+  // Exact only when neither side is running concurrently.
+  size_type size() const {
+    return tail_.load(std::memory_order_acquire) -
+           head_.load(std::memory_order_acquire);
+  }
+  bool empty() const { return size() == 0; }
+
+  template <typename... Args>
+  bool emplace(Args &&...args) {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    if (freeSlots(tail, 1) == 0) return false;
+    new (slot(tail)) value_type(std::forward<Args>(args)...);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Returns false and leaves the queue untouched when it is full.
+  bool push(const_reference value) { return emplace(value); }
+  bool push(value_type &&value) { return emplace(std::move(value)); }
+
+  // Copies up to n values starting at first and publishes them with a single
+  // store. Returns how many values were pushed.
+  template <typename InputIt>
+  size_type push_n(InputIt first, size_type n) {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    size_type free = freeSlots(tail, n);
+    size_type count = n < free ? n : free;
+    for (size_type i = 0; i < count; i++, ++first) {
+      new (slot(tail + i)) value_type(*first);
+    }
+    if (count) tail_.store(tail + count, std::memory_order_release);
+    return count;
+  }
+
+  // Returns the oldest value, or nullptr when the queue is empty.
+  value_type *front() {
+    size_type head = head_.load(std::memory_order_relaxed);
+    return filledSlots(head, 1) ? slot(head) : nullptr;
+  }
+
+  // Drops the oldest value. Returns false when the queue is empty.
+  bool pop() {
+    size_type head = head_.load(std::memory_order_relaxed);
+    if (filledSlots(head, 1) == 0) return false;
+    slot(head)->~value_type();
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool try_pop(reference out) {
+    size_type head = head_.load(std::memory_order_relaxed);
+    if (filledSlots(head, 1) == 0) return false;
+    value_type *value = slot(head);
+    out = std::move(*value);
+    value->~value_type();
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Moves up to n values into out and releases their slots with a single
+  // store. Returns how many values were popped.
+  template <typename OutputIt>
+  size_type pop_n(OutputIt out, size_type n) {
+    size_type head = head_.load(std::memory_order_relaxed);
+    size_type filled = filledSlots(head, n);
+    size_type count = n < filled ? n : filled;
+    for (size_type i = 0; i < count; i++, ++out) {
+      value_type *value = slot(head + i);
+      *out = std::move(*value);
+      value->~value_type();
+    }
+    if (count) head_.store(head + count, std::memory_order_release);
+    return count;
+  }
+};
+}  // namespace s21
+
+#endif
@@ -2,20 +2,27 @@
 #define S21_STACK_H
 
 #include <initializer_list>
+#include <utility>
 
 #include "s21_list.h"
+#include "s21_vector.h"
 
 namespace s21 {
-template <typename T>
+// LIFO adapter over Container, which needs back, empty, size, push_back,
+// pop_back, swap and insert_many_back. The default vector keeps the values
+// contiguous, so push and pop allocate only on growth. reserve and emplace
+// are available when Container provides reserve and emplace_back.
+template <typename T, typename Container = vector<T>>
 class stack {
  public:
   using value_type = T;
   using reference = T &;
   using const_reference = const T &;
   using size_type = std::size_t;
+  using container_type = Container;
 
  private:
-  list<T> node_;
+  container_type node_;
 
  public:
   stack() : node_() {}
@@ -25,23 +32,45 @@ class stack {
     }
   }
   stack(const stack &s) : node_(s.node_) {}
-  stack(stack &&s) : node_(std::move(s.node_)) {}
+  stack(stack &&s) noexcept : node_(std::move(s.node_)) {}
   ~stack() {}
-  stack &operator=(stack &&s) {
+  stack &operator=(const stack &s) {
     if (this != &s) {
       node_ = s.node_;
     }
     return *this;
   }
+  stack &operator=(stack &&s) noexcept {
+    if (this != &s) {
+      node_ = std::move(s.node_);
+    }
+    return *this;
+  }
 
   const_reference top() { return node_.back(); }
   bool empty() { return node_.empty(); }
 
   size_type size() { return node_.size(); }
+  void reserve(size_type n) { node_.reserve(n); }
   void push(const_reference value) { node_.push_back(value); }
-  void pop() { node_.pop_back(); }
+  void pop() {
+    if (!node_.empty()) node_.pop_back();
+  }
   void swap(stack &other) { node_.swap(other.node_); }
 
+  template <typename... Args>
+  reference emplace(Args &&...args) {
+    return node_.emplace_back(std::forward<Args>(args)...);
+  }
+
+  // Removes the top value and returns it, moving instead of copying when
+  // Container gives mutable access to its back.
+  value_type pop_value() {
+    value_type value(std::move(node_.back()));
+    node_.pop_back();
+    return value;
+  }
+
   template <typename... Args>
   void insert_many_front(Args &&...args) {
     node_.insert_many_back(args...);
@@ -0,0 +1,221 @@
+#ifndef S21_THREAD_POOL_H
+#define S21_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "concurrency_utils.h"
+#include "s21_mpmc_queue.h"
+#include "s21_work_stealing_deque.h"
+
+namespace s21 {
+// Fixed set of worker threads that share tasks by work stealing. A task
+// submitted from a worker goes to that worker's own deque, where it is popped
+// in LIFO order while it is still hot in the cache; idle workers steal the
+// oldest tasks from the others. Tasks submitted from outside the pool go
+// through a lock-free injection queue, so no path takes a global lock.
+//
+// Workers that find nothing to do spin for a while and then sleep; they are
+// woken only when a task is submitted while somebody is asleep. An exception
+// that escapes a task terminates the program, as it would on a std::thread.
+class thread_pool {
+ public:
+  using size_type = std::size_t;
+
+ private:
+  struct Task {
+    std::function<void()> function_;
+  };
+
+  struct alignas(kCacheLineSize) Worker {
+    work_stealing_deque<Task *> deque_;
+    std::thread thread_;
+    thread_pool *pool_ = nullptr;
+    size_type index_ = 0;
+  };
+
+  Worker *workers_;
+  size_type size_;
+  mpmc_queue<Task *> injected_;
+
+  alignas(kCacheLineSize) std::atomic<size_type> queued_;
+  alignas(kCacheLineSize) std::atomic<size_type> pending_;
+  std::atomic<int> sleepers_;
+  std::atomic<bool> stopping_;
+  std::mutex mutex_;
+  std::condition_variable wakeUp_;
+  std::condition_variable idle_;
+
+  static constexpr int kSpinsBeforeSleep = 64;
+
+  static Worker *&currentWorker() {
+    static thread_local Worker *worker = nullptr;
+    return worker;
+  }
+
+  // The worker of this pool that runs on the calling thread, if any.
+  Worker *self() const {
+    Worker *worker = currentWorker();
+    return worker != nullptr && worker->pool_ == this ? worker : nullptr;
+  }
+
+  void enqueue(Task *task) {
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    queued_.fetch_add(1, std::memory_order_relaxed);
+    Worker *worker = self();
+    if (worker != nullptr) {
+      worker->deque_.push(task);
+    } else {
+      injected_.push(task);
+    }
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleepers_.load(std::memory_order_relaxed) > 0) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      wakeUp_.notify_one();
+    }
+  }
+
+  // Own deque first, then the injection queue, then the other workers.
+  Task *findTask(Worker *worker) {
+    Task *task = nullptr;
+    if (worker != nullptr && worker->deque_.pop(task)) return task;
+    if (injected_.try_pop(task)) return task;
+    size_type start = worker != nullptr ? worker->index_ + 1 : 0;
+    for (size_type i = 0; i < size_; i++) {
+      Worker &victim = workers_[(start + i) % size_];
+      if (&victim != worker && victim.deque_.steal(task)) return task;
+    }
+    return nullptr;
+  }
+
+  void execute(Task *task) {
+    queued_.fetch_sub(1, std::memory_order_relaxed);
+    task->function_();
+    delete task;
+    if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      idle_.notify_all();
+    }
+  }
+
+  void workerLoop(Worker *worker) {
+    currentWorker() = worker;
+    for (int spins = 0;;) {
+      Task *task = findTask(worker);
+      if (task != nullptr) {
+        execute(task);
+        spins = 0;
+      } else if (spins < kSpinsBeforeSleep) {
+        spins++;
+        std::this_thread::yield();
+      } else {
+        std::unique_lock<std::mutex> lock(mutex_);
+        sleepers_.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        bool stop = stopping_.load(std::memory_order_relaxed);
+        bool empty = queued_.load(std::memory_order_relaxed) == 0;
+        if (!stop && empty) wakeUp_.wait(lock);
+        sleepers_.fetch_sub(1, std::memory_order_relaxed);
+        if (stop && empty) break;
+      }
+    }
+    currentWorker() = nullptr;
+  }
+
+ public:
+  // Starts threads workers; zero means one per hardware thread.
+  explicit thread_pool(size_type threads = 0)
+      : size_(threads ? threads : std::thread::hardware_concurrency()),
+        injected_(1024),
+        queued_(0),
+        pending_(0),
+        sleepers_(0),
+        stopping_(false) {
+    if (size_ == 0) size_ = 1;
+    workers_ = new Worker[size_];
+    for (size_type i = 0; i < size_; i++) {
+      workers_[i].pool_ = this;
+      workers_[i].index_ = i;
+    }
+    for (size_type i = 0; i < size_; i++) {
+      workers_[i].thread_ = std::thread(&thread_pool::workerLoop, this,
+                                        &workers_[i]);
+    }
+  }
+  thread_pool(const thread_pool &) = delete;
+  thread_pool &operator=(const thread_pool &) = delete;
+
+  // Runs every submitted task to completion before joining the workers.
+  ~thread_pool() {
+    wait_idle();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_.store(true, std::memory_order_relaxed);
+      wakeUp_.notify_all();
+    }
+    for (size_type i = 0; i < size_; i++) workers_[i].thread_.join();
+    delete[] workers_;
+  }
+
+  size_type size() const { return size_; }
+
+  template <typename F>
+  void submit(F &&function) {
+    enqueue(new Task{std::function<void()>(std::forward<F>(function))});
+  }
+
+  // Runs one queued task on the calling thread. Returns false when no task
+  // could be found.
+  bool run_pending_task() {
+    Task *task = findTask(self());
+    if (task == nullptr) return false;
+    execute(task);
+    return true;
+  }
+
+  // Blocks until every submitted task, including the ones they submitted,
+  // has finished. Must not be called from a task.
+  void wait_idle() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this] {
+      return pending_.load(std::memory_order_acquire) == 0;
+    });
+  }
+};
+
+// Fork-join scope for recursive parallel jobs. wait() does not block the
+// calling worker: it runs queued tasks of the pool until the group's own
+// tasks are done, so nested groups cannot starve the pool of threads.
+class task_group {
+ public:
+  explicit task_group(thread_pool &pool) : pool_(pool), pending_(0) {}
+  task_group(const task_group &) = delete;
+  task_group &operator=(const task_group &) = delete;
+  ~task_group() { wait(); }
+
+  template <typename F>
+  void run(F &&function) {
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    pool_.submit([this, function = std::forward<F>(function)]() mutable {
+      function();
+      pending_.fetch_sub(1, std::memory_order_release);
+    });
+  }
+
+  void wait() {
+    while (pending_.load(std::memory_order_acquire) != 0) {
+      if (!pool_.run_pending_task()) std::this_thread::yield();
+    }
+  }
+
+ private:
+  thread_pool &pool_;
+  std::atomic<std::size_t> pending_;
+};
+}  // namespace s21
+
+#endif
@@ -0,0 +1,167 @@
+#ifndef S21_UNORDERED_MAP_H
+#define S21_UNORDERED_MAP_H
+
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "flat_hash_table.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Hash map with the interface of s21::map, minus the ordering. Values live
+// in one flat array probed sixteen slots at a time (see flat_hash_table.h),
+// so a lookup costs one hash, usually one group of control bytes and one key
+// comparison, without chasing any pointers.
+//
+// Unlike node-based maps, inserting and erasing may move the stored pairs:
+// both invalidate iterators and references into the map.
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class unordered_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+
+ private:
+  struct KeyOf {
+    const key_type &operator()(const value_type &value) const {
+      return value.first;
+    }
+  };
+  using Table =
+      flat_hash_table<value_type, key_type, KeyOf, hasher, key_equal>;
+
+  Table table_;
+
+  template <typename... Args>
+  std::pair<size_type, bool> tryEmplace(const key_type &key, Args &&...args) {
+    return table_.insert_unique(key, [&](value_type *place) {
+      new (place)
+          value_type(std::piecewise_construct, std::forward_as_tuple(key),
+                     std::forward_as_tuple(std::forward<Args>(args)...));
+    });
+  }
+
+ public:
+  using iterator = typename Table::iterator;
+  using const_iterator = typename Table::const_iterator;
+
+  unordered_map() : table_() {}
+  unordered_map(std::initializer_list<value_type> const &items)
+      : unordered_map() {
+    table_.reserve(items.size());
+    for (const_reference item : items) insert(item);
+  }
+  unordered_map(const unordered_map &m) : table_(m.table_) {}
+  unordered_map(unordered_map &&m) noexcept : table_(std::move(m.table_)) {}
+  ~unordered_map() {}
+
+  unordered_map &operator=(const unordered_map &m) {
+    table_ = m.table_;
+    return *this;
+  }
+  unordered_map &operator=(unordered_map &&m) noexcept {
+    table_ = std::move(m.table_);
+    return *this;
+  }
+
+  T &at(const Key &key) {
+    size_type pos = table_.find(key);
+    if (pos == Table::npos) {
+      throw std::out_of_range("This key is not in the map.");
+    }
+    return table_.at_slot(pos).second;
+  }
+  const T &at(const Key &key) const {
+    return const_cast<unordered_map *>(this)->at(key);
+  }
+  T &operator[](const Key &key) {
+    return table_.at_slot(tryEmplace(key).first).second;
+  }
+
+  iterator begin() { return table_.begin(); }
+  iterator end() { return table_.end(); }
+  const_iterator begin() const { return table_.begin(); }
+  const_iterator end() const { return table_.end(); }
+
+  bool empty() const { return table_.empty(); }
+  size_type size() const { return table_.size(); }
+  size_type max_size() const { return table_.max_size(); }
+
+  void clear() { table_.clear(); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    auto res = tryEmplace(value.first, value.second);
+    return {table_.iteratorAt(res.first), res.second};
+  }
+  std::pair<iterator, bool> insert(const Key &key, const T &obj) {
+    auto res = tryEmplace(key, obj);
+    return {table_.iteratorAt(res.first), res.second};
+  }
+  // Sizes the table for the whole range before inserting it.
+  template <typename InputIt, typename = typename std::iterator_traits<
+                                  InputIt>::iterator_category>
+  void insert(InputIt first, InputIt last) {
+    table_.reserve_range(first, last);
+    for (; first != last; ++first) insert(*first);
+  }
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj) {
+    auto res = tryEmplace(key, obj);
+    if (!res.second) table_.at_slot(res.first).second = obj;
+    return {table_.iteratorAt(res.first), res.second};
+  }
+
+  void erase(iterator pos) {
+    if (pos != end()) table_.erase(pos);
+  }
+  size_type erase(const Key &key) { return table_.erase_key(key); }
+
+  void swap(unordered_map &other) { table_.swap(other.table_); }
+
+  // Inserts every pair of other whose key is not present yet, then empties
+  // other, as s21::map::merge does.
+  void merge(unordered_map &other) {
+    if (this == &other) return;
+    table_.reserve(size() + other.size());
+    for (const_reference value : other) insert(value);
+    other.clear();
+  }
+
+  iterator find(const Key &key) { return table_.iteratorAt(table_.find(key)); }
+  bool contains(const Key &key) const {
+    return table_.find(key) != Table::npos;
+  }
+
+  size_type bucket_count() const { return table_.capacity(); }
+  float load_factor() const { return table_.load_factor(); }
+  float max_load_factor() const { return table_.max_load_factor(); }
+  // Sets the load factor above which the table doubles; 7/8 by default and
+  // at most 15/16. Lower values trade memory for shorter probe runs.
+  void max_load_factor(float ml) { table_.max_load_factor(ml); }
+  void reserve(size_type count) { table_.reserve(count); }
+  void rehash(size_type count) { table_.rehash(count); }
+
+  // The table is sized for every argument up front, so no insertion here
+  // rehashes and all of the returned iterators stay valid.
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    vector<std::pair<iterator, bool>> res;
+    table_.reserve(size() + sizeof...(Args));
+    (res.push_back(insert(std::forward<Args>(args))), ...);
+    return res;
+  }
+};
+}  // namespace s21
+
+#endif
@@ -0,0 +1,136 @@
+#ifndef S21_UNORDERED_MULTISET_H
+#define S21_UNORDERED_MULTISET_H
+
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+
+#include "flat_hash_table.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Hashed counterpart of s21::multiset on the same flat table as
+// unordered_set. Every inserted value takes its own slot, so equal values
+// that are still distinguishable are all kept. Equal values share a probe
+// run but need not be adjacent in it, so there is no equal_range; count and
+// erase(key) scan the run instead. Iterators are read-only, and inserting
+// or erasing invalidates them.
+template <typename Key, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class unordered_multiset {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+
+ private:
+  struct KeyOf {
+    const key_type &operator()(const value_type &value) const {
+      return value;
+    }
+  };
+  using Table =
+      flat_hash_table<value_type, key_type, KeyOf, hasher, key_equal>;
+
+  Table table_;
+
+ public:
+  using iterator = typename Table::const_iterator;
+  using const_iterator = typename Table::const_iterator;
+
+  unordered_multiset() : table_() {}
+  unordered_multiset(std::initializer_list<value_type> const &items)
+      : unordered_multiset() {
+    insert(items.begin(), items.end());
+  }
+  template <typename InputIt, typename = typename std::iterator_traits<
+                                  InputIt>::iterator_category>
+  unordered_multiset(InputIt first, InputIt last) : unordered_multiset() {
+    insert(first, last);
+  }
+  unordered_multiset(const unordered_multiset &s) : table_(s.table_) {}
+  unordered_multiset(unordered_multiset &&s) noexcept
+      : table_(std::move(s.table_)) {}
+  ~unordered_multiset() {}
+
+  unordered_multiset &operator=(const unordered_multiset &s) {
+    table_ = s.table_;
+    return *this;
+  }
+  unordered_multiset &operator=(unordered_multiset &&s) noexcept {
+    table_ = std::move(s.table_);
+    return *this;
+  }
+
+  iterator begin() const { return table_.begin(); }
+  iterator end() const { return table_.end(); }
+
+  bool empty() const { return table_.empty(); }
+  size_type size() const { return table_.size(); }
+  size_type max_size() const { return table_.max_size(); }
+
+  void clear() { table_.clear(); }
+
+  iterator insert(const value_type &value) {
+    return table_.iteratorAt(table_.insert_multi(value));
+  }
+  iterator insert(value_type &&value) {
+    return table_.iteratorAt(table_.insert_multi(std::move(value)));
+  }
+  // Sizes the table for the whole range before inserting it.
+  template <typename InputIt, typename = typename std::iterator_traits<
+                                  InputIt>::iterator_category>
+  void insert(InputIt first, InputIt last) {
+    table_.reserve_range(first, last);
+    for (; first != last; ++first) table_.insert_multi(*first);
+  }
+
+  // Removes the one value at pos.
+  void erase(iterator pos) {
+    if (pos != end()) table_.erase(pos);
+  }
+  // Removes every value equal to key and returns how many there were.
+  size_type erase(const Key &key) { return table_.erase_key(key); }
+
+  void swap(unordered_multiset &other) { table_.swap(other.table_); }
+
+  // Moves every value of other into this multiset, keeping duplicates.
+  void merge(unordered_multiset &other) {
+    if (this == &other) return;
+    insert(other.begin(), other.end());
+    other.clear();
+  }
+
+  size_type count(const Key &key) const { return table_.count(key); }
+  iterator find(const Key &key) const {
+    return const_cast<Table &>(table_).iteratorAt(table_.find(key));
+  }
+  bool contains(const Key &key) const {
+    return table_.find(key) != Table::npos;
+  }
+
+  size_type bucket_count() const { return table_.capacity(); }
+  float load_factor() const { return table_.load_factor(); }
+  float max_load_factor() const { return table_.max_load_factor(); }
+  void max_load_factor(float ml) { table_.max_load_factor(ml); }
+  void reserve(size_type count) { table_.reserve(count); }
+  void rehash(size_type count) { table_.rehash(count); }
+
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    vector<std::pair<iterator, bool>> res;
+    table_.reserve(size() + sizeof...(Args));
+    (res.push_back(
+         std::pair<iterator, bool>(insert(std::forward<Args>(args)), true)),
+     ...);
+    return res;
+  }
+};
+}  // namespace s21
+
+#endif
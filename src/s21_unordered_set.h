@@ -0,0 +1,136 @@
+#ifndef S21_UNORDERED_SET_H
+#define S21_UNORDERED_SET_H
+
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <utility>
+
+#include "flat_hash_table.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Hashed counterpart of s21::set on the flat table of unordered_map: contains
+// hashes the key and usually inspects a single group of sixteen control
+// bytes instead of walking a tree. Iterators are read-only, and inserting or
+// erasing invalidates them.
+template <typename Key, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class unordered_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+
+ private:
+  struct KeyOf {
+    const key_type &operator()(const value_type &value) const {
+      return value;
+    }
+  };
+  using Table =
+      flat_hash_table<value_type, key_type, KeyOf, hasher, key_equal>;
+
+  Table table_;
+
+ public:
+  using iterator = typename Table::const_iterator;
+  using const_iterator = typename Table::const_iterator;
+
+  unordered_set() : table_() {}
+  unordered_set(std::initializer_list<value_type> const &items)
+      : unordered_set() {
+    insert(items.begin(), items.end());
+  }
+  template <typename InputIt, typename = typename std::iterator_traits<
+                                  InputIt>::iterator_category>
+  unordered_set(InputIt first, InputIt last) : unordered_set() {
+    insert(first, last);
+  }
+  unordered_set(const unordered_set &s) : table_(s.table_) {}
+  unordered_set(unordered_set &&s) noexcept : table_(std::move(s.table_)) {}
+  ~unordered_set() {}
+
+  unordered_set &operator=(const unordered_set &s) {
+    table_ = s.table_;
+    return *this;
+  }
+  unordered_set &operator=(unordered_set &&s) noexcept {
+    table_ = std::move(s.table_);
+    return *this;
+  }
+
+  iterator begin() const { return table_.begin(); }
+  iterator end() const { return table_.end(); }
+
+  bool empty() const { return table_.empty(); }
+  size_type size() const { return table_.size(); }
+  size_type max_size() const { return table_.max_size(); }
+
+  void clear() { table_.clear(); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    auto res = table_.insert_unique(
+        value, [&value](value_type *place) { new (place) value_type(value); });
+    return {table_.iteratorAt(res.first), res.second};
+  }
+  std::pair<iterator, bool> insert(value_type &&value) {
+    auto res = table_.insert_unique(value, [&value](value_type *place) {
+      new (place) value_type(std::move(value));
+    });
+    return {table_.iteratorAt(res.first), res.second};
+  }
+  // Sizes the table for the whole range before inserting it.
+  template <typename InputIt, typename = typename std::iterator_traits<
+                                  InputIt>::iterator_category>
+  void insert(InputIt first, InputIt last) {
+    table_.reserve_range(first, last);
+    for (; first != last; ++first) insert(*first);
+  }
+
+  void erase(iterator pos) {
+    if (pos != end()) table_.erase(pos);
+  }
+  size_type erase(const Key &key) { return table_.erase_key(key); }
+
+  void swap(unordered_set &other) { table_.swap(other.table_); }
+
+  // Inserts every key of other that is not present yet, then empties other,
+  // as s21::set::merge does.
+  void merge(unordered_set &other) {
+    if (this == &other) return;
+    insert(other.begin(), other.end());
+    other.clear();
+  }
+
+  iterator find(const Key &key) const {
+    return const_cast<Table &>(table_).iteratorAt(table_.find(key));
+  }
+  bool contains(const Key &key) const {
+    return table_.find(key) != Table::npos;
+  }
+  size_type count(const Key &key) const { return contains(key) ? 1 : 0; }
+
+  size_type bucket_count() const { return table_.capacity(); }
+  float load_factor() const { return table_.load_factor(); }
+  float max_load_factor() const { return table_.max_load_factor(); }
+  void max_load_factor(float ml) { table_.max_load_factor(ml); }
+  void reserve(size_type count) { table_.reserve(count); }
+  void rehash(size_type count) { table_.rehash(count); }
+
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    vector<std::pair<iterator, bool>> res;
+    table_.reserve(size() + sizeof...(Args));
+    (res.push_back(insert(std::forward<Args>(args))), ...);
+    return res;
+  }
+};
+}  // namespace s21
+
+#endif
@@ -0,0 +1,425 @@
+#ifndef S21_UNROLLED_LIST_H
+#define S21_UNROLLED_LIST_H
+
+#include <algorithm>
+#include <initializer_list>
+#include <limits>
+#include <new>
+#include <utility>
+
+namespace s21 {
+// Doubly linked list that stores up to NodeCapacity values in every node, so
+// a traversal touches one allocation per NodeCapacity elements instead of one
+// per element. The default capacity keeps the value storage of a node within
+// four cache lines.
+//
+// insert, erase and the push/pop family may move values inside a node or
+// between neighbouring nodes, so they invalidate iterators into those nodes.
+template <typename T,
+          std::size_t NodeCapacity = (sizeof(T) >= 64 ? 4 : 256 / sizeof(T))>
+class unrolled_list {
+  static_assert(NodeCapacity >= 2, "A node must hold at least two values");
+
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = std::size_t;
+
+ private:
+  struct BaseNode {
+    BaseNode* next_;
+    BaseNode* prev_;
+    size_type count_;
+  };
+  struct Node : BaseNode {
+    alignas(value_type) unsigned char storage_[sizeof(value_type) *
+                                               NodeCapacity];
+    value_type* values() {
+      return std::launder(reinterpret_cast<value_type*>(storage_));
+    }
+  };
+  mutable BaseNode fakeNode;
+  size_type size_;
+
+ public:
+  class UnrolledListIterator {
+    BaseNode* node_;
+    size_type index_;
+    friend class unrolled_list;
+
+   public:
+    UnrolledListIterator() : node_(nullptr), index_(0) {}
+    UnrolledListIterator(BaseNode* node, size_type index)
+        : node_(node), index_(index) {}
+    reference operator*() {
+      return static_cast<Node*>(node_)->values()[index_];
+    }
+    UnrolledListIterator& operator++() {
+      if (++index_ >= node_->count_) {
+        node_ = node_->next_;
+        index_ = 0;
+      }
+      return *this;
+    }
+    UnrolledListIterator& operator--() {
+      if (index_ == 0) {
+        node_ = node_->prev_;
+        index_ = node_->count_ ? node_->count_ - 1 : 0;
+      } else {
+        --index_;
+      }
+      return *this;
+    }
+    bool operator==(const UnrolledListIterator& other) const {
+      return node_ == other.node_ && index_ == other.index_;
+    }
+    bool operator!=(const UnrolledListIterator& other) const {
+      return !(*this == other);
+    }
+  };
+
+  class UnrolledListConstIterator : public UnrolledListIterator {
+   public:
+    UnrolledListConstIterator() : UnrolledListIterator() {}
+    UnrolledListConstIterator(UnrolledListIterator iter)
+        : UnrolledListIterator(iter) {}
+    const_reference operator*() { return UnrolledListIterator::operator*(); }
+  };
+
+  using iterator = UnrolledListIterator;
+  using const_iterator = UnrolledListConstIterator;
+
+  unrolled_list() : fakeNode{&fakeNode, &fakeNode, 0}, size_(0) {}
+
+  unrolled_list(size_type n) : unrolled_list() {
+    for (size_type i = 0; i < n; i++) push_back(value_type());
+  }
+
+  unrolled_list(std::initializer_list<value_type> const& items)
+      : unrolled_list() {
+    for (auto i = items.begin(); i != items.end(); ++i) push_back(*i);
+  }
+
+  unrolled_list(const unrolled_list& l) : unrolled_list() {
+    for (auto i = l.begin(); i != l.end(); ++i) push_back(*i);
+  }
+
+  unrolled_list(unrolled_list&& l) : unrolled_list() { takeNodes(l); }
+
+  ~unrolled_list() { clear(); }
+
+  unrolled_list& operator=(unrolled_list&& l) {
+    if (this != &l) {
+      clear();
+      takeNodes(l);
+    }
+    return *this;
+  }
+
+  unrolled_list& operator=(const unrolled_list& l) {
+    if (this != &l) {
+      unrolled_list tmp(l);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  const_reference front() { return valueAt(fakeNode.next_, 0); }
+  const_reference back() {
+    return valueAt(fakeNode.prev_, fakeNode.prev_->count_ - 1);
+  }
+
+  iterator begin() { return iterator(fakeNode.next_, 0); }
+  iterator end() { return iterator(&fakeNode, 0); }
+  const_iterator begin() const { return iterator(fakeNode.next_, 0); }
+  const_iterator end() const { return iterator(&fakeNode, 0); }
+
+  bool empty() const { return size_ == 0; }
+  size_type size() { return size_; }
+  size_type max_size() {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type) / 2;
+  }
+
+  void clear() {
+    while (fakeNode.next_ != &fakeNode) destroyNode(fakeNode.next_);
+  }
+
+  void push_back(const_reference value) {
+    BaseNode* last = fakeNode.prev_;
+    if (last == &fakeNode || last->count_ == NodeCapacity) {
+      last = createNode(&fakeNode);
+    }
+    placeValue(last, last->count_, value);
+  }
+
+  void pop_back() {
+    if (empty()) return;
+    BaseNode* last = fakeNode.prev_;
+    removeValue(last, last->count_ - 1);
+  }
+
+  void push_front(const_reference value) {
+    BaseNode* first = fakeNode.next_;
+    if (first == &fakeNode || first->count_ == NodeCapacity) {
+      first = createNode(fakeNode.next_);
+    }
+    placeValue(first, 0, value);
+  }
+
+  void pop_front() {
+    if (empty()) return;
+    removeValue(fakeNode.next_, 0);
+  }
+
+  iterator insert(iterator pos, const_reference value) {
+    BaseNode* node = pos.node_;
+    size_type index = pos.index_;
+    if (node == &fakeNode) {
+      push_back(value);
+      return iterator(fakeNode.prev_, fakeNode.prev_->count_ - 1);
+    }
+    if (index == 0 && node->prev_ != &fakeNode &&
+        node->prev_->count_ < NodeCapacity) {
+      node = node->prev_;
+      index = node->count_;
+    } else if (node->count_ == NodeCapacity) {
+      size_type half = NodeCapacity / 2;
+      splitNode(node, half);
+      if (index > half) {
+        node = node->next_;
+        index -= half;
+      }
+    }
+    placeValue(node, index, value);
+    return iterator(node, index);
+  }
+
+  void erase(iterator pos) {
+    if (empty() || pos.node_ == nullptr || pos.node_ == &fakeNode) return;
+    removeValue(pos.node_, pos.index_);
+  }
+
+  // Relinks the nodes of other in front of pos without copying any value. If
+  // pos points into the middle of a node, that node is split first.
+  void splice(const_iterator pos, unrolled_list& other) {
+    if (other.empty() || this == &other) return;
+    BaseNode* node = pos.node_;
+    if (pos.index_ > 0) {
+      splitNode(node, pos.index_);
+      node = node->next_;
+    }
+    BaseNode* first = other.fakeNode.next_;
+    BaseNode* last = other.fakeNode.prev_;
+    first->prev_ = node->prev_;
+    node->prev_->next_ = first;
+    last->next_ = node;
+    node->prev_ = last;
+    size_ += other.size_;
+    other.fakeNode.next_ = &(other.fakeNode);
+    other.fakeNode.prev_ = &(other.fakeNode);
+    other.size_ = 0;
+  }
+
+  void swap(unrolled_list& other) {
+    if (this == &other) return;
+    unrolled_list tmp;
+    tmp.takeNodes(*this);
+    takeNodes(other);
+    other.takeNodes(tmp);
+  }
+
+  void merge(unrolled_list& other) {
+    if (other.empty() || this == &other) return;
+    unrolled_list result;
+    iterator iter1 = begin();
+    iterator iter2 = other.begin();
+    while (iter1 != end() && iter2 != other.end()) {
+      if (*iter2 < *iter1) {
+        result.push_back(*iter2);
+        ++iter2;
+      } else {
+        result.push_back(*iter1);
+        ++iter1;
+      }
+    }
+    for (; iter1 != end(); ++iter1) result.push_back(*iter1);
+    for (; iter2 != other.end(); ++iter2) result.push_back(*iter2);
+    clear();
+    other.clear();
+    takeNodes(result);
+  }
+
+  void reverse() {
+    BaseNode* cur = &fakeNode;
+    do {
+      std::swap(cur->next_, cur->prev_);
+      if (cur != &fakeNode) {
+        value_type* values = static_cast<Node*>(cur)->values();
+        std::reverse(values, values + cur->count_);
+      }
+      cur = cur->prev_;
+    } while (cur != &fakeNode);
+  }
+
+  // Compacts the kept values towards the front in a single pass and frees
+  // the nodes left empty at the tail.
+  void unique() {
+    if (size_ < 2) return;
+    BaseNode* node = fakeNode.next_;
+    size_type index = 0;
+    iterator read = begin();
+    for (++read; read != end(); ++read) {
+      if (!(*read == valueAt(node, index))) {
+        if (++index == node->count_) {
+          node = node->next_;
+          index = 0;
+        }
+        if (node != read.node_ || index != read.index_) {
+          valueAt(node, index) = std::move(*read);
+        }
+      }
+    }
+    truncateAfter(node, index);
+  }
+
+  void sort() {
+    if (size_ < 2) return;
+    value_type* buffer =
+        static_cast<value_type*>(::operator new(sizeof(value_type) * size_));
+    size_type n = 0;
+    for (iterator i = begin(); i != end(); ++i) {
+      new (&buffer[n++]) value_type(std::move(*i));
+    }
+    std::sort(buffer, buffer + n);
+    n = 0;
+    for (iterator i = begin(); i != end(); ++i, ++n) {
+      *i = std::move(buffer[n]);
+      buffer[n].~value_type();
+    }
+    ::operator delete(buffer);
+  }
+
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args&&... args) {
+    iterator cur = pos;
+    ((cur = insert(cur, std::forward<Args>(args)), ++cur), ...);
+    return cur;
+  }
+
+  template <typename... Args>
+  void insert_many_back(Args&&... args) {
+    (push_back(std::forward<Args>(args)), ...);
+  }
+
+  template <typename... Args>
+  void insert_many_front(Args&&... args) {
+    (push_front(std::forward<Args>(args)), ...);
+  }
+
+ private:
+  static value_type& valueAt(BaseNode* node, size_type index) {
+    return static_cast<Node*>(node)->values()[index];
+  }
+
+  // Allocates an empty node and links it in front of before.
+  BaseNode* createNode(BaseNode* before) {
+    Node* node = new Node;
+    node->count_ = 0;
+    node->next_ = before;
+    node->prev_ = before->prev_;
+    before->prev_->next_ = node;
+    before->prev_ = node;
+    return node;
+  }
+
+  void destroyNode(BaseNode* node) {
+    value_type* values = static_cast<Node*>(node)->values();
+    for (size_type i = 0; i < node->count_; i++) values[i].~value_type();
+    size_ -= node->count_;
+    node->prev_->next_ = node->next_;
+    node->next_->prev_ = node->prev_;
+    delete static_cast<Node*>(node);
+  }
+
+  // Moves the values [index, count_) of node into a new node after it.
+  void splitNode(BaseNode* node, size_type index) {
+    BaseNode* tail = createNode(node->next_);
+    value_type* from = static_cast<Node*>(node)->values();
+    value_type* to = static_cast<Node*>(tail)->values();
+    for (size_type i = index; i < node->count_; i++) {
+      new (&to[i - index]) value_type(std::move(from[i]));
+      from[i].~value_type();
+    }
+    tail->count_ = node->count_ - index;
+    node->count_ = index;
+  }
+
+  // Shifts the values of a non-full node to open a slot at index.
+  void placeValue(BaseNode* node, size_type index, const_reference value) {
+    value_type* values = static_cast<Node*>(node)->values();
+    if (index == node->count_) {
+      new (&values[index]) value_type(value);
+    } else {
+      value_type copy(value);
+      new (&values[node->count_])
+          value_type(std::move(values[node->count_ - 1]));
+      std::move_backward(values + index, values + node->count_ - 1,
+                         values + node->count_);
+      values[index] = std::move(copy);
+    }
+    node->count_++;
+    size_++;
+  }
+
+  // Removes one value and keeps the nodes at least half full by folding an
+  // underfull node into its successor when both fit into one node.
+  void removeValue(BaseNode* node, size_type index) {
+    value_type* values = static_cast<Node*>(node)->values();
+    std::move(values + index + 1, values + node->count_, values + index);
+    values[node->count_ - 1].~value_type();
+    node->count_--;
+    size_--;
+    BaseNode* next = node->next_;
+    if (node->count_ == 0) {
+      destroyNode(node);
+    } else if (node->count_ < NodeCapacity / 2 && next != &fakeNode &&
+               node->count_ + next->count_ <= NodeCapacity) {
+      value_type* from = static_cast<Node*>(next)->values();
+      for (size_type i = 0; i < next->count_; i++) {
+        new (&values[node->count_ + i]) value_type(std::move(from[i]));
+      }
+      node->count_ += next->count_;
+      size_ += next->count_;
+      destroyNode(next);
+    }
+  }
+
+  // Drops every value that follows position index of node.
+  void truncateAfter(BaseNode* node, size_type index) {
+    value_type* values = static_cast<Node*>(node)->values();
+    for (size_type i = index + 1; i < node->count_; i++) {
+      values[i].~value_type();
+    }
+    size_ -= node->count_ - index - 1;
+    node->count_ = index + 1;
+    while (node->next_ != &fakeNode) destroyNode(node->next_);
+  }
+
+  // Takes over the node chain of other; this list must be empty.
+  void takeNodes(unrolled_list& other) {
+    if (!other.empty()) {
+      fakeNode.next_ = other.fakeNode.next_;
+      fakeNode.prev_ = other.fakeNode.prev_;
+      fakeNode.next_->prev_ = &fakeNode;
+      fakeNode.prev_->next_ = &fakeNode;
+      other.fakeNode.next_ = &(other.fakeNode);
+      other.fakeNode.prev_ = &(other.fakeNode);
+    }
+    size_ = other.size_;
+    other.size_ = 0;
+  }
+};
+}  // namespace s21
+
+#endif
@@ -1,7 +1,11 @@
 #ifndef CPP2_S21_CONTAINERS_VECTOR
 #define CPP2_S21_CONTAINERS_VECTOR
 
+#include <algorithm>
 #include <initializer_list>
+#include <new>
+#include <stdexcept>
+#include <utility>
 
 namespace s21 {
 
@@ -19,6 +23,45 @@ class vector {
   size_type size_vector;
   size_type capacity_vector;
 
+  // Moves the values into tmp, a new allocation of new_capacity elements,
+  // and frees the old one. Slot gap of tmp is skipped, so that a value can
+  // be built there first; gap == size_vector skips none.
+  void relocate(T* tmp, size_type new_capacity, size_type gap) {
+    for (size_type i{}; i < size_vector; i++) {
+      new (&tmp[i < gap ? i : i + 1]) T(std::move(values[i]));
+      values[i].~T();
+    }
+    if (values) ::operator delete(values);
+    values = tmp;
+    capacity_vector = new_capacity;
+  }
+
+  // Moves the values into a new allocation of new_capacity elements.
+  void reallocate(size_type new_capacity) {
+    relocate(static_cast<T*>(::operator new(sizeof(T) * new_capacity)),
+             new_capacity, size_vector);
+  }
+
+  // Grows the storage with a new value at index pos. The value is built in
+  // the new allocation before the old values move, since args may refer
+  // into them.
+  template <typename... Args>
+  void grow_with(size_type pos, Args&&... args) {
+    size_type new_capacity = size_vector == 0 ? 1 : capacity_vector * 2;
+    T* tmp = static_cast<T*>(::operator new(sizeof(T) * new_capacity));
+    try {
+      new (&tmp[pos]) T(std::forward<Args>(args)...);
+    } catch (...) {
+      ::operator delete(tmp);
+      throw;
+    }
+    relocate(tmp, new_capacity, pos);
+  }
+
+  void destroy_values() {
+    for (size_type i{}; i < size_vector; i++) values[i].~T();
+  }
+
  public:
   vector() : size_vector{}, capacity_vector{} { values = nullptr; }
 
@@ -32,32 +75,45 @@ class vector {
   vector(std::initializer_list<value_type> const& items) {
     size_vector = capacity_vector = items.size();
     values = static_cast<T*>(::operator new(sizeof(T) * capacity_vector));
-    std::copy(items.begin(), items.end(), values);
+    for (unsigned i{}; i < size_vector; i++) {
+      new (&values[i]) T(items.begin()[i]);
+    }
   }
 
   vector(const vector& v)
       : size_vector{v.size_vector}, capacity_vector{v.capacity_vector} {
     values = static_cast<T*>(::operator new(sizeof(T) * capacity_vector));
-    for (unsigned i{}; i < capacity_vector; i++) {
+    for (unsigned i{}; i < size_vector; i++) {
       new (&values[i]) T(v.values[i]);
     }
   }
 
-  vector(vector&& v) : vector() {
+  vector(vector&& v) noexcept : vector() {
     std::swap(size_vector, v.size_vector);
     std::swap(capacity_vector, v.capacity_vector);
     std::swap(values, v.values);
   }
 
   ~vector() {
+    destroy_values();
     size_vector = capacity_vector = 0;
     if (values) ::operator delete(values);
     values = nullptr;
   }
 
-  vector operator=(vector&& v) {
+  vector& operator=(const vector& v) {
     if (this != &v) {
+      vector tmp(v);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  vector& operator=(vector&& v) noexcept {
+    if (this != &v) {
+      destroy_values();
       if (values) ::operator delete(values);
+      values = nullptr;
       capacity_vector = size_vector = 0;
       std::swap(capacity_vector, v.capacity_vector);
       std::swap(size_vector, v.size_vector);
@@ -73,115 +129,88 @@ class vector {
   }
 
   reference operator[](size_type pos) { return values[pos]; }
+  const_reference operator[](size_type pos) const { return values[pos]; }
 
-  const_reference front() { return values[0]; }
+  reference front() { return values[0]; }
+  const_reference front() const { return values[0]; }
 
-  const_reference back() { return values[size_vector - 1]; }
+  reference back() { return values[size_vector - 1]; }
+  const_reference back() const { return values[size_vector - 1]; }
 
   T* data() { return values; }
+  const T* data() const { return values; }
 
   iterator begin() { return &values[0]; }
+  const_iterator begin() const { return &values[0]; }
 
   iterator end() { return &values[size_vector]; }
+  const_iterator end() const { return &values[size_vector]; }
 
-  bool empty() { return size_vector == 0; }
+  bool empty() const { return size_vector == 0; }
 
-  size_type size() { return size_vector; }
+  size_type size() const { return size_vector; }
 
-  size_type max_size() { return size_t(-1) / sizeof(value_type) / 2; }
+  size_type max_size() const { return size_t(-1) / sizeof(value_type) / 2; }
 
   void reserve(size_type size) {
-    if (size >= capacity_vector) {
-      capacity_vector = size;
-      T* tmp = static_cast<T*>(::operator new(sizeof(T) * capacity_vector));
-      std::copy_n(values, size_vector, tmp);
-      if (values) ::operator delete(values);
-      values = tmp;
-    }
+    if (size > capacity_vector) reallocate(size);
   }
 
-  size_type capacity() { return capacity_vector; }
+  size_type capacity() const { return capacity_vector; }
 
   void shrink_to_fit() {
-    if (capacity_vector > size_vector) {
-      capacity_vector = size_vector;
-      T* tmp = static_cast<T*>(::operator new(sizeof(T) * capacity_vector));
-      std::copy_n(values, capacity_vector, tmp);
-      ::operator delete(values);
-      values = tmp;
-    }
+    if (capacity_vector > size_vector) reallocate(size_vector);
   }
 
-  void clear() { size_vector = 0; }
+  void clear() {
+    destroy_values();
+    size_vector = 0;
+  }
 
   iterator insert(iterator pos, const_reference value) {
-    iterator res = nullptr;
+    size_type index = pos - values;
     if (size_vector == capacity_vector) {
-      if (size_vector == 0) {
-        capacity_vector += 1;
-      } else {
-        capacity_vector *= 2;
-      }
-    }
-    size_vector++;
-    value_type* tmp =
-        static_cast<T*>(::operator new(sizeof(T) * capacity_vector));
-    if (capacity_vector == 1) {
-      new (&tmp[0]) T(value);
+      grow_with(index, value);
+    } else if (index == size_vector) {
+      new (&values[size_vector]) T(value);
     } else {
-      for (unsigned i{}, tmp_i{}; i < size_vector - 1; i++) {
-        if (&values[i] == pos) {
-          new (&tmp[tmp_i]) T(value);
-          res = &tmp[tmp_i];
-          tmp_i++;
-        }
-        new (&tmp[tmp_i]) T(values[i]);
-        tmp_i++;
-      }
+      value_type copy(value);
+      new (&values[size_vector]) T(std::move(values[size_vector - 1]));
+      std::move_backward(values + index, values + size_vector - 1,
+                         values + size_vector);
+      values[index] = std::move(copy);
     }
-    if (values) ::operator delete(values);
-    values = tmp;
-    return res;
+    size_vector++;
+    return values + index;
   }
 
   void erase(iterator pos) {
-    value_type* tmp =
-        static_cast<T*>(::operator new(sizeof(T) * capacity_vector));
-    for (unsigned i{}, tmp_i{}; i < size_vector; i++) {
-      if (&values[i] != pos) {
-        new (&tmp[tmp_i]) T(values[i]);
-        tmp_i++;
-      }
-    }
-    size_vector--;
-    ::operator delete(values);
-    values = tmp;
+    std::move(pos + 1, values + size_vector, pos);
+    values[--size_vector].~T();
   }
 
   void push_back(const_reference value) {
     if (size_vector == capacity_vector) {
-      if (size_vector == 0) {
-        capacity_vector += 1;
-      } else {
-        capacity_vector *= 2;
-      }
+      value_type copy(value);
+      reallocate(size_vector == 0 ? 1 : capacity_vector * 2);
+      new (&values[size_vector]) T(std::move(copy));
+    } else {
+      new (&values[size_vector]) T(value);
     }
     size_vector++;
-    value_type* tmp =
-        static_cast<T*>(::operator new(sizeof(T) * capacity_vector));
-    if (capacity_vector == 1) {
-      new (&tmp[0]) T(value);
+  }
+
+  template <typename... Args>
+  reference emplace_back(Args&&... args) {
+    if (size_vector == capacity_vector) {
+      grow_with(size_vector, std::forward<Args>(args)...);
     } else {
-      for (unsigned i{}; i < size_vector - 1; i++) {
-        new (&tmp[i]) T(values[i]);
-      }
-      new (&tmp[size_vector - 1]) T(value);
+      new (&values[size_vector]) T(std::forward<Args>(args)...);
     }
-    if (values) ::operator delete(values);
-    values = tmp;
+    return values[size_vector++];
   }
 
-  void pop_back() { size_vector--; }
+  void pop_back() { values[--size_vector].~T(); }
 
   void swap(vector& other) {
     std::swap(values, other.values);
@@ -0,0 +1,139 @@
+#ifndef S21_WORK_STEALING_DEQUE_H
+#define S21_WORK_STEALING_DEQUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "concurrency_utils.h"
+#include "epoch_reclamation.h"
+
+namespace s21 {
+// Chase-Lev work-stealing deque. One owner thread pushes and pops at the
+// bottom like a stack; any number of thieves steal from the top like a queue.
+// The owner and a thief only synchronize when they race for the last value.
+//
+// The values live in a circular array that the owner doubles when it fills
+// up. A thief may still be reading the old array, so steal runs pinned under
+// an epoch_guard and replaced arrays go to epoch_domain::retire. Values are
+// copied with plain atomic loads and stores, so T must be trivially copyable:
+// the deque is meant for pointers and small task handles.
+template <typename T>
+class work_stealing_deque {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+  static_assert(std::is_trivially_copyable_v<T>,
+                "work_stealing_deque stores trivially copyable values only");
+
+ private:
+  struct Buffer {
+    std::int64_t mask_;
+    std::atomic<value_type> *values_;
+
+    explicit Buffer(std::int64_t capacity)
+        : mask_(capacity - 1), values_(new std::atomic<value_type>[capacity]) {}
+    ~Buffer() { delete[] values_; }
+
+    std::int64_t capacity() const { return mask_ + 1; }
+    value_type get(std::int64_t index) const {
+      return values_[index & mask_].load(std::memory_order_relaxed);
+    }
+    void put(std::int64_t index, value_type value) {
+      values_[index & mask_].store(value, std::memory_order_relaxed);
+    }
+  };
+
+  alignas(kCacheLineSize) std::atomic<std::int64_t> top_;
+  alignas(kCacheLineSize) std::atomic<std::int64_t> bottom_;
+  std::atomic<Buffer *> buffer_;
+
+  // Copies [top, bottom) into an array twice as large, publishes it and
+  // retires the old one.
+  Buffer *grow(Buffer *old, std::int64_t top, std::int64_t bottom) {
+    Buffer *bigger = new Buffer(old->capacity() * 2);
+    for (std::int64_t i = top; i < bottom; i++) bigger->put(i, old->get(i));
+    buffer_.store(bigger, std::memory_order_release);
+    epoch_domain::instance().retire(old);
+    return bigger;
+  }
+
+ public:
+  // The capacity is rounded up to a power of two and grows on demand.
+  explicit work_stealing_deque(size_type capacity = 64)
+      : top_(0), bottom_(0) {
+    size_type rounded = round_up_to_power_of_two(capacity < 2 ? 2 : capacity);
+    buffer_.store(new Buffer(static_cast<std::int64_t>(rounded)),
+                  std::memory_order_relaxed);
+  }
+  work_stealing_deque(const work_stealing_deque &) = delete;
+  work_stealing_deque &operator=(const work_stealing_deque &) = delete;
+  ~work_stealing_deque() { delete buffer_.load(std::memory_order_relaxed); }
+
+  size_type capacity() const {
+    return static_cast<size_type>(
+        buffer_.load(std::memory_order_relaxed)->capacity());
+  }
+
+  // A snapshot that may be stale by the time it is returned.
+  size_type size() const {
+    std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+    std::int64_t top = top_.load(std::memory_order_relaxed);
+    return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+  }
+  bool empty() const { return size() == 0; }
+
+  // Owner only. Never fails: the array grows when it is full.
+  void push(value_type value) {
+    std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+    std::int64_t top = top_.load(std::memory_order_acquire);
+    Buffer *buffer = buffer_.load(std::memory_order_relaxed);
+    if (bottom - top > buffer->mask_) buffer = grow(buffer, top, bottom);
+    buffer->put(bottom, value);
+    bottom_.store(bottom + 1, std::memory_order_release);
+  }
+
+  // Owner only. Takes the most recently pushed value; returns false when the
+  // deque is empty or a thief won the race for the last value.
+  bool pop(reference out) {
+    std::int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+    Buffer *buffer = buffer_.load(std::memory_order_relaxed);
+    bottom_.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::int64_t top = top_.load(std::memory_order_relaxed);
+    if (top > bottom) {
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+      return false;
+    }
+    out = buffer->get(bottom);
+    if (top < bottom) return true;
+    bool won = top_.compare_exchange_strong(
+        top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+    return won;
+  }
+
+  // Any thread. Takes the oldest value; returns false when the deque is empty
+  // or another thread took the value first.
+  bool steal(reference out) {
+    epoch_guard guard;
+    std::int64_t top = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::int64_t bottom = bottom_.load(std::memory_order_acquire);
+    if (top >= bottom) return false;
+    value_type value = buffer_.load(std::memory_order_acquire)->get(top);
+    if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      return false;
+    }
+    out = value;
+    return true;
+  }
+};
+}  // namespace s21
+
+#endif
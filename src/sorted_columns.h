@@ -0,0 +1,88 @@
+#ifndef CPP2_S21_CONTAINERS_SORTED_COLUMNS
+#define CPP2_S21_CONTAINERS_SORTED_COLUMNS
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Tag for bulk operations whose input is already sorted and free of
+// duplicate keys, so it can be merged in without sorting.
+struct sorted_unique_t {
+  explicit sorted_unique_t() = default;
+};
+inline constexpr sorted_unique_t sorted_unique{};
+
+// Index of the first of the n sorted keys at first that is not less than
+// key. Each step halves the range with a conditional move instead of a
+// branch, so the loop runs exactly log2(n) times and never mispredicts.
+template <typename Key, typename Compare>
+std::size_t sorted_lower_bound(const Key *first, std::size_t n, const Key &key,
+                               const Compare &comp) {
+  if (n == 0) return 0;
+  const Key *base = first;
+  while (n > 1) {
+    std::size_t half = n / 2;
+    base = comp(base[half], key) ? base + half : base;
+    n -= half;
+  }
+  return std::size_t(base - first) + comp(*base, key);
+}
+
+// Index of the first of the n sorted keys at first that is greater than key.
+template <typename Key, typename Compare>
+std::size_t sorted_upper_bound(const Key *first, std::size_t n, const Key &key,
+                               const Compare &comp) {
+  if (n == 0) return 0;
+  const Key *base = first;
+  while (n > 1) {
+    std::size_t half = n / 2;
+    base = comp(key, base[half]) ? base : base + half;
+    n -= half;
+  }
+  return std::size_t(base - first) + !comp(key, *base);
+}
+
+// Constructs a value at index pos of column, moving the tail up by one. The
+// value is built first, since args may refer into the column.
+template <typename T, typename... Args>
+void column_insert(vector<T> &column, std::size_t pos, Args &&...args) {
+  T value(std::forward<Args>(args)...);
+  column.emplace_back(std::move(value));
+  std::rotate(column.begin() + pos, column.end() - 1, column.end());
+}
+
+// Removes the value at index pos of column, moving the tail down by one.
+template <typename T>
+void column_erase(vector<T> &column, std::size_t pos) {
+  std::move(column.begin() + pos + 1, column.end(), column.begin() + pos);
+  column.pop_back();
+}
+
+// Sorts keys under comp and drops every key equal to an earlier one, so
+// the first of several equal keys is kept.
+template <typename Key, typename Compare>
+void sort_unique_keys(vector<Key> &keys, const Compare &comp) {
+  std::stable_sort(keys.begin(), keys.end(), comp);
+  auto unique_end =
+      std::unique(keys.begin(), keys.end(),
+                  [&comp](const Key &a, const Key &b) { return !comp(a, b); });
+  while (keys.end() != unique_end) keys.pop_back();
+}
+
+// Whether the n keys at first are strictly increasing under comp.
+template <typename Key, typename Compare>
+bool sorted_unique_keys(const Key *first, std::size_t n, const Compare &comp) {
+  for (std::size_t i = 1; i < n; i++) {
+    if (!comp(first[i - 1], first[i])) return false;
+  }
+  return true;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SORTED_COLUMNS
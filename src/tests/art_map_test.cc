@@ -0,0 +1,198 @@
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "testing.h"
+
+namespace {
+
+template <typename Key>
+void expectSameEntries(const s21::art_map<Key, int> &m,
+                       const std::map<Key, int> &expected) {
+  EXPECT_EQ(m.size(), expected.size());
+  auto it = m.begin();
+  for (const auto &entry : expected) {
+    ASSERT_TRUE(it != m.end());
+    ASSERT_EQ(it->first, entry.first);
+    ASSERT_EQ(it->second, entry.second);
+    ++it;
+  }
+  EXPECT_TRUE(it == m.end());
+}
+
+// Random inserts, erases and bound queries, checked against std::map.
+template <typename Key, typename MakeKey>
+void randomOperations(MakeKey make_key, int rounds) {
+  std::mt19937 rng(11);
+  s21::art_map<Key, int> m;
+  std::map<Key, int> expected;
+  for (int i = 0; i < rounds; i++) {
+    Key key = make_key(rng);
+    switch (rng() % 4) {
+      case 0:
+      case 1:
+        EXPECT_EQ(m.insert(key, i).second, expected.emplace(key, i).second);
+        break;
+      case 2:
+        EXPECT_EQ(m.erase(key), expected.erase(key));
+        break;
+      default: {
+        auto lower = m.lower_bound(key);
+        auto expected_lower = expected.lower_bound(key);
+        if (expected_lower == expected.end()) {
+          EXPECT_TRUE(lower == m.end());
+        } else {
+          ASSERT_TRUE(lower != m.end());
+          EXPECT_EQ(lower->first, expected_lower->first);
+        }
+        auto upper = m.upper_bound(key);
+        auto expected_upper = expected.upper_bound(key);
+        if (expected_upper == expected.end()) {
+          EXPECT_TRUE(upper == m.end());
+        } else {
+          ASSERT_TRUE(upper != m.end());
+          EXPECT_EQ(upper->first, expected_upper->first);
+        }
+        EXPECT_EQ(m.contains(key), expected.count(key) == 1);
+      }
+    }
+  }
+  expectSameEntries(m, expected);
+  // Erasing everything shrinks every node back down.
+  for (const auto &entry : expected) ASSERT_EQ(m.erase(entry.first), 1);
+  EXPECT_TRUE(m.empty());
+  EXPECT_TRUE(m.begin() == m.end());
+}
+
+}  // namespace
+
+TEST(ArtMapTest, MapInterface) {
+  s21::art_map<int, std::string> m{{3, "c"}, {-1, "a"}, {2, "b"}};
+  EXPECT_EQ(m.size(), 3);
+  EXPECT_EQ(m.begin()->first, -1);
+  EXPECT_EQ(m.at(2), "b");
+  EXPECT_THROW(m.at(7), std::out_of_range);
+  m[7] = "g";
+  EXPECT_EQ(m.at(7), "g");
+  EXPECT_FALSE(m.insert(7, "x").second);
+  EXPECT_FALSE(m.insert_or_assign(7, "x").second);
+  EXPECT_EQ(m.at(7), "x");
+  auto last = m.end();
+  --last;
+  EXPECT_EQ(last->first, 7);
+  m.erase(m.find(2));
+  EXPECT_FALSE(m.contains(2));
+  EXPECT_EQ(m.count(3), 1);
+  s21::art_map<int, std::string> other{{2, "two"}, {3, "three"}};
+  m.merge(other);
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(m.at(3), "c");
+  EXPECT_EQ(m.at(2), "two");
+  s21::art_map<int, std::string> copy(m);
+  m.clear();
+  EXPECT_EQ(copy.size(), 4);
+  auto res = copy.insert_many(std::make_pair(9, "i"), std::make_pair(2, "z"));
+  EXPECT_TRUE(res[0].second);
+  EXPECT_FALSE(res[1].second);
+}
+
+TEST(ArtMapTest, SignedKeysSortNumerically) {
+  s21::art_map<std::int64_t, int> m;
+  std::vector<std::int64_t> keys{0, -1, 1, INT64_MIN, INT64_MAX, -256, 256};
+  for (std::int64_t key : keys) m.insert(key, 0);
+  std::vector<std::int64_t> seen;
+  for (const auto &entry : m) seen.push_back(entry.first);
+  EXPECT_EQ(seen, (std::vector<std::int64_t>{INT64_MIN, -256, -1, 0, 1, 256,
+                                             INT64_MAX}));
+  EXPECT_EQ(m.lower_bound(-200)->first, -1);
+}
+
+TEST(ArtMapTest, StringKeysThatArePrefixesOfOthers) {
+  s21::art_map<std::string, int> m;
+  std::vector<std::string> keys{"", "a", "ab", "abc", "abd", "b",
+                                std::string("a\0b", 3)};
+  for (std::size_t i = 0; i < keys.size(); i++) m.insert(keys[i], int(i));
+  std::vector<std::string> seen;
+  for (const auto &entry : m) seen.push_back(entry.first);
+  EXPECT_EQ(seen, (std::vector<std::string>{"", "a", std::string("a\0b", 3),
+                                            "ab", "abc", "abd", "b"}));
+  EXPECT_EQ(m.lower_bound("abca")->first, "abd");
+  EXPECT_EQ(m.upper_bound("ab")->first, "abc");
+  EXPECT_EQ(m.erase("ab"), 1);
+  EXPECT_EQ(m.erase("ab"), 0);
+  EXPECT_TRUE(m.contains("abc"));
+  EXPECT_EQ(m.erase("a"), 1);
+  EXPECT_EQ(m.erase(""), 1);
+  EXPECT_EQ(m.begin()->first, std::string("a\0b", 3));
+}
+
+TEST(ArtMapTest, LongSharedPrefixes) {
+  // Paths that share more bytes than a node stores inline.
+  s21::art_map<std::string, int> m;
+  const std::string base = "/api/v1/organizations/";
+  std::map<std::string, int> expected;
+  for (int i = 0; i < 300; i++) {
+    std::string key = base + std::to_string(i * 37 % 300) + "/members";
+    m.insert(key, i);
+    expected.emplace(key, i);
+  }
+  m.insert(base, -1);
+  expected.emplace(base, -1);
+  expectSameEntries(m, expected);
+  EXPECT_FALSE(m.contains("/api/v1/organization/1/members"));
+  EXPECT_EQ(m.lower_bound("/api/v1/organizations/2")->first,
+            "/api/v1/organizations/2/members");
+  EXPECT_TRUE(m.lower_bound("/api/v1/organizationz") == m.end());
+  EXPECT_EQ(m.lower_bound("/api/v1/organizationa")->first, base);
+  EXPECT_TRUE(m.lower_bound("/api/v2") == m.end());
+  for (int i = 0; i < 300; i += 2) {
+    std::string key = base + std::to_string(i) + "/members";
+    EXPECT_EQ(m.erase(key), 1);
+    expected.erase(key);
+  }
+  expectSameEntries(m, expected);
+}
+
+TEST(ArtMapTest, RandomSmallIntegers) {
+  randomOperations<std::uint32_t>(
+      [](std::mt19937 &rng) { return std::uint32_t(rng() % 2000); }, 40000);
+}
+
+TEST(ArtMapTest, RandomWideIntegers) {
+  // Few keys per top-level byte and many per low byte, so nodes of every
+  // size grow and shrink.
+  randomOperations<std::uint64_t>(
+      [](std::mt19937 &rng) {
+        return (std::uint64_t(rng() % 3) << 56) | (rng() % 600);
+      },
+      40000);
+}
+
+TEST(ArtMapTest, RandomStrings) {
+  randomOperations<std::string>(
+      [](std::mt19937 &rng) {
+        std::string key;
+        std::size_t length = rng() % 14;
+        for (std::size_t i = 0; i < length; i++) {
+          key += char('a' + rng() % 3);
+        }
+        return key;
+      },
+      40000);
+}
+
+TEST(ArtMapTest, RandomStringsEndingInsideLongPrefixes) {
+  // Keys cut a long shared run at random points, so inserts split and
+  // erases rejoin prefixes beyond the bytes a node stores inline.
+  const std::string run = "abcdefghijklmnopqrstuvwxyz";
+  randomOperations<std::string>(
+      [&run](std::mt19937 &rng) {
+        std::string key = run.substr(0, rng() % run.size());
+        if (rng() % 2) key += char('0' + rng() % 3);
+        return key;
+      },
+      40000);
+}
@@ -0,0 +1,239 @@
+#include <algorithm>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "testing.h"
+
+namespace {
+
+template <typename Map>
+std::map<int, int> contents(Map &m) {
+  std::map<int, int> res;
+  for (auto it = m.begin(); it != m.end(); ++it) res.insert(*it);
+  return res;
+}
+
+template <typename K>
+void expectNodeSearchMatchesStd(const std::vector<K> &keys,
+                                const std::vector<K> &probes) {
+  for (std::size_t n = 0; n <= keys.size(); n++) {
+    for (const K &key : probes) {
+      std::size_t lower = std::lower_bound(keys.data(), keys.data() + n, key) -
+                          keys.data();
+      std::size_t upper = std::upper_bound(keys.data(), keys.data() + n, key) -
+                          keys.data();
+      ASSERT_EQ(s21::node_lower_bound(keys.data(), n, key), lower);
+      ASSERT_EQ(s21::node_upper_bound(keys.data(), n, key), upper);
+    }
+  }
+}
+
+}  // namespace
+
+TEST(BPlusTreeTest, EmptyMap) {
+  s21::map<int, int, s21::BPlusTree> m;
+  EXPECT_TRUE(m.empty());
+  EXPECT_TRUE(m.begin() == m.end());
+  EXPECT_FALSE(m.contains(1));
+  EXPECT_THROW(m.at(1), std::out_of_range);
+  m.erase(m.end());
+  EXPECT_EQ(m.size(), 0);
+}
+
+TEST(BPlusTreeTest, MapBasics) {
+  s21::map<int, std::string, s21::BPlusTree> m{{3, "c"}, {1, "a"}, {3, "x"}};
+  EXPECT_EQ(m.size(), 2);
+  EXPECT_EQ(m.at(3), "c");
+  m[2] = "b";
+  auto res = m.insert(2, "y");
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ((*res.first).second, "b");
+  res = m.insert_or_assign(2, "z");
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(m.at(2), "z");
+  std::string keys;
+  for (auto it = m.begin(); it != m.end(); ++it) keys += (*it).second;
+  EXPECT_EQ(keys, "azc");
+}
+
+TEST(BPlusTreeTest, SequentialLoadFillsLeaves) {
+  s21::map<int, int, s21::BPlusTree> m;
+  for (int i = 0; i < 100000; i++) m.insert(i, i);
+  EXPECT_EQ(m.size(), 100000);
+  int expected = 0;
+  for (auto it = m.begin(); it != m.end(); ++it, ++expected) {
+    ASSERT_EQ((*it).first, expected);
+  }
+  EXPECT_EQ(expected, 100000);
+  for (int i = 0; i < 100000; i += 7) ASSERT_EQ(m.at(i), i);
+}
+
+TEST(BPlusTreeTest, RandomOperationsMatchStd) {
+  std::mt19937 rng(5);
+  s21::BPlusTree<int, int> tree;
+  std::map<int, int> expected;
+  for (int i = 0; i < 200000; i++) {
+    int key = int(rng() % 20000);
+    if (rng() % 3) {
+      EXPECT_EQ(tree.insertUnique(key, i).second,
+                expected.emplace(key, i).second);
+    } else {
+      auto it = tree.find(key);
+      ASSERT_EQ(it != tree.end(), expected.erase(key) == 1);
+      tree.erase(it);
+    }
+  }
+  EXPECT_EQ(tree.getSize(), expected.size());
+  auto it = tree.begin();
+  for (const auto &value : expected) {
+    ASSERT_EQ(*it, value.second);
+    ++it;
+  }
+  EXPECT_TRUE(it == tree.end());
+}
+
+TEST(BPlusTreeTest, EraseEverythingShrinksTree) {
+  s21::BPlusTree<int, int> tree;
+  std::vector<int> keys(50000);
+  for (int i = 0; i < 50000; i++) keys[i] = i;
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(9));
+  for (int key : keys) tree.insertUnique(key, key);
+  EXPECT_GE(tree.height(), 3);
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(10));
+  std::set<int> expected(keys.begin(), keys.end());
+  for (std::size_t i = 0; i < keys.size(); i++) {
+    tree.erase(tree.find(keys[i]));
+    expected.erase(keys[i]);
+    if (i % 5000 == 0) {
+      ASSERT_EQ(tree.getSize(), expected.size());
+      auto it = tree.begin();
+      for (int key : expected) {
+        ASSERT_EQ(*it, key);
+        ++it;
+      }
+      ASSERT_TRUE(it == tree.end());
+    }
+  }
+  EXPECT_EQ(tree.getSize(), 0);
+  EXPECT_EQ(tree.height(), 0);
+  EXPECT_TRUE(tree.begin() == tree.end());
+}
+
+TEST(BPlusTreeTest, SetWithStringKeys) {
+  std::mt19937 rng(2);
+  s21::set<std::string, s21::BPlusTree> s;
+  std::set<std::string> expected;
+  for (int i = 0; i < 20000; i++) {
+    std::string key = "key" + std::to_string(rng() % 5000);
+    if (rng() % 4) {
+      EXPECT_EQ(s.insert(key).second, expected.insert(key).second);
+    } else if (s.contains(key)) {
+      s.erase(s.find(key));
+      expected.erase(key);
+    }
+  }
+  EXPECT_EQ(s.size(), expected.size());
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), s.begin()));
+}
+
+TEST(BPlusTreeTest, MultisetMatchesStd) {
+  std::mt19937 rng(4);
+  s21::multiset<int, s21::BPlusTree> s;
+  std::multiset<int> expected;
+  for (int i = 0; i < 60000; i++) {
+    int key = int(rng() % 300);
+    if (rng() % 3) {
+      s.insert(key);
+      expected.insert(key);
+    } else {
+      auto it = s.find(key);
+      ASSERT_EQ(it != s.end(), expected.count(key) > 0);
+      if (it != s.end()) {
+        s.erase(it);
+        expected.erase(expected.find(key));
+      }
+    }
+  }
+  EXPECT_EQ(s.size(), expected.size());
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), s.begin()));
+  for (int key = -1; key <= 300; key++) {
+    ASSERT_EQ(s.count(key), expected.count(key));
+    auto range = s.equal_range(key);
+    ASSERT_EQ(std::size_t(std::distance(range.first, range.second)),
+              expected.count(key));
+    if (s.lower_bound(key) != s.end()) {
+      ASSERT_EQ(*s.lower_bound(key), *expected.lower_bound(key));
+    }
+  }
+}
+
+TEST(BPlusTreeTest, DecrementFromEnd) {
+  s21::set<int, s21::BPlusTree> s;
+  for (int i = 0; i < 1000; i++) s.insert(i);
+  auto it = s.end();
+  for (int i = 999; i >= 0; i--) {
+    --it;
+    ASSERT_EQ(*it, i);
+  }
+  EXPECT_TRUE(it == s.begin());
+}
+
+TEST(BPlusTreeTest, CopyMoveAndSwap) {
+  s21::map<int, int, s21::BPlusTree> m;
+  for (int i = 0; i < 5000; i++) m.insert(i * 3, i);
+  s21::map<int, int, s21::BPlusTree> copy(m);
+  copy.erase(copy.begin());
+  EXPECT_EQ(m.size(), 5000);
+  EXPECT_EQ(copy.size(), 4999);
+  EXPECT_EQ(contents(copy).size(), 4999);
+  s21::map<int, int, s21::BPlusTree> moved(std::move(copy));
+  EXPECT_EQ(moved.size(), 4999);
+  EXPECT_FALSE(moved.contains(0));
+  s21::map<int, int, s21::BPlusTree> other;
+  other = std::move(m);
+  EXPECT_EQ(other.size(), 5000);
+  other.swap(moved);
+  EXPECT_EQ(other.size(), 4999);
+  EXPECT_EQ(moved.at(0), 0);
+  moved.merge(other);
+  EXPECT_EQ(moved.size(), 5000);
+  EXPECT_TRUE(other.empty());
+}
+
+TEST(BPlusTreeTest, BackendsAgree) {
+  std::mt19937 rng(8);
+  s21::map<int, int> rb;
+  s21::map<int, int, s21::BPlusTree> bp;
+  for (int i = 0; i < 30000; i++) {
+    int key = int(rng() % 5000);
+    if (rng() % 4) {
+      bp.insert_or_assign(key, i);
+      rb.insert_or_assign(key, i);
+    } else if (rb.contains(key)) {
+      auto it = rb.begin();
+      while ((*it).first != key) ++it;
+      rb.erase(it);
+      auto jt = bp.begin();
+      while ((*jt).first != key) ++jt;
+      bp.erase(jt);
+    }
+  }
+  EXPECT_EQ(contents(rb), contents(bp));
+}
+
+TEST(BPlusTreeTest, NodeSearchMatchesStd) {
+  std::vector<int> ints{-1000000, -7, -7, -1, 0, 0, 3, 5, 5, 5, 9, 2147483647};
+  expectNodeSearchMatchesStd(ints, {-2147483647 - 1, -7, -2, 0, 4, 5, 6,
+                                    2147483647});
+  std::vector<unsigned> uints{0u, 1u, 7u, 7u, 0x7FFFFFFFu, 0x80000000u,
+                              0x80000001u, 0xFFFFFFFEu, 0xFFFFFFFFu};
+  expectNodeSearchMatchesStd(uints, {0u, 2u, 7u, 0x7FFFFFFFu, 0x80000000u,
+                                     0xF0000000u, 0xFFFFFFFFu});
+  std::vector<float> floats{-3.5f, -0.0f, 0.25f, 0.25f, 1.0f, 8.0f, 1e30f};
+  expectNodeSearchMatchesStd(floats, {-4.0f, 0.0f, 0.25f, 0.3f, 1e30f, 2e30f});
+  std::vector<double> doubles{-1e300, -2.0, 0.5, 0.5, 0.5, 3.0, 1e300};
+  expectNodeSearchMatchesStd(doubles, {-1e301, -2.0, 0.0, 0.5, 2.0, 1e301});
+}
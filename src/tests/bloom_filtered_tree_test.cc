@@ -0,0 +1,135 @@
+#include <cstdint>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "testing.h"
+
+namespace {
+
+bool statsAddUp(const s21::bloom_filter_stats &stats) {
+  return stats.lookups ==
+         stats.definite_misses + stats.false_positives + stats.hits;
+}
+
+template <typename Set>
+void randomOperations() {
+  std::mt19937 rng(7);
+  Set s;
+  std::set<int> expected;
+  for (int i = 0; i < 40000; i++) {
+    int key = int(rng() % 5000);
+    switch (rng() % 4) {
+      case 0:
+        ASSERT_EQ(s.insert(key).second, expected.insert(key).second);
+        break;
+      case 1: {
+        auto it = s.find(key);
+        ASSERT_EQ(it != s.end(), expected.erase(key) == 1);
+        s.erase(it);
+        break;
+      }
+      default:
+        ASSERT_EQ(s.contains(key), expected.count(key) == 1);
+    }
+  }
+  ASSERT_EQ(s.size(), expected.size());
+  s21::bloom_filter_stats stats = s.filter_stats();
+  EXPECT_TRUE(statsAddUp(stats));
+  EXPECT_GT(stats.definite_misses, 0);
+  EXPECT_GT(stats.rebuilds, 0);
+  // Most misses are keys erased a little earlier, yet few of them get past
+  // the filter.
+  EXPECT_LT(stats.false_positives * 10,
+            stats.false_positives + stats.definite_misses);
+}
+
+}  // namespace
+
+TEST(BloomFilteredTreeTest, FilterHasNoFalseNegatives) {
+  s21::blocked_bloom_filter filter(10000);
+  EXPECT_GE(filter.capacity(), 10000);
+  for (std::uint64_t i = 0; i < 10000; i++) {
+    filter.insert(i * 0x9E3779B97F4A7C15ull);
+  }
+  int false_positives = 0;
+  for (std::uint64_t i = 0; i < 10000; i++) {
+    ASSERT_TRUE(filter.mayContain(i * 0x9E3779B97F4A7C15ull));
+    false_positives += filter.mayContain((i + 10000) * 0x9E3779B97F4A7C15ull);
+  }
+  EXPECT_LT(false_positives, 200);
+  filter.clear();
+  EXPECT_FALSE(filter.mayContain(0x9E3779B97F4A7C15ull));
+}
+
+TEST(BloomFilteredTreeTest, MissesStopAtTheFilter) {
+  s21::set<int, s21::BloomRBTree> s;
+  for (int i = 0; i < 20000; i += 2) s.insert(i);
+  for (int i = 0; i < 20000; i++) {
+    if (s.contains(i) != (i % 2 == 0)) {
+      ADD_FAILURE() << i;
+      break;
+    }
+  }
+  s21::bloom_filter_stats stats = s.filter_stats();
+  EXPECT_EQ(stats.lookups, 20000);
+  EXPECT_EQ(stats.hits, 10000);
+  EXPECT_GT(stats.definite_misses, 9800);
+  EXPECT_TRUE(statsAddUp(stats));
+}
+
+TEST(BloomFilteredTreeTest, ErasedKeysBecomeDefiniteMissesAfterRebuild) {
+  s21::set<int, s21::BloomBPlusTree> s;
+  for (int i = 0; i < 10000; i++) s.insert(i);
+  std::size_t rebuilds = s.filter_stats().rebuilds;
+  for (int i = 100; i < 10000; i++) s.erase(s.find(i));
+  EXPECT_GT(s.filter_stats().rebuilds, rebuilds);
+  EXPECT_EQ(s.size(), 100);
+  std::size_t misses = s.filter_stats().definite_misses;
+  for (int i = 100; i < 10000; i++) {
+    if (s.contains(i)) {
+      ADD_FAILURE() << i;
+      break;
+    }
+  }
+  EXPECT_GT(s.filter_stats().definite_misses - misses, 9000);
+  s.clear();
+  EXPECT_FALSE(s.contains(5));
+}
+
+TEST(BloomFilteredTreeTest, RandomSetOperations) {
+  randomOperations<s21::set<int, s21::BloomRBTree>>();
+  randomOperations<s21::set<int, s21::BloomBPlusTree>>();
+}
+
+TEST(BloomFilteredTreeTest, MapWithStringKeys) {
+  s21::map<std::string, int, s21::BloomRBTree> m{{"one", 1}, {"two", 2}};
+  m["three"] = 3;
+  m.insert_or_assign("one", 10);
+  EXPECT_EQ(m.at("one"), 10);
+  EXPECT_EQ(m.at("three"), 3);
+  EXPECT_THROW(m.at("four"), std::out_of_range);
+  EXPECT_FALSE(m.contains("four"));
+
+  s21::map<std::string, int, s21::BloomRBTree> copy(m);
+  EXPECT_TRUE(copy.contains("two"));
+  EXPECT_EQ(copy.filter_stats().lookups, 1);
+  s21::map<std::string, int, s21::BloomRBTree> moved(std::move(copy));
+  EXPECT_TRUE(moved.contains("three"));
+  EXPECT_FALSE(moved.contains("zero"));
+  EXPECT_TRUE(statsAddUp(moved.filter_stats()));
+  EXPECT_EQ(m.size(), 3);
+  EXPECT_GT(m.filter_stats().lookups, 0);
+}
+
+TEST(BloomFilteredTreeTest, MultisetCountsDuplicates) {
+  s21::multiset<int, s21::BloomRBTree> s{3, 1, 3, 3, 2};
+  EXPECT_EQ(s.count(3), 3);
+  EXPECT_EQ(s.count(4), 0);
+  s.erase(s.find(3));
+  EXPECT_EQ(s.count(3), 2);
+  EXPECT_TRUE(s.contains(1));
+  EXPECT_EQ(s.filter_stats().lookups, 4);
+}
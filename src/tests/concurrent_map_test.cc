@@ -0,0 +1,156 @@
+#include <atomic>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "testing.h"
+
+TEST(ConcurrentMapTest, SingleThreaded) {
+  s21::concurrent_map<int, std::string> m{{2, "b"}, {1, "a"}, {2, "x"}};
+  EXPECT_EQ(m.size(), 2);
+  EXPECT_EQ(m.find(2)->second, "b");
+  EXPECT_TRUE(m.find(3) == m.end());
+  auto res = m.insert(3, "c");
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(res.first->first, 3);
+  res = m.insert({3, "y"});
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(res.first->second, "c");
+  std::string values;
+  for (const auto &entry : m) values += entry.second;
+  EXPECT_EQ(values, "abc");
+  EXPECT_EQ(m.lower_bound(0)->first, 1);
+  EXPECT_EQ(m.erase(2), 1);
+  EXPECT_EQ(m.erase(2), 0);
+  EXPECT_EQ(m.lower_bound(2)->first, 3);
+  EXPECT_TRUE(m.lower_bound(4) == m.end());
+  m.clear();
+  EXPECT_TRUE(m.empty());
+  EXPECT_TRUE(m.begin() == m.end());
+}
+
+TEST(ConcurrentMapTest, RandomOperationsMatchStd) {
+  std::mt19937 rng(3);
+  s21::concurrent_map<int, int> m;
+  std::map<int, int> expected;
+  for (int i = 0; i < 50000; i++) {
+    int key = int(rng() % 3000);
+    if (rng() % 2) {
+      EXPECT_EQ(m.insert(key, i).second, expected.emplace(key, i).second);
+    } else {
+      EXPECT_EQ(m.erase(key), expected.erase(key));
+    }
+  }
+  EXPECT_EQ(m.size(), expected.size());
+  auto it = m.begin();
+  for (const auto &entry : expected) {
+    ASSERT_TRUE(it != m.end());
+    ASSERT_EQ(it->first, entry.first);
+    ASSERT_EQ(it->second, entry.second);
+    ++it;
+  }
+  EXPECT_TRUE(it == m.end());
+}
+
+TEST(ConcurrentMapTest, ConcurrentInsertsAndErases) {
+  const int kThreads = 4;
+  const int kKeys = 4000;
+  s21::concurrent_map<int, int> m;
+  std::vector<std::thread> threads;
+  std::atomic<int> inserted(0);
+  std::atomic<int> done_inserting(0);
+  for (int t = 0; t < kThreads; t++) {
+    threads.emplace_back([&, t] {
+      // Every thread races for every key, so exactly one insert per key
+      // wins; once all are in, each thread erases its share of the keys.
+      for (int i = 0; i < kKeys; i++) {
+        if (m.insert(i, t).second) inserted++;
+      }
+      done_inserting++;
+      while (done_inserting.load() < kThreads) std::this_thread::yield();
+      for (int i = t; i < kKeys; i += kThreads) {
+        if (i % 2 == 0) {
+          EXPECT_EQ(m.erase(i), 1);
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  EXPECT_EQ(inserted.load(), kKeys);
+  EXPECT_EQ(m.size(), std::size_t(kKeys / 2));
+  int expected = 1;
+  for (const auto &entry : m) {
+    ASSERT_EQ(entry.first, expected);
+    expected += 2;
+  }
+  EXPECT_EQ(expected, kKeys + 1);
+}
+
+TEST(ConcurrentMapTest, ReadersSeeOrderedStableKeys) {
+  // Even keys are never touched; odd keys are inserted and erased over and
+  // over. Readers must always find every even key, in order.
+  const int kKeys = 2000;
+  s21::concurrent_map<int, int> m;
+  for (int i = 0; i < kKeys; i += 2) m.insert(i, i);
+  std::atomic<bool> stop(false);
+  std::vector<std::thread> writers;
+  for (int t = 0; t < 2; t++) {
+    writers.emplace_back([&, t] {
+      std::mt19937 rng(t);
+      while (!stop.load()) {
+        int key = int(rng() % kKeys) | 1;
+        if (rng() % 2) {
+          m.insert(key, key);
+        } else {
+          m.erase(key);
+        }
+      }
+    });
+  }
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 2; t++) {
+    readers.emplace_back([&] {
+      for (int round = 0; round < 20; round++) {
+        int next_even = 0;
+        int last = -1;
+        for (const auto &entry : m) {
+          EXPECT_GT(entry.first, last);
+          EXPECT_EQ(entry.first, entry.second);
+          last = entry.first;
+          if (entry.first % 2 == 0) {
+            EXPECT_EQ(entry.first, next_even);
+            next_even += 2;
+          }
+        }
+        EXPECT_EQ(next_even, kKeys);
+        for (int i = 0; i < kKeys; i += 2) {
+          EXPECT_TRUE(m.contains(i));
+          EXPECT_GE(m.lower_bound(i - 1)->first, i - 1);
+        }
+      }
+    });
+  }
+  for (auto &reader : readers) reader.join();
+  stop = true;
+  for (auto &writer : writers) writer.join();
+}
+
+TEST(ConcurrentMapTest, ErasedEntriesAreFreed) {
+  static std::atomic<int> alive(0);
+  struct Tracked {
+    Tracked() { alive++; }
+    Tracked(const Tracked &) { alive++; }
+    ~Tracked() { alive--; }
+  };
+  {
+    s21::concurrent_map<int, Tracked> m;
+    for (int i = 0; i < 1000; i++) m.emplace(i, Tracked());
+    EXPECT_EQ(alive.load(), 1000);
+    for (int i = 0; i < 1000; i += 2) m.erase(i);
+    for (int i = 0; i < 8; i++) s21::epoch_domain::instance().collect();
+    EXPECT_EQ(alive.load(), 500);
+  }
+  EXPECT_EQ(alive.load(), 0);
+}
@@ -0,0 +1,43 @@
+#include <functional>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "testing.h"
+
+TEST(ConcurrentSetTest, SingleThreaded) {
+  s21::concurrent_set<std::string> s{"pear", "apple", "fig", "apple"};
+  EXPECT_EQ(s.size(), 3);
+  EXPECT_TRUE(s.contains("fig"));
+  EXPECT_EQ(s.count("plum"), 0);
+  EXPECT_EQ(*s.begin(), "apple");
+  EXPECT_EQ(*s.lower_bound("b"), "fig");
+  EXPECT_FALSE(s.insert("pear").second);
+  EXPECT_EQ(s.erase("apple"), 1);
+  EXPECT_EQ(*s.begin(), "fig");
+}
+
+TEST(ConcurrentSetTest, CustomCompare) {
+  s21::concurrent_set<int, std::greater<int>> s{1, 3, 2};
+  std::vector<int> keys(s.begin(), s.end());
+  EXPECT_EQ(keys, (std::vector<int>{3, 2, 1}));
+  EXPECT_EQ(*s.lower_bound(5), 3);
+}
+
+TEST(ConcurrentSetTest, ParallelDisjointInserts) {
+  const int kThreads = 4;
+  const int kPerThread = 5000;
+  s21::concurrent_set<int> s;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; t++) {
+    threads.emplace_back([&, t] {
+      for (int i = 0; i < kPerThread; i++) s.insert(i * kThreads + t);
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  EXPECT_EQ(s.size(), std::size_t(kThreads * kPerThread));
+  int expected = 0;
+  for (int key : s) ASSERT_EQ(key, expected++);
+  EXPECT_EQ(expected, kThreads * kPerThread);
+}
@@ -0,0 +1,66 @@
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "testing.h"
+
+TEST(ConcurrentStackTest, PushPopOrder) {
+  s21::concurrent_stack<int> s;
+  EXPECT_TRUE(s.empty());
+  EXPECT_FALSE(s.pop());
+  s.push(1);
+  s.push(2);
+  s.emplace(3);
+  EXPECT_EQ(s.size(), 3);
+  int out = 0;
+  EXPECT_TRUE(s.top(out));
+  EXPECT_EQ(out, 3);
+  EXPECT_TRUE(s.pop());
+  EXPECT_TRUE(s.try_pop(out));
+  EXPECT_EQ(out, 2);
+  EXPECT_TRUE(s.try_pop(out));
+  EXPECT_EQ(out, 1);
+  EXPECT_FALSE(s.try_pop(out));
+  EXPECT_FALSE(s.top(out));
+  EXPECT_TRUE(s.empty());
+}
+
+TEST(ConcurrentStackTest, OwnsValues) {
+  s21::concurrent_stack<std::string> s;
+  for (int i = 0; i < 500; i++) s.push(std::string(50, char('a' + i % 26)));
+  std::string out;
+  for (int i = 0; i < 300; i++) EXPECT_TRUE(s.try_pop(out));
+  EXPECT_EQ(out, std::string(50, char('a' + 200 % 26)));
+  EXPECT_EQ(s.size(), 200);
+}
+
+TEST(ConcurrentStackTest, EveryValuePoppedOnce) {
+  const int kThreads = 4;
+  const int kPerThread = 20000;
+  s21::concurrent_stack<int> s;
+  std::vector<std::atomic<int>> popped(kThreads * kPerThread);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; t++) {
+    threads.emplace_back([&, t] {
+      int out = 0;
+      for (int i = 0; i < kPerThread; i++) {
+        s.push(t * kPerThread + i);
+        if (i % 2 == 1) {
+          for (int k = 0; k < 2; k++) {
+            if (s.try_pop(out)) popped[out]++;
+          }
+        }
+        if (i % 64 == 0 && s.top(out)) {
+          EXPECT_LT(out, kThreads * kPerThread);
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  int out = 0;
+  while (s.try_pop(out)) popped[out]++;
+  for (int i = 0; i < kThreads * kPerThread; i++) {
+    EXPECT_EQ(popped[i].load(), 1) << i;
+  }
+}
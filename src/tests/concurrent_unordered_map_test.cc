@@ -0,0 +1,123 @@
+#include <atomic>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "testing.h"
+
+TEST(ConcurrentUnorderedMapTest, SingleThreaded) {
+  s21::concurrent_unordered_map<std::string, int> m{{"a", 1}, {"b", 2}};
+  EXPECT_EQ(m.size(), 2);
+  EXPECT_FALSE(m.insert("a", 5));
+  EXPECT_TRUE(m.insert({"c", 3}));
+  EXPECT_TRUE(m.contains("c"));
+  EXPECT_EQ(m.count("d"), 0);
+  EXPECT_FALSE(m.insert_or_assign("a", 10));
+  EXPECT_TRUE(m.insert_or_assign("d", 4));
+  int seen = 0;
+  EXPECT_TRUE(m.find_and("a", [&](const int &value) { seen = value; }));
+  EXPECT_EQ(seen, 10);
+  EXPECT_FALSE(m.find_and("z", [&](const int &) { seen = -1; }));
+  EXPECT_EQ(seen, 10);
+  EXPECT_TRUE(m.update("b", [](int &value) { value *= 7; }));
+  EXPECT_FALSE(m.update("z", [](int &value) { value = 0; }));
+  EXPECT_FALSE(m.contains("z"));
+  EXPECT_TRUE(m.upsert("z", [](int &value) { value += 1; }));
+  EXPECT_FALSE(m.upsert("z", [](int &value) { value += 1; }));
+  int sum = 0;
+  m.for_each([&](std::pair<const std::string, int> &entry) {
+    sum += entry.second;
+  });
+  EXPECT_EQ(sum, 10 + 14 + 3 + 4 + 2);
+  EXPECT_EQ(m.erase("a"), 1);
+  EXPECT_EQ(m.erase("a"), 0);
+  EXPECT_EQ(m.size(), 4);
+  m.clear();
+  EXPECT_TRUE(m.empty());
+}
+
+TEST(ConcurrentUnorderedMapTest, ShardCount) {
+  s21::concurrent_unordered_map<int, int> one(1);
+  EXPECT_EQ(one.shard_count(), 1);
+  s21::concurrent_unordered_map<int, int> some(20);
+  EXPECT_EQ(some.shard_count(), 32);
+  s21::concurrent_unordered_map<int, int> fallback;
+  EXPECT_GE(fallback.shard_count(), 16);
+  for (int i = 0; i < 1000; i++) {
+    one.insert(i, i);
+    some.insert(i, i);
+  }
+  some.reserve(5000);
+  EXPECT_EQ(one.size(), 1000);
+  EXPECT_EQ(some.size(), 1000);
+  for (int i = 0; i < 1000; i++) {
+    EXPECT_TRUE(one.contains(i));
+    EXPECT_TRUE(some.contains(i));
+  }
+}
+
+TEST(ConcurrentUnorderedMapTest, ParallelCounters) {
+  const int kThreads = 4;
+  const int kKeys = 500;
+  const int kRounds = 20;
+  s21::concurrent_unordered_map<int, long> m;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; t++) {
+    threads.emplace_back([&] {
+      for (int round = 0; round < kRounds; round++) {
+        for (int i = 0; i < kKeys; i++) {
+          m.upsert(i, [](long &value) { value++; });
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  EXPECT_EQ(m.size(), std::size_t(kKeys));
+  for (int i = 0; i < kKeys; i++) {
+    long value = 0;
+    EXPECT_TRUE(m.find_and(i, [&](const long &v) { value = v; }));
+    EXPECT_EQ(value, long(kThreads) * kRounds);
+  }
+}
+
+TEST(ConcurrentUnorderedMapTest, ParallelInsertOrAssignAndErase) {
+  const int kThreads = 4;
+  const int kKeys = 4000;
+  s21::concurrent_unordered_map<int, int> m;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; t++) {
+    threads.emplace_back([&, t] {
+      for (int i = t; i < kKeys; i += kThreads) m.insert_or_assign(i, i);
+      for (int i = t; i < kKeys; i += kThreads) {
+        if (i % 3 == 0) {
+          EXPECT_EQ(m.erase(i), 1);
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  std::unordered_map<int, int> seen;
+  m.for_each([&](std::pair<const int, int> &entry) {
+    seen.emplace(entry.first, entry.second);
+  });
+  EXPECT_EQ(seen.size(), m.size());
+  for (int i = 0; i < kKeys; i++) {
+    EXPECT_EQ(seen.count(i), i % 3 == 0 ? 0u : 1u);
+  }
+}
+
+TEST(ConcurrentUnorderedMapTest, ParallelForEach) {
+  s21::concurrent_unordered_map<int, int> m(64);
+  for (int i = 0; i < 10000; i++) m.insert(i, i);
+  s21::thread_pool pool(4);
+  std::atomic<long> sum(0);
+  m.for_each(pool, [&](std::pair<const int, int> &entry) {
+    entry.second *= 2;
+    sum += entry.second;
+  });
+  EXPECT_EQ(sum.load(), 2L * 9999 * 10000 / 2);
+  int value = 0;
+  m.find_and(1234, [&](const int &v) { value = v; });
+  EXPECT_EQ(value, 2468);
+}
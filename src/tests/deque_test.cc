@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "testing.h"
+
+namespace {
+
+const int kMany = 3000;
+
+std::vector<int> values(const s21::deque<int> &d) {
+  return std::vector<int>(d.begin(), d.end());
+}
+
+}  // namespace
+
+TEST(DequeTest, DefaultConstructor) {
+  s21::deque<int> d;
+  EXPECT_TRUE(d.empty());
+  EXPECT_EQ(d.size(), 0);
+  EXPECT_TRUE(d.begin() == d.end());
+  d.pop_back();
+  d.pop_front();
+  EXPECT_TRUE(d.empty());
+}
+
+TEST(DequeTest, PushBothEnds) {
+  s21::deque<int> d{3, 4};
+  d.push_front(2);
+  d.push_back(5);
+  d.emplace_front(1);
+  d.emplace_back(6);
+  EXPECT_EQ(values(d), (std::vector<int>{1, 2, 3, 4, 5, 6}));
+  EXPECT_EQ(d.front(), 1);
+  EXPECT_EQ(d.back(), 6);
+  d.pop_front();
+  d.pop_back();
+  EXPECT_EQ(values(d), (std::vector<int>{2, 3, 4, 5}));
+}
+
+TEST(DequeTest, ManyValuesAcrossBlocks) {
+  s21::deque<int> d;
+  for (int i = 0; i < kMany; i++) {
+    d.push_back(i);
+    d.push_front(-i - 1);
+  }
+  EXPECT_EQ(d.size(), 2 * kMany);
+  for (int i = 0; i < 2 * kMany; i++) EXPECT_EQ(d[i], i - kMany);
+  EXPECT_EQ(d.at(0), -kMany);
+  EXPECT_THROW(d.at(2 * kMany), std::out_of_range);
+  for (int i = 0; i < kMany; i++) {
+    EXPECT_EQ(d.front(), i - kMany);
+    d.pop_front();
+  }
+  EXPECT_EQ(d.front(), 0);
+  EXPECT_EQ(d.back(), kMany - 1);
+}
+
+TEST(DequeTest, ReferencesStableAcrossEndInsertions) {
+  s21::deque<std::string> d{"middle"};
+  std::string *middle = &d.front();
+  for (int i = 0; i < kMany; i++) {
+    d.push_back("b" + std::to_string(i));
+    d.push_front("f" + std::to_string(i));
+  }
+  EXPECT_EQ(middle, &d[kMany]);
+  EXPECT_EQ(*middle, "middle");
+  EXPECT_EQ(d.front(), "f" + std::to_string(kMany - 1));
+}
+
+TEST(DequeTest, RandomAccessIterators) {
+  s21::deque<int> d;
+  for (int i = 0; i < kMany; i++) d.push_front(i * 7 % kMany);
+  std::sort(d.begin(), d.end());
+  EXPECT_TRUE(std::is_sorted(d.begin(), d.end()));
+  EXPECT_EQ(d.end() - d.begin(), kMany);
+  auto it = d.begin() + 1234;
+  EXPECT_EQ(*it, 1234);
+  it -= 1000;
+  EXPECT_EQ(*it, 234);
+  EXPECT_EQ(it[2000], 2234);
+  EXPECT_TRUE(it < d.end());
+  --it;
+  EXPECT_EQ(*it, 233);
+  const s21::deque<int> &c = d;
+  s21::deque<int>::const_iterator cit = c.end();
+  --cit;
+  EXPECT_EQ(*cit, kMany - 1);
+  EXPECT_EQ(std::count(c.begin(), c.end(), 7), 1);
+}
+
+TEST(DequeTest, QueuePattern) {
+  s21::deque<int> d;
+  int next = 0;
+  for (int round = 0; round < 50; round++) {
+    for (int i = 0; i < 200; i++) d.push_back(round * 200 + i);
+    for (int i = 0; i < 150; i++) {
+      EXPECT_EQ(d.front(), next++);
+      d.pop_front();
+    }
+  }
+  EXPECT_EQ(d.size(), 50 * 50);
+  d.shrink_to_fit();
+  EXPECT_EQ(d.front(), next);
+}
+
+TEST(DequeTest, CopyMoveSwap) {
+  s21::deque<int> d1{1, 2, 3};
+  s21::deque<int> d2(d1);
+  d2.push_back(4);
+  EXPECT_EQ(values(d1), (std::vector<int>{1, 2, 3}));
+  s21::deque<int> d3(std::move(d2));
+  EXPECT_TRUE(d2.empty());
+  EXPECT_EQ(values(d3), (std::vector<int>{1, 2, 3, 4}));
+  d1 = d3;
+  EXPECT_EQ(values(d1), (std::vector<int>{1, 2, 3, 4}));
+  d2 = std::move(d3);
+  d2.swap(d3);
+  EXPECT_EQ(values(d3), (std::vector<int>{1, 2, 3, 4}));
+  d3.clear();
+  EXPECT_TRUE(d3.empty());
+  d3.push_front(9);
+  EXPECT_EQ(values(d3), (std::vector<int>{9}));
+}
+
+TEST(DequeTest, InsertMany) {
+  s21::deque<int> d{3};
+  d.insert_many_back(4, 5);
+  d.insert_many_front(2, 1);
+  EXPECT_EQ(values(d), (std::vector<int>{1, 2, 3, 4, 5}));
+}
+
+TEST(DequeTest, BacksStackAndQueue) {
+  s21::stack<int, s21::deque<int>> s;
+  s21::queue<int, s21::deque<int>> q;
+  for (int i = 0; i < kMany; i++) {
+    s.push(i);
+    q.push(i);
+  }
+  for (int i = kMany - 1; i >= 0; i--) {
+    EXPECT_EQ(s.top(), i);
+    s.pop();
+  }
+  int out[10];
+  EXPECT_EQ(q.pop_into(out, 10), 10);
+  EXPECT_EQ(out[9], 9);
+  EXPECT_EQ(q.front(), 10);
+  EXPECT_EQ(q.size(), kMany - 10);
+  EXPECT_EQ(s.emplace(5), 5);
+}
@@ -0,0 +1,76 @@
+#include <atomic>
+#include <thread>
+
+#include "testing.h"
+
+namespace {
+
+struct Counted {
+  static std::atomic<int> destroyed;
+  ~Counted() { destroyed++; }
+};
+std::atomic<int> Counted::destroyed(0);
+
+void collect_a_few_times() {
+  for (int i = 0; i < 4; i++) s21::epoch_domain::instance().collect();
+}
+
+}  // namespace
+
+TEST(EpochReclamationTest, RetiredNodeFreedAfterTwoEpochs) {
+  s21::epoch_domain &domain = s21::epoch_domain::instance();
+  collect_a_few_times();
+  Counted::destroyed = 0;
+  domain.retire(new Counted);
+  EXPECT_EQ(Counted::destroyed.load(), 0);
+  EXPECT_GE(domain.retired_count(), 1);
+  collect_a_few_times();
+  EXPECT_EQ(Counted::destroyed.load(), 1);
+}
+
+TEST(EpochReclamationTest, GuardsNest) {
+  s21::epoch_domain &domain = s21::epoch_domain::instance();
+  Counted::destroyed = 0;
+  {
+    s21::epoch_guard outer;
+    {
+      s21::epoch_guard inner;
+    }
+    std::uint64_t pinned_at = domain.epoch();
+    domain.retire(new Counted);
+    collect_a_few_times();
+    EXPECT_LE(domain.epoch(), pinned_at + 1);
+    EXPECT_EQ(Counted::destroyed.load(), 0);
+  }
+  collect_a_few_times();
+  EXPECT_EQ(Counted::destroyed.load(), 1);
+}
+
+TEST(EpochReclamationTest, PinnedReaderDelaysReclamation) {
+  s21::epoch_domain &domain = s21::epoch_domain::instance();
+  Counted::destroyed = 0;
+  std::atomic<int> stage(0);
+  std::thread reader([&stage] {
+    s21::epoch_guard guard;
+    stage = 1;
+    while (stage.load() != 2) std::this_thread::yield();
+  });
+  while (stage.load() != 1) std::this_thread::yield();
+  domain.retire(new Counted);
+  collect_a_few_times();
+  EXPECT_EQ(Counted::destroyed.load(), 0);
+  stage = 2;
+  reader.join();
+  collect_a_few_times();
+  EXPECT_EQ(Counted::destroyed.load(), 1);
+}
+
+TEST(EpochReclamationTest, BatchesReclaimAutomatically) {
+  s21::epoch_domain &domain = s21::epoch_domain::instance();
+  collect_a_few_times();
+  Counted::destroyed = 0;
+  for (int i = 0; i < 1000; i++) domain.retire(new Counted);
+  EXPECT_GT(Counted::destroyed.load(), 800);
+  EXPECT_LT(domain.retired_count(), 200);
+  collect_a_few_times();
+}
@@ -0,0 +1,206 @@
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "testing.h"
+
+namespace {
+
+std::vector<std::pair<int, int>> entries(const s21::flat_map<int, int> &m) {
+  std::vector<std::pair<int, int>> res;
+  for (auto it = m.begin(); it != m.end(); ++it) {
+    res.emplace_back(it->first, it->second);
+  }
+  return res;
+}
+
+// A value whose copies throw while copies_fail is set.
+bool copies_fail = false;
+struct Fragile {
+  int value;
+  Fragile(int v = 0) : value(v) {}
+  Fragile(const Fragile &other) : value(other.value) {
+    if (copies_fail) throw std::runtime_error("copy");
+  }
+  Fragile(Fragile &&other) noexcept : value(other.value) {}
+  Fragile &operator=(const Fragile &other) = default;
+  Fragile &operator=(Fragile &&other) noexcept = default;
+};
+
+}  // namespace
+
+TEST(FlatMapTest, DefaultConstructor) {
+  s21::flat_map<int, int> m;
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(m.size(), 0);
+  EXPECT_TRUE(m.begin() == m.end());
+  EXPECT_FALSE(m.contains(1));
+  EXPECT_TRUE(m.find(1) == m.end());
+}
+
+TEST(FlatMapTest, InitializerListSortsAndKeepsFirst) {
+  s21::flat_map<int, std::string> m{{3, "c"}, {1, "a"}, {2, "b"}, {1, "x"}};
+  EXPECT_EQ(m.size(), 3);
+  EXPECT_EQ(m.keys()[0], 1);
+  EXPECT_EQ(m.keys()[2], 3);
+  EXPECT_EQ(m.at(1), "a");
+  EXPECT_EQ(m.values()[1], "b");
+}
+
+TEST(FlatMapTest, AtAndSubscript) {
+  s21::flat_map<std::string, int> m;
+  m["b"] = 2;
+  m["a"] += 1;
+  EXPECT_EQ(m.at("a"), 1);
+  EXPECT_EQ(m["b"], 2);
+  EXPECT_EQ(m.size(), 2);
+  EXPECT_THROW(m.at("c"), std::out_of_range);
+  const auto &c = m;
+  EXPECT_EQ(c.at("b"), 2);
+  EXPECT_EQ((*c.find("a")).second, 1);
+}
+
+TEST(FlatMapTest, InsertAndAssign) {
+  s21::flat_map<int, int> m;
+  auto res = m.insert({5, 50});
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(res.first->second, 50);
+  res = m.insert(5, 51);
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(m.at(5), 50);
+  res = m.insert_or_assign(5, 52);
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(m.at(5), 52);
+  res = m.insert_or_assign(1, 10);
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(res.first->first, 1);
+  res.first->second = 11;
+  EXPECT_EQ(m.at(1), 11);
+  EXPECT_EQ(m.begin()->first, 1);
+}
+
+TEST(FlatMapTest, RandomOperationsMatchStd) {
+  std::mt19937 rng(17);
+  s21::flat_map<int, int> m;
+  std::map<int, int> expected;
+  for (int i = 0; i < 20000; i++) {
+    int key = int(rng() % 1000);
+    switch (rng() % 3) {
+      case 0:
+        EXPECT_EQ(m.insert(key, i).second, expected.emplace(key, i).second);
+        break;
+      case 1:
+        m.insert_or_assign(key, i);
+        expected[key] = i;
+        break;
+      default:
+        EXPECT_EQ(m.erase(key), expected.erase(key));
+    }
+  }
+  std::vector<std::pair<int, int>> expected_entries(expected.begin(),
+                                                    expected.end());
+  EXPECT_EQ(entries(m), expected_entries);
+  for (int key = -1; key <= 1000; key++) {
+    auto it = m.lower_bound(key);
+    auto std_it = expected.lower_bound(key);
+    ASSERT_EQ(it == m.end(), std_it == expected.end());
+    if (std_it != expected.end()) {
+      ASSERT_EQ(it->first, std_it->first);
+    }
+    auto up = m.upper_bound(key);
+    auto std_up = expected.upper_bound(key);
+    ASSERT_EQ(up - m.begin(), std::distance(expected.begin(), std_up));
+  }
+}
+
+TEST(FlatMapTest, EraseIterator) {
+  s21::flat_map<int, int> m{{1, 1}, {2, 2}, {3, 3}};
+  m.erase(m.find(2));
+  m.erase(m.end());
+  EXPECT_EQ(entries(m), (std::vector<std::pair<int, int>>{{1, 1}, {3, 3}}));
+}
+
+TEST(FlatMapTest, BulkInsert) {
+  s21::flat_map<int, int> m{{2, 20}, {4, 40}};
+  std::vector<std::pair<int, int>> sorted{{1, 10}, {2, 99}, {3, 30}, {5, 50}};
+  m.insert(s21::sorted_unique, sorted.begin(), sorted.end());
+  EXPECT_EQ(entries(m), (std::vector<std::pair<int, int>>{
+                            {1, 10}, {2, 20}, {3, 30}, {4, 40}, {5, 50}}));
+  std::vector<std::pair<int, int>> unsorted{{9, 90}, {0, 0}, {9, 91}, {4, 1}};
+  m.insert(unsorted.begin(), unsorted.end());
+  EXPECT_EQ(m.size(), 7);
+  EXPECT_EQ(m.at(9), 90);
+  EXPECT_EQ(m.at(4), 40);
+  EXPECT_EQ(m.begin()->first, 0);
+}
+
+TEST(FlatMapTest, Replace) {
+  s21::flat_map<int, std::string> m{{7, "seven"}};
+  m.replace(s21::vector<int>{1, 2, 3}, s21::vector<std::string>{"a", "b", "c"});
+  EXPECT_EQ(m.size(), 3);
+  EXPECT_EQ(m.at(2), "b");
+  EXPECT_FALSE(m.contains(7));
+  EXPECT_THROW(m.replace(s21::vector<int>{2, 1},
+                         s21::vector<std::string>{"b", "a"}),
+               std::invalid_argument);
+  EXPECT_THROW(
+      m.replace(s21::vector<int>{1}, s21::vector<std::string>{"a", "b"}),
+      std::invalid_argument);
+  EXPECT_EQ(m.at(3), "c");
+  s21::flat_map<int, int> n(s21::sorted_unique, s21::vector<int>{1, 5},
+                            s21::vector<int>{10, 50});
+  EXPECT_EQ(n.at(5), 50);
+}
+
+TEST(FlatMapTest, CopyMoveSwapMerge) {
+  s21::flat_map<int, int> a{{1, 1}, {2, 2}};
+  s21::flat_map<int, int> b(a);
+  b[3] = 3;
+  EXPECT_EQ(a.size(), 2);
+  s21::flat_map<int, int> c(std::move(b));
+  EXPECT_EQ(c.size(), 3);
+  a.swap(c);
+  EXPECT_EQ(a.size(), 3);
+  s21::flat_map<int, int> d{{3, 30}, {4, 40}};
+  a.merge(d);
+  EXPECT_TRUE(d.empty());
+  EXPECT_EQ(entries(a), (std::vector<std::pair<int, int>>{
+                            {1, 1}, {2, 2}, {3, 3}, {4, 40}}));
+  d = a;
+  EXPECT_EQ(d.size(), 4);
+}
+
+TEST(FlatMapTest, InsertMany) {
+  s21::flat_map<int, char> m{{2, 'b'}};
+  auto res = m.insert_many(std::pair<int, char>{3, 'c'},
+                           std::pair<int, char>{2, 'x'},
+                           std::pair<int, char>{1, 'a'});
+  ASSERT_EQ(res.size(), 3);
+  EXPECT_TRUE(res[0].second);
+  EXPECT_EQ(res[0].first->second, 'c');
+  EXPECT_FALSE(res[1].second);
+  EXPECT_EQ(res[1].first->second, 'b');
+  EXPECT_EQ(res[2].first->first, 1);
+  EXPECT_EQ(m.size(), 3);
+}
+
+TEST(FlatMapTest, SortedInsertReservesOnceAndClearsOnThrow) {
+  s21::flat_map<int, Fragile> m{{2, 20}, {4, 40}};
+  std::vector<std::pair<int, Fragile>> sorted{{1, 10}, {3, 30}, {5, 50}};
+  m.insert(s21::sorted_unique, sorted.begin(), sorted.end());
+  EXPECT_EQ(m.size(), 5);
+  EXPECT_EQ(m.keys().capacity(), 5);
+  EXPECT_EQ(m.at(3).value, 30);
+
+  std::vector<std::pair<int, Fragile>> more{{0, 0}, {6, 60}};
+  copies_fail = true;
+  EXPECT_THROW(m.insert(s21::sorted_unique, more.begin(), more.end()),
+               std::runtime_error);
+  copies_fail = false;
+  EXPECT_TRUE(m.empty());
+  m.insert(s21::sorted_unique, more.begin(), more.end());
+  EXPECT_EQ(m.at(6).value, 60);
+}
@@ -0,0 +1,107 @@
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "testing.h"
+
+namespace {
+
+std::vector<int> values(const s21::flat_set<int> &s) {
+  return std::vector<int>(s.begin(), s.end());
+}
+
+}  // namespace
+
+TEST(FlatSetTest, DefaultConstructor) {
+  s21::flat_set<int> s;
+  EXPECT_TRUE(s.empty());
+  EXPECT_TRUE(s.begin() == s.end());
+  EXPECT_FALSE(s.contains(0));
+  EXPECT_EQ(s.erase(0), 0);
+}
+
+TEST(FlatSetTest, InitializerListSortsAndDedupes) {
+  s21::flat_set<int> s{5, 1, 3, 1, 5};
+  EXPECT_EQ(values(s), (std::vector<int>{1, 3, 5}));
+}
+
+TEST(FlatSetTest, InsertFindErase) {
+  s21::flat_set<std::string> s;
+  EXPECT_TRUE(s.insert("m").second);
+  EXPECT_TRUE(s.insert("a").second);
+  EXPECT_FALSE(s.insert("m").second);
+  EXPECT_EQ(*s.begin(), "a");
+  EXPECT_EQ(*s.find("m"), "m");
+  EXPECT_TRUE(s.find("z") == s.end());
+  EXPECT_EQ(s.count("a"), 1);
+  s.erase(s.find("a"));
+  EXPECT_EQ(s.size(), 1);
+  EXPECT_EQ(s.erase("m"), 1);
+  EXPECT_TRUE(s.empty());
+}
+
+TEST(FlatSetTest, BoundsMatchStd) {
+  std::mt19937 rng(23);
+  s21::flat_set<int> s;
+  std::set<int> expected;
+  for (int i = 0; i < 500; i++) {
+    int key = int(rng() % 2000);
+    s.insert(key);
+    expected.insert(key);
+  }
+  EXPECT_EQ(values(s), std::vector<int>(expected.begin(), expected.end()));
+  for (int key = -1; key <= 2000; key++) {
+    ASSERT_EQ(s.lower_bound(key) - s.begin(),
+              std::distance(expected.begin(), expected.lower_bound(key)));
+    ASSERT_EQ(s.upper_bound(key) - s.begin(),
+              std::distance(expected.begin(), expected.upper_bound(key)));
+    ASSERT_EQ(s.contains(key), expected.count(key) == 1);
+  }
+}
+
+TEST(FlatSetTest, BulkInsertAndReplace) {
+  s21::flat_set<int> s{4, 8};
+  std::vector<int> sorted{1, 4, 6, 9};
+  s.insert(s21::sorted_unique, sorted.begin(), sorted.end());
+  EXPECT_EQ(values(s), (std::vector<int>{1, 4, 6, 8, 9}));
+  EXPECT_EQ(s.keys().capacity(), 6);
+  std::vector<int> unsorted{7, 0, 7, 3};
+  s.insert(unsorted.begin(), unsorted.end());
+  EXPECT_EQ(values(s), (std::vector<int>{0, 1, 3, 4, 6, 7, 8, 9}));
+  s.replace(s21::vector<int>{2, 4});
+  EXPECT_EQ(values(s), (std::vector<int>{2, 4}));
+  EXPECT_THROW(s.replace(s21::vector<int>{4, 4}), std::invalid_argument);
+  s21::vector<int> keys = s.extract();
+  EXPECT_TRUE(s.empty());
+  EXPECT_EQ(keys.size(), 2);
+  s21::flat_set<int> t(s21::sorted_unique, s21::vector<int>{1, 2, 3});
+  EXPECT_EQ(t.size(), 3);
+}
+
+TEST(FlatSetTest, CopyMoveSwapMerge) {
+  s21::flat_set<int> a{1, 2};
+  s21::flat_set<int> b(a);
+  b.insert(3);
+  EXPECT_EQ(a.size(), 2);
+  s21::flat_set<int> c(std::move(b));
+  a.swap(c);
+  EXPECT_EQ(values(a), (std::vector<int>{1, 2, 3}));
+  s21::flat_set<int> d{0, 3};
+  a.merge(d);
+  EXPECT_TRUE(d.empty());
+  EXPECT_EQ(values(a), (std::vector<int>{0, 1, 2, 3}));
+  d = a;
+  EXPECT_EQ(d.size(), 4);
+}
+
+TEST(FlatSetTest, InsertMany) {
+  s21::flat_set<int> s{5};
+  auto res = s.insert_many(9, 5, 1);
+  ASSERT_EQ(res.size(), 3);
+  EXPECT_TRUE(res[0].second);
+  EXPECT_EQ(*res[0].first, 9);
+  EXPECT_FALSE(res[1].second);
+  EXPECT_EQ(*res[1].first, 5);
+  EXPECT_EQ(*res[2].first, 1);
+}
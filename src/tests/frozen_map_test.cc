@@ -0,0 +1,94 @@
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "testing.h"
+
+TEST(FrozenMapTest, Empty) {
+  s21::frozen_map<int, int> m;
+  EXPECT_TRUE(m.empty());
+  EXPECT_TRUE(m.begin() == m.end());
+  EXPECT_FALSE(m.contains(1));
+  EXPECT_THROW(m.at(1), std::out_of_range);
+}
+
+TEST(FrozenMapTest, InitializerListKeepsFirstValue) {
+  s21::frozen_map<int, std::string> m{{3, "c"}, {1, "a"}, {3, "x"}, {2, "b"}};
+  EXPECT_EQ(m.size(), 3);
+  EXPECT_EQ(m.at(3), "c");
+  std::string values;
+  for (auto it = m.begin(); it != m.end(); ++it) values += it->second;
+  EXPECT_EQ(values, "abc");
+  EXPECT_EQ((*m.find(2)).second, "b");
+  EXPECT_TRUE(m.find(4) == m.end());
+  EXPECT_THROW(m.at(4), std::out_of_range);
+}
+
+TEST(FrozenMapTest, FromMap) {
+  s21::map<std::string, int> source{{"one", 1}, {"two", 2}, {"three", 3}};
+  s21::frozen_map<std::string, int> m(source);
+  EXPECT_EQ(m.size(), 3);
+  EXPECT_EQ(m.at("two"), 2);
+  EXPECT_EQ(m.begin()->first, "one");
+  EXPECT_EQ(m.lower_bound("p")->first, "three");
+  EXPECT_TRUE(m.upper_bound("two") == m.end());
+}
+
+TEST(FrozenMapTest, SortedUniqueColumns) {
+  s21::vector<int> keys;
+  s21::vector<double> values;
+  for (int i = 0; i < 1000; i++) {
+    keys.push_back(i * 2);
+    values.push_back(i * 0.5);
+  }
+  s21::frozen_map<int, double> m(s21::sorted_unique, keys, values);
+  for (int i = 0; i < 1000; i++) ASSERT_EQ(m.at(i * 2), i * 0.5);
+  EXPECT_FALSE(m.contains(1));
+  values.pop_back();
+  EXPECT_THROW((s21::frozen_map<int, double>(s21::sorted_unique, keys, values)),
+               std::invalid_argument);
+  values.push_back(0);
+  keys[10] = 0;
+  EXPECT_THROW((s21::frozen_map<int, double>(s21::sorted_unique, keys, values)),
+               std::invalid_argument);
+}
+
+TEST(FrozenMapTest, RandomEntriesMatchStd) {
+  std::mt19937 rng(6);
+  std::vector<std::pair<int, int>> entries;
+  std::map<int, int> expected;
+  for (int i = 0; i < 50000; i++) {
+    int key = int(rng() % 200000);
+    entries.push_back({key, i});
+    expected.emplace(key, i);
+  }
+  s21::frozen_map<int, int> m(entries.begin(), entries.end());
+  EXPECT_EQ(m.size(), expected.size());
+  auto it = m.begin();
+  for (const auto &entry : expected) {
+    ASSERT_EQ(it->first, entry.first);
+    ASSERT_EQ(it->second, entry.second);
+    ++it;
+  }
+  EXPECT_TRUE(it == m.end());
+  for (int key = 0; key < 200000; key += 13) {
+    ASSERT_EQ(m.count(key), expected.count(key));
+  }
+}
+
+TEST(FrozenMapTest, CopyAndMove) {
+  s21::frozen_map<int, std::string> a{{1, "one"}, {2, "two"}};
+  s21::frozen_map<int, std::string> b(a);
+  EXPECT_EQ(b.at(2), "two");
+  s21::frozen_map<int, std::string> c(std::move(a));
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(c.at(1), "one");
+  a = c;
+  EXPECT_EQ(a.size(), 2);
+  b = std::move(c);
+  EXPECT_EQ(b.size(), 2);
+  b.swap(c);
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ((--c.end())->second, "two");
+}
@@ -0,0 +1,133 @@
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "testing.h"
+
+TEST(FrozenSetTest, Empty) {
+  s21::frozen_set<int> s;
+  EXPECT_TRUE(s.empty());
+  EXPECT_EQ(s.size(), 0);
+  EXPECT_TRUE(s.begin() == s.end());
+  EXPECT_FALSE(s.contains(1));
+  EXPECT_TRUE(s.lower_bound(1) == s.end());
+  EXPECT_TRUE(s.upper_bound(1) == s.end());
+}
+
+TEST(FrozenSetTest, InitializerListSortsAndDedupes) {
+  s21::frozen_set<int> s{5, 1, 4, 1, 3, 5, 2};
+  EXPECT_EQ(s.size(), 5);
+  std::vector<int> keys(s.begin(), s.end());
+  EXPECT_EQ(keys, (std::vector<int>{1, 2, 3, 4, 5}));
+  EXPECT_EQ(s.count(4), 1);
+  EXPECT_EQ(s.count(6), 0);
+  EXPECT_EQ(*s.find(3), 3);
+}
+
+TEST(FrozenSetTest, EveryTreeShapeMatchesStd) {
+  for (int n = 0; n <= 70; n++) {
+    std::vector<int> keys;
+    for (int i = 0; i < n; i++) keys.push_back(2 * i);
+    s21::frozen_set<int> s(keys.begin(), keys.end());
+    ASSERT_EQ(s.size(), std::size_t(n));
+    ASSERT_TRUE(std::equal(keys.begin(), keys.end(), s.begin(), s.end()));
+    for (int key = -1; key <= 2 * n; key++) {
+      auto lower = std::lower_bound(keys.begin(), keys.end(), key);
+      auto upper = std::upper_bound(keys.begin(), keys.end(), key);
+      auto it = s.lower_bound(key);
+      if (lower == keys.end()) {
+        ASSERT_TRUE(it == s.end());
+      } else {
+        ASSERT_EQ(*it, *lower);
+      }
+      it = s.upper_bound(key);
+      if (upper == keys.end()) {
+        ASSERT_TRUE(it == s.end());
+      } else {
+        ASSERT_EQ(*it, *upper);
+      }
+      ASSERT_EQ(s.contains(key), key % 2 == 0 && key >= 0 && key < 2 * n);
+    }
+  }
+}
+
+TEST(FrozenSetTest, IteratesBackwards) {
+  s21::frozen_set<int> s{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  std::vector<int> keys;
+  auto it = s.end();
+  while (it != s.begin()) keys.push_back(*--it);
+  EXPECT_EQ(keys, (std::vector<int>{10, 9, 8, 7, 6, 5, 4, 3, 2, 1}));
+}
+
+TEST(FrozenSetTest, KeysAreCacheLineAligned) {
+  s21::frozen_set<int> s{1, 2, 3};
+  const int &smallest = *s.begin();
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(&smallest - 2) % 64, 0u);
+}
+
+TEST(FrozenSetTest, FromSet) {
+  s21::set<std::string> source{"pear", "apple", "fig"};
+  s21::frozen_set<std::string> s(source);
+  EXPECT_EQ(s.size(), 3);
+  EXPECT_EQ(*s.begin(), "apple");
+  EXPECT_TRUE(s.contains("fig"));
+  EXPECT_FALSE(s.contains("plum"));
+  s21::set<int, s21::BPlusTree> large;
+  for (int i = 0; i < 1000; i++) large.insert(i * 3);
+  s21::frozen_set<int> f(large);
+  EXPECT_EQ(f.size(), 1000);
+  EXPECT_TRUE(f.contains(999 * 3));
+}
+
+TEST(FrozenSetTest, SortedUnique) {
+  s21::vector<int> keys;
+  for (int i = 0; i < 100; i++) keys.push_back(i);
+  s21::frozen_set<int> s(s21::sorted_unique, keys);
+  EXPECT_EQ(s.size(), 100);
+  keys.push_back(50);
+  EXPECT_THROW(s21::frozen_set<int>(s21::sorted_unique, keys),
+               std::invalid_argument);
+}
+
+TEST(FrozenSetTest, CustomCompare) {
+  s21::frozen_set<int, std::greater<int>> s{1, 3, 2, 3};
+  std::vector<int> keys(s.begin(), s.end());
+  EXPECT_EQ(keys, (std::vector<int>{3, 2, 1}));
+  EXPECT_EQ(*s.lower_bound(4), 3);
+  EXPECT_EQ(*s.upper_bound(3), 2);
+}
+
+TEST(FrozenSetTest, RandomKeysMatchStd) {
+  std::mt19937 rng(12);
+  std::vector<unsigned> keys;
+  for (int i = 0; i < 100000; i++) keys.push_back(rng() % 1000000);
+  s21::frozen_set<unsigned> s(keys.begin(), keys.end());
+  std::set<unsigned> expected(keys.begin(), keys.end());
+  EXPECT_EQ(s.size(), expected.size());
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), s.begin()));
+  for (int i = 0; i < 100000; i++) {
+    unsigned key = rng() % 1000000;
+    ASSERT_EQ(s.contains(key), expected.count(key) == 1);
+  }
+}
+
+TEST(FrozenSetTest, CopyMoveAndSwap) {
+  s21::frozen_set<std::string> a{"a", "b", "c"};
+  s21::frozen_set<std::string> b(a);
+  EXPECT_EQ(b.size(), 3);
+  EXPECT_TRUE(b.contains("b"));
+  s21::frozen_set<std::string> c(std::move(a));
+  EXPECT_EQ(c.size(), 3);
+  EXPECT_TRUE(a.empty());
+  s21::frozen_set<std::string> d{"x"};
+  d = c;
+  EXPECT_EQ(d.size(), 3);
+  d.swap(a);
+  EXPECT_TRUE(d.empty());
+  EXPECT_TRUE(a.contains("c"));
+  d = std::move(a);
+  EXPECT_TRUE(d.contains("a"));
+}
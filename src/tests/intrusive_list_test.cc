@@ -0,0 +1,164 @@
+#include <vector>
+
+#include "testing.h"
+
+namespace {
+
+struct Timer {
+  int id;
+  s21::list_hook hook;
+  s21::list_hook expired_hook;
+  explicit Timer(int i = 0) : id(i) {}
+};
+
+using timer_list = s21::intrusive_list<Timer, &Timer::hook>;
+using expired_list = s21::intrusive_list<Timer, &Timer::expired_hook>;
+
+std::vector<int> ids(const timer_list &l) {
+  std::vector<int> res;
+  for (auto it = l.begin(); it != l.end(); ++it) res.push_back((*it).id);
+  return res;
+}
+
+}  // namespace
+
+TEST(IntrusiveListTest, DefaultConstructor) {
+  timer_list l;
+  EXPECT_TRUE(l.empty());
+  EXPECT_EQ(l.size(), 0);
+  EXPECT_TRUE(l.begin() == l.end());
+}
+
+TEST(IntrusiveListTest, PushBackFront) {
+  Timer t[4] = {Timer(0), Timer(1), Timer(2), Timer(3)};
+  timer_list l;
+  l.push_back(t[1]);
+  l.push_back(t[2]);
+  l.push_front(t[0]);
+  l.push_back(t[3]);
+  EXPECT_EQ(l.size(), 4);
+  EXPECT_EQ(ids(l), (std::vector<int>{0, 1, 2, 3}));
+  EXPECT_EQ(&l.front(), &t[0]);
+  EXPECT_EQ(&l.back(), &t[3]);
+}
+
+TEST(IntrusiveListTest, PopBackFront) {
+  Timer t[3] = {Timer(0), Timer(1), Timer(2)};
+  timer_list l;
+  for (auto &timer : t) l.push_back(timer);
+  l.pop_front();
+  l.pop_back();
+  EXPECT_EQ(ids(l), (std::vector<int>{1}));
+  EXPECT_FALSE(timer_list::is_linked(t[0]));
+  EXPECT_FALSE(timer_list::is_linked(t[2]));
+  EXPECT_TRUE(timer_list::is_linked(t[1]));
+  l.pop_back();
+  l.pop_back();
+  EXPECT_TRUE(l.empty());
+}
+
+TEST(IntrusiveListTest, EraseFromAnywhere) {
+  Timer t[5] = {Timer(0), Timer(1), Timer(2), Timer(3), Timer(4)};
+  timer_list l;
+  for (auto &timer : t) l.push_back(timer);
+  l.erase(t[2]);
+  l.erase(t[0]);
+  l.erase(t[0]);
+  EXPECT_EQ(l.size(), 3);
+  EXPECT_EQ(ids(l), (std::vector<int>{1, 3, 4}));
+  auto next = l.erase(timer_list::iterator_to(t[3]));
+  EXPECT_EQ((*next).id, 4);
+  EXPECT_EQ(ids(l), (std::vector<int>{1, 4}));
+}
+
+TEST(IntrusiveListTest, Insert) {
+  Timer t[3] = {Timer(0), Timer(1), Timer(2)};
+  timer_list l;
+  l.push_back(t[0]);
+  l.push_back(t[2]);
+  auto it = l.insert(timer_list::iterator_to(t[2]), t[1]);
+  EXPECT_EQ(it->id, 1);
+  EXPECT_EQ(ids(l), (std::vector<int>{0, 1, 2}));
+}
+
+TEST(IntrusiveListTest, IteratorBackward) {
+  Timer t[3] = {Timer(0), Timer(1), Timer(2)};
+  timer_list l;
+  for (auto &timer : t) l.push_back(timer);
+  auto it = l.end();
+  --it;
+  EXPECT_EQ(it->id, 2);
+  --it;
+  --it;
+  EXPECT_TRUE(it == l.begin());
+}
+
+TEST(IntrusiveListTest, Splice) {
+  Timer t[5] = {Timer(0), Timer(1), Timer(2), Timer(3), Timer(4)};
+  timer_list l1;
+  timer_list l2;
+  l1.push_back(t[0]);
+  l1.push_back(t[4]);
+  l2.push_back(t[1]);
+  l2.push_back(t[2]);
+  l2.push_back(t[3]);
+  l1.splice(timer_list::iterator_to(t[4]), l2);
+  EXPECT_EQ(ids(l1), (std::vector<int>{0, 1, 2, 3, 4}));
+  EXPECT_EQ(l1.size(), 5);
+  EXPECT_TRUE(l2.empty());
+  l2.splice(l2.end(), l1, timer_list::iterator_to(t[2]));
+  EXPECT_EQ(ids(l1), (std::vector<int>{0, 1, 3, 4}));
+  EXPECT_EQ(ids(l2), (std::vector<int>{2}));
+  EXPECT_EQ(l1.size(), 4);
+  EXPECT_EQ(l2.size(), 1);
+}
+
+TEST(IntrusiveListTest, SwapAndMove) {
+  Timer t[3] = {Timer(0), Timer(1), Timer(2)};
+  timer_list l1;
+  timer_list l2;
+  l1.push_back(t[0]);
+  l1.push_back(t[1]);
+  l2.push_back(t[2]);
+  l1.swap(l2);
+  EXPECT_EQ(ids(l1), (std::vector<int>{2}));
+  EXPECT_EQ(ids(l2), (std::vector<int>{0, 1}));
+  timer_list l3(std::move(l2));
+  EXPECT_TRUE(l2.empty());
+  EXPECT_EQ(ids(l3), (std::vector<int>{0, 1}));
+  l3 = std::move(l1);
+  EXPECT_EQ(ids(l3), (std::vector<int>{2}));
+  EXPECT_FALSE(timer_list::is_linked(t[0]));
+}
+
+TEST(IntrusiveListTest, Reverse) {
+  Timer t[4] = {Timer(0), Timer(1), Timer(2), Timer(3)};
+  timer_list l;
+  for (auto &timer : t) l.push_back(timer);
+  l.reverse();
+  EXPECT_EQ(ids(l), (std::vector<int>{3, 2, 1, 0}));
+}
+
+TEST(IntrusiveListTest, TwoHooks) {
+  Timer t[3] = {Timer(0), Timer(1), Timer(2)};
+  timer_list active;
+  expired_list expired;
+  for (auto &timer : t) active.push_back(timer);
+  expired.push_back(t[1]);
+  active.erase(t[1]);
+  EXPECT_EQ(ids(active), (std::vector<int>{0, 2}));
+  EXPECT_EQ(expired.front().id, 1);
+  EXPECT_TRUE(expired_list::is_linked(t[1]));
+  EXPECT_FALSE(timer_list::is_linked(t[1]));
+}
+
+TEST(IntrusiveListTest, ClearUnlinks) {
+  Timer t[2] = {Timer(0), Timer(1)};
+  {
+    timer_list l;
+    l.push_back(t[0]);
+    l.push_back(t[1]);
+  }
+  EXPECT_FALSE(timer_list::is_linked(t[0]));
+  EXPECT_FALSE(timer_list::is_linked(t[1]));
+}
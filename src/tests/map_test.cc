@@ -390,4 +390,42 @@ TEST(map, insert_many) {
   for (; iter_1 != s21_map.end(); ++iter_1, ++i) {
     EXPECT_EQ(s21_map[i], i * 10);
   }
-}
\ No newline at end of file
+}
+
+TEST(map, erase_from_copy) {
+  std::initializer_list<std::pair<const int, int>> values = {
+      {4, 40}, {2, 20}, {6, 60}, {1, 10}, {3, 30}, {5, 50}, {7, 70}};
+  s21::map<int, int> s21_map{values};
+  std::map<int, int> std_map{values};
+  s21::map<int, int> s21_copy(s21_map);
+  std::map<int, int> std_copy(std_map);
+
+  auto erased = s21_copy.begin();
+  ++erased;
+  ++erased;
+  s21_copy.erase(erased);
+  std_copy.erase(3);
+  s21_copy.erase(--s21_copy.end());
+  std_copy.erase(7);
+
+  auto iter_1 = s21_copy.begin();
+  auto iter_2 = std_copy.begin();
+  for (; iter_2 != std_copy.end(); ++iter_1, ++iter_2) {
+    EXPECT_EQ(*iter_1, *iter_2);
+  }
+  EXPECT_TRUE(iter_1 == s21_copy.end());
+
+  auto riter_1 = s21_copy.end();
+  auto riter_2 = std_copy.rbegin();
+  for (; riter_2 != std_copy.rend(); ++riter_2) {
+    --riter_1;
+    EXPECT_EQ(*riter_1, *riter_2);
+  }
+
+  auto iter_3 = s21_map.begin();
+  auto iter_4 = std_map.begin();
+  for (; iter_4 != std_map.end(); ++iter_3, ++iter_4) {
+    EXPECT_EQ(*iter_3, *iter_4);
+  }
+  EXPECT_TRUE(iter_3 == s21_map.end());
+}
@@ -0,0 +1,106 @@
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "testing.h"
+
+TEST(MpmcQueueTest, TryPushTryPop) {
+  s21::mpmc_queue<int> q(3);
+  EXPECT_EQ(q.capacity(), 4);
+  EXPECT_TRUE(q.empty());
+  for (int i = 0; i < 4; i++) EXPECT_TRUE(q.try_push(i));
+  EXPECT_FALSE(q.try_push(4));
+  EXPECT_EQ(q.size(), 4);
+  int out = -1;
+  for (int i = 0; i < 4; i++) {
+    EXPECT_TRUE(q.try_pop(out));
+    EXPECT_EQ(out, i);
+  }
+  EXPECT_FALSE(q.try_pop(out));
+}
+
+TEST(MpmcQueueTest, WrapAround) {
+  s21::mpmc_queue<std::string> q(4);
+  std::string out;
+  for (int i = 0; i < 50; i++) {
+    EXPECT_TRUE(q.try_emplace(3, char('a' + i % 26)));
+    EXPECT_TRUE(q.try_push(std::to_string(i)));
+    EXPECT_TRUE(q.try_pop(out));
+    EXPECT_EQ(out, std::string(3, char('a' + i % 26)));
+    EXPECT_TRUE(q.try_pop(out));
+    EXPECT_EQ(out, std::to_string(i));
+  }
+  q.try_push("left for the destructor");
+}
+
+TEST(MpmcQueueTest, BulkOperations) {
+  s21::mpmc_queue<int> q(8);
+  std::vector<int> input{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  EXPECT_EQ(q.try_push_n(input.begin(), input.size()), 8);
+  int output[16] = {};
+  EXPECT_EQ(q.try_pop_n(output, 5), 5);
+  EXPECT_EQ(output[4], 5);
+  q.push_n(input.begin() + 8, 2);
+  EXPECT_EQ(q.pop_n(output, 16), 5);
+  EXPECT_EQ(output[0], 6);
+  EXPECT_EQ(output[4], 10);
+  EXPECT_EQ(q.try_pop_n(output, 16), 0);
+}
+
+TEST(MpmcQueueTest, BlockingProducersConsumers) {
+  const int kThreads = 4;
+  const int kPerThread = 20000;
+  s21::mpmc_queue<int> q(16);
+  std::atomic<long long> sum{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; t++) {
+    threads.emplace_back([&q] {
+      for (int i = 1; i <= kPerThread; i++) q.push(i);
+    });
+    threads.emplace_back([&q, &sum] {
+      long long local = 0;
+      int value = 0;
+      for (int i = 0; i < kPerThread; i++) {
+        q.pop(value);
+        local += value;
+      }
+      sum += local;
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  EXPECT_EQ(sum.load(), 1LL * kThreads * kPerThread * (kPerThread + 1) / 2);
+  EXPECT_TRUE(q.empty());
+}
+
+TEST(MpmcQueueTest, BlockingBulkConsumers) {
+  const int kValues = 30000;
+  s21::mpmc_queue<int> q(32);
+  std::atomic<int> received{0};
+  std::atomic<long long> sum{0};
+  std::thread producer([&q] {
+    std::vector<int> batch(10);
+    for (int i = 0; i < kValues; i += 10) {
+      for (int j = 0; j < 10; j++) batch[j] = i + j;
+      q.push_n(batch.begin(), batch.size());
+    }
+  });
+  std::vector<std::thread> consumers;
+  for (int t = 0; t < 3; t++) {
+    consumers.emplace_back([&] {
+      int batch[7];
+      while (received.load() < kValues) {
+        std::size_t n = q.try_pop_n(batch, 7);
+        if (n == 0) {
+          std::this_thread::yield();
+          continue;
+        }
+        for (std::size_t i = 0; i < n; i++) sum += batch[i];
+        received += int(n);
+      }
+    });
+  }
+  producer.join();
+  for (auto &consumer : consumers) consumer.join();
+  EXPECT_EQ(sum.load(), 1LL * kValues * (kValues - 1) / 2);
+}
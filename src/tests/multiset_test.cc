@@ -433,4 +433,24 @@ TEST(multiset, insert_many) {
   EXPECT_EQ(res[3].second, true);
   EXPECT_EQ(*(res[4].first), 9);
   EXPECT_EQ(res[4].second, true);
-}
\ No newline at end of file
+}
+
+TEST(multiset, erase_root_with_two_children) {
+  s21::multiset<int> s21_multiset = {4, 2, 6, 1, 3, 5, 7};
+  std::multiset<int> std_multiset = {4, 2, 6, 1, 3, 5, 7};
+
+  s21_multiset.erase(s21_multiset.find(4));
+  std_multiset.erase(std_multiset.find(4));
+  s21_multiset.insert(8);
+  std_multiset.insert(8);
+  s21_multiset.insert(4);
+  std_multiset.insert(4);
+
+  EXPECT_EQ(s21_multiset.size(), std_multiset.size());
+  auto s21_it = s21_multiset.begin();
+  auto std_it = std_multiset.begin();
+  for (; std_it != std_multiset.end(); ++s21_it, ++std_it) {
+    EXPECT_EQ(*s21_it, *std_it);
+  }
+  EXPECT_TRUE(s21_it == s21_multiset.end());
+}
@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "testing.h"
+
+namespace {
+
+template <typename Heap>
+std::vector<int> drain(Heap &h) {
+  std::vector<int> res;
+  while (!h.empty()) {
+    res.push_back(h.top());
+    h.pop();
+  }
+  return res;
+}
+
+}  // namespace
+
+TEST(PairingHeapTest, PushPopOrder) {
+  s21::pairing_heap<int> h;
+  EXPECT_TRUE(h.empty());
+  h.pop();
+  h.insert_many(5, 1, 4);
+  h.emplace(2);
+  auto three = h.push(3);
+  EXPECT_EQ(*three, 3);
+  EXPECT_EQ(h.size(), 5);
+  EXPECT_EQ(h.top(), 1);
+  EXPECT_EQ(drain(h), (std::vector<int>{1, 2, 3, 4, 5}));
+}
+
+TEST(PairingHeapTest, CustomCompare) {
+  s21::pairing_heap<int, std::greater<int>> h{3, 9, 1};
+  EXPECT_EQ(h.top(), 9);
+  EXPECT_EQ(*h.top_handle(), 9);
+}
+
+TEST(PairingHeapTest, DecreaseKey) {
+  s21::pairing_heap<int> h;
+  std::vector<s21::pairing_heap<int>::handle> handles;
+  for (int i = 0; i < 100; i++) handles.push_back(h.push(100 + i));
+  h.pop();
+  h.decrease_key(handles[50], 5);
+  EXPECT_EQ(h.top(), 5);
+  h.decrease_key(handles[99], 4);
+  h.decrease_key(handles[99], 3);
+  EXPECT_EQ(*handles[99], 3);
+  EXPECT_THROW(h.decrease_key(handles[99], 300), std::invalid_argument);
+  std::vector<int> out = drain(h);
+  EXPECT_EQ(out.size(), 99);
+  EXPECT_EQ(out[0], 3);
+  EXPECT_EQ(out[1], 5);
+  EXPECT_TRUE(std::is_sorted(out.begin(), out.end()));
+}
+
+TEST(PairingHeapTest, UpdateAndErase) {
+  s21::pairing_heap<int> h;
+  std::vector<s21::pairing_heap<int>::handle> handles;
+  for (int i = 0; i < 20; i++) handles.push_back(h.push(i));
+  h.update(handles[0], 50);
+  h.update(handles[10], 60);
+  h.update(handles[19], -1);
+  h.erase(handles[5]);
+  h.erase(handles[19]);
+  EXPECT_EQ(h.size(), 18);
+  EXPECT_EQ(h.top(), 1);
+  std::vector<int> out = drain(h);
+  EXPECT_TRUE(std::is_sorted(out.begin(), out.end()));
+  EXPECT_EQ(out.back(), 60);
+  EXPECT_EQ(std::count(out.begin(), out.end(), 5), 0);
+}
+
+TEST(PairingHeapTest, Meld) {
+  s21::pairing_heap<int> a{5, 3, 7};
+  s21::pairing_heap<int> b;
+  auto handle = b.push(9);
+  b.push(1);
+  a.meld(b);
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(a.size(), 5);
+  a.decrease_key(handle, 0);
+  EXPECT_EQ(drain(a), (std::vector<int>{0, 1, 3, 5, 7}));
+  b.push(2);
+  EXPECT_EQ(b.top(), 2);
+}
+
+TEST(PairingHeapTest, CopyMoveSwap) {
+  s21::pairing_heap<std::string> h{"pear", "apple", "plum"};
+  s21::pairing_heap<std::string> copy(h);
+  h.pop();
+  EXPECT_EQ(copy.top(), "apple");
+  EXPECT_EQ(copy.size(), 3);
+  s21::pairing_heap<std::string> moved(std::move(h));
+  EXPECT_TRUE(h.empty());
+  EXPECT_EQ(moved.top(), "pear");
+  moved.swap(copy);
+  EXPECT_EQ(moved.size(), 3);
+  copy = moved;
+  EXPECT_EQ(copy.size(), 3);
+  copy.clear();
+  EXPECT_TRUE(copy.empty());
+}
+
+TEST(PairingHeapTest, ManyRandomOperations) {
+  s21::pairing_heap<int> h;
+  std::vector<s21::pairing_heap<int>::handle> handles;
+  std::vector<int> keys;
+  unsigned state = 7;
+  for (int i = 0; i < 5000; i++) {
+    state = state * 1103515245 + 12345;
+    int key = int(state >> 16) % 100000;
+    handles.push_back(h.push(key));
+    keys.push_back(key);
+    if (i % 3 == 0) {
+      std::size_t which = (state >> 4) % handles.size();
+      if (keys[which] >= 0) {
+        keys[which] -= 1000;
+        h.decrease_key(handles[which], keys[which]);
+      }
+    }
+  }
+  std::vector<int> out = drain(h);
+  std::sort(keys.begin(), keys.end());
+  EXPECT_EQ(out, keys);
+}
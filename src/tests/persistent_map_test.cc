@@ -0,0 +1,198 @@
+#include <atomic>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "testing.h"
+
+namespace {
+
+template <typename Map>
+std::vector<std::pair<int, int>> entries(const Map &m) {
+  std::vector<std::pair<int, int>> res;
+  for (const auto &entry : m) res.emplace_back(entry.first, entry.second);
+  return res;
+}
+
+std::vector<std::pair<int, int>> entries(const std::map<int, int> &m) {
+  return std::vector<std::pair<int, int>>(m.begin(), m.end());
+}
+
+}  // namespace
+
+TEST(PersistentMapTest, EditsMakeNewVersions) {
+  const s21::persistent_map<int, std::string> empty;
+  auto one = empty.insert(1, "a");
+  auto two = one.insert({2, "b"});
+  auto three = two.insert_or_assign(1, "x");
+  auto four = three.erase(2);
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(one.size(), 1);
+  EXPECT_EQ(two.size(), 2);
+  EXPECT_EQ(two.at(1), "a");
+  EXPECT_EQ(three.at(1), "x");
+  EXPECT_EQ(three.at(2), "b");
+  EXPECT_EQ(four.size(), 1);
+  EXPECT_FALSE(four.contains(2));
+  EXPECT_TRUE(two.contains(2));
+  EXPECT_THROW(four.at(2), std::out_of_range);
+}
+
+TEST(PersistentMapTest, NoOpEditsShareTheRoot) {
+  s21::persistent_map<int, int> m{{1, 1}, {2, 2}, {3, 3}};
+  EXPECT_TRUE(m.insert(2, 5).shares_root_with(m));
+  EXPECT_TRUE(m.erase(7).shares_root_with(m));
+  auto copy = m;
+  EXPECT_TRUE(copy.shares_root_with(m));
+  EXPECT_FALSE(m.erase(2).shares_root_with(m));
+  EXPECT_EQ(m.insert(2, 5).at(2), 2);
+}
+
+TEST(PersistentMapTest, Lookups) {
+  s21::persistent_map<int, int> m{{10, 1}, {20, 2}, {30, 3}};
+  EXPECT_EQ(m.find(20)->second, 2);
+  EXPECT_TRUE(m.find(25) == m.end());
+  EXPECT_EQ(m.lower_bound(20)->first, 20);
+  EXPECT_EQ(m.lower_bound(21)->first, 30);
+  EXPECT_EQ(m.upper_bound(20)->first, 30);
+  EXPECT_TRUE(m.upper_bound(30) == m.end());
+  EXPECT_EQ(m.count(10), 1);
+  auto it = m.lower_bound(0);
+  EXPECT_EQ((it++)->first, 10);
+  EXPECT_EQ(it->first, 20);
+}
+
+TEST(PersistentMapTest, EveryVersionMatchesStd) {
+  std::mt19937 rng(5);
+  std::vector<s21::persistent_map<int, int>> versions(1);
+  std::vector<std::map<int, int>> expected(1);
+  for (int i = 0; i < 3000; i++) {
+    int key = int(rng() % 500);
+    s21::persistent_map<int, int> next = versions.back();
+    std::map<int, int> next_expected = expected.back();
+    switch (rng() % 3) {
+      case 0:
+        next = next.insert(key, i);
+        next_expected.emplace(key, i);
+        break;
+      case 1:
+        next = next.insert_or_assign(key, i);
+        next_expected[key] = i;
+        break;
+      default:
+        next = next.erase(key);
+        next_expected.erase(key);
+    }
+    versions.push_back(next);
+    expected.push_back(next_expected);
+  }
+  for (std::size_t v = 0; v < versions.size(); v += 97) {
+    EXPECT_EQ(versions[v].size(), expected[v].size());
+    EXPECT_EQ(entries(versions[v]), entries(expected[v]));
+  }
+  EXPECT_EQ(entries(versions.back()), entries(expected.back()));
+}
+
+TEST(PersistentMapTest, TransientBuildsInPlace) {
+  s21::persistent_map<int, int> base{{1, 1}, {2, 2}};
+  auto builder = base.transient();
+  for (int i = 0; i < 1000; i++) builder.insert(i, -i);
+  EXPECT_TRUE(builder.insert_or_assign(2, 20) == false);
+  EXPECT_EQ(builder.erase(3), 1);
+  EXPECT_EQ(builder.erase(3), 0);
+  auto snapshot = builder.persistent();
+  builder.insert_or_assign(1, 100);
+  builder.erase(500);
+  auto later = builder.persistent();
+  EXPECT_EQ(base.size(), 2);
+  EXPECT_EQ(base.at(2), 2);
+  EXPECT_EQ(snapshot.size(), 999);
+  EXPECT_EQ(snapshot.at(1), 1);
+  EXPECT_EQ(snapshot.at(2), 20);
+  EXPECT_EQ(snapshot.at(500), -500);
+  EXPECT_EQ(later.size(), 998);
+  EXPECT_EQ(later.at(1), 100);
+  EXPECT_FALSE(later.contains(500));
+  int expected = 0;
+  for (const auto &entry : later) {
+    if (expected == 3 || expected == 500) expected++;
+    ASSERT_EQ(entry.first, expected++);
+  }
+}
+
+TEST(PersistentMapTest, NodesAreFreedWithTheLastVersion) {
+  static int alive = 0;
+  struct Tracked {
+    Tracked() { alive++; }
+    Tracked(const Tracked &) { alive++; }
+    ~Tracked() { alive--; }
+  };
+  {
+    s21::persistent_map<int, Tracked> m;
+    for (int i = 0; i < 100; i++) m = m.insert(i, Tracked());
+    EXPECT_EQ(alive, 100);
+    auto erased = m.erase(50);
+    // Only the path to the erased key was copied.
+    EXPECT_LT(alive, 100 + 16);
+    m = erased;
+    EXPECT_EQ(alive, 99);
+  }
+  EXPECT_EQ(alive, 0);
+}
+
+TEST(PersistentMapTest, SnapshotsReadFromOtherThreads) {
+  s21::persistent_map<int, int> m;
+  for (int i = 0; i < 1000; i++) m = m.insert(i, i);
+  std::vector<std::thread> readers;
+  std::atomic<int> errors(0);
+  for (int t = 0; t < 3; t++) {
+    readers.emplace_back([snapshot = m, &errors] {
+      for (int round = 0; round < 20; round++) {
+        int expected = 0;
+        for (const auto &entry : snapshot) {
+          if (entry.first != expected++ || entry.second != entry.first) {
+            errors++;
+          }
+        }
+        if (expected != 1000) errors++;
+      }
+    });
+  }
+  for (int i = 0; i < 1000; i++) m = m.insert_or_assign(i, -i).erase(i - 1);
+  for (auto &reader : readers) reader.join();
+  EXPECT_EQ(errors.load(), 0);
+  EXPECT_EQ(m.size(), 1);
+  EXPECT_EQ(m.at(999), -999);
+}
+
+// Erasing a node with one child leaves the child, which the snapshot still
+// shares, in its place. Run under ThreadSanitizer, any write to such a
+// shared node shows up as a race between the two erasing threads.
+TEST(PersistentMapTest, ErasesFromCopiesLeaveSharedNodesAlone) {
+  s21::persistent_map<int, int> snapshot;
+  for (int i = 0; i < 1000; i++) snapshot = snapshot.insert(i, i);
+  std::vector<std::thread> writers;
+  std::atomic<int> errors(0);
+  for (int t = 0; t < 2; t++) {
+    writers.emplace_back([snapshot, t, &errors] {
+      for (int round = 0; round < 20; round++) {
+        auto copy = snapshot;
+        for (int i = t; i < 1000; i += 2) copy = copy.erase(i);
+        if (copy.size() != 500) errors++;
+        int expected = 1 - t;
+        for (const auto &entry : copy) {
+          if (entry.first != expected) errors++;
+          expected += 2;
+        }
+      }
+    });
+  }
+  for (auto &writer : writers) writer.join();
+  EXPECT_EQ(errors.load(), 0);
+  std::vector<std::pair<int, int>> expected;
+  for (int i = 0; i < 1000; i++) expected.emplace_back(i, i);
+  EXPECT_EQ(entries(snapshot), expected);
+}
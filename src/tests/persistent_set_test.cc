@@ -0,0 +1,34 @@
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "testing.h"
+
+TEST(PersistentSetTest, Versions) {
+  const s21::persistent_set<std::string> fruits{"pear", "apple", "fig"};
+  auto more = fruits.insert("plum");
+  auto fewer = more.erase("apple");
+  EXPECT_EQ(fruits.size(), 3);
+  EXPECT_EQ(more.size(), 4);
+  EXPECT_EQ(fewer.size(), 3);
+  EXPECT_FALSE(fruits.contains("plum"));
+  EXPECT_TRUE(more.contains("apple"));
+  EXPECT_EQ(*fewer.begin(), "fig");
+  EXPECT_EQ(*more.lower_bound("b"), "fig");
+  EXPECT_EQ(*more.upper_bound("pear"), "plum");
+  EXPECT_TRUE(fruits.insert("fig").shares_root_with(fruits));
+}
+
+TEST(PersistentSetTest, TransientAndCustomCompare) {
+  s21::persistent_set<int, std::greater<int>>::transient_type builder;
+  for (int i = 0; i < 100; i++) builder.insert(i % 10);
+  EXPECT_EQ(builder.size(), 10);
+  EXPECT_TRUE(builder.contains(9));
+  auto s = builder.persistent();
+  builder.clear();
+  EXPECT_TRUE(builder.empty());
+  std::vector<int> keys(s.begin(), s.end());
+  EXPECT_EQ(keys, (std::vector<int>{9, 8, 7, 6, 5, 4, 3, 2, 1, 0}));
+  EXPECT_EQ(*s.find(4), 4);
+  EXPECT_TRUE(s.find(42) == s.end());
+}
@@ -0,0 +1,115 @@
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "testing.h"
+
+namespace {
+
+template <typename Queue>
+std::vector<int> drain(Queue &q) {
+  std::vector<int> res;
+  while (!q.empty()) {
+    res.push_back(q.top());
+    q.pop();
+  }
+  return res;
+}
+
+std::vector<int> shuffled(int n) {
+  std::vector<int> res;
+  for (int i = 0; i < n; i++) res.push_back(i * 7919 % n);
+  return res;
+}
+
+}  // namespace
+
+TEST(PriorityQueueTest, PushPopOrder) {
+  s21::priority_queue<int> q;
+  EXPECT_TRUE(q.empty());
+  q.pop();
+  q.push(3);
+  q.push(1);
+  q.emplace(4);
+  q.push(1);
+  q.push(5);
+  EXPECT_EQ(q.size(), 5);
+  EXPECT_EQ(q.top(), 5);
+  EXPECT_EQ(drain(q), (std::vector<int>{5, 4, 3, 1, 1}));
+}
+
+TEST(PriorityQueueTest, InitializerListAndCompare) {
+  s21::priority_queue<int, s21::vector<int>, std::greater<int>> q{5, 2, 8, 1};
+  EXPECT_EQ(q.top(), 1);
+  EXPECT_EQ(drain(q), (std::vector<int>{1, 2, 5, 8}));
+}
+
+TEST(PriorityQueueTest, ManyValuesAnyArity) {
+  std::vector<int> input = shuffled(1000);
+  std::vector<int> expected(input);
+  std::sort(expected.rbegin(), expected.rend());
+  s21::priority_queue<int, s21::vector<int>, std::less<int>, 2> binary;
+  s21::priority_queue<int> quaternary;
+  s21::priority_queue<int, s21::vector<int>, std::less<int>, 8> octal;
+  for (int value : input) {
+    binary.push(value);
+    quaternary.push(value);
+    octal.push(value);
+  }
+  EXPECT_EQ(drain(binary), expected);
+  EXPECT_EQ(drain(quaternary), expected);
+  EXPECT_EQ(drain(octal), expected);
+}
+
+TEST(PriorityQueueTest, PushRange) {
+  std::vector<int> input = shuffled(500);
+  s21::priority_queue<int> heapified(input.begin(), input.end());
+  EXPECT_EQ(heapified.top(), 499);
+  s21::priority_queue<int> q;
+  q.push_range(input.begin(), input.begin() + 400);
+  q.push_range(input.begin() + 400, input.end());
+  std::vector<int> expected(input);
+  std::sort(expected.rbegin(), expected.rend());
+  EXPECT_EQ(drain(q), expected);
+  EXPECT_EQ(drain(heapified), expected);
+}
+
+TEST(PriorityQueueTest, PopN) {
+  std::vector<int> input = shuffled(100);
+  s21::priority_queue<int> q(input.begin(), input.end());
+  std::vector<int> out;
+  EXPECT_EQ(q.pop_n(std::back_inserter(out), 3), 3);
+  EXPECT_EQ(out, (std::vector<int>{99, 98, 97}));
+  EXPECT_EQ(q.size(), 97);
+  EXPECT_EQ(q.pop_n(std::back_inserter(out), 1000), 97);
+  EXPECT_TRUE(q.empty());
+  EXPECT_EQ(out.back(), 0);
+}
+
+TEST(PriorityQueueTest, MoveOnlyFriendlyValues) {
+  s21::priority_queue<std::string> q;
+  q.insert_many(std::string("pear"), std::string("apple"),
+                std::string("plum"));
+  s21::priority_queue<std::string> copy(q);
+  s21::priority_queue<std::string> moved(std::move(q));
+  EXPECT_EQ(moved.top(), "plum");
+  moved.pop();
+  EXPECT_EQ(moved.top(), "pear");
+  EXPECT_EQ(copy.size(), 3);
+  copy.swap(moved);
+  EXPECT_EQ(copy.size(), 2);
+  EXPECT_EQ(moved.top(), "plum");
+}
+
+TEST(PriorityQueueTest, PushTopOfItself) {
+  s21::priority_queue<std::string> q;
+  q.push("apple");
+  q.push(q.top());
+  q.push(q.top());
+  ASSERT_EQ(q.size(), 3);
+  for (int i = 0; i < 3; i++) {
+    EXPECT_EQ(q.top(), "apple");
+    q.pop();
+  }
+}
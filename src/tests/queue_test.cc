@@ -212,4 +212,86 @@ TEST(QueueTest, InsertManyBack) {
   our_queue_int.insert_many_back(1, 2, 3);
   EXPECT_EQ(our_queue_int.front(), 1);
   EXPECT_EQ(our_queue_int.back(), 3);
-}
\ No newline at end of file
+}
+
+TEST(QueueTest, PushRangePopInto) {
+  s21::queue<int> my_queue{1, 2};
+  int input[] = {3, 4, 5, 6};
+  my_queue.push_range(input, input + 4);
+  EXPECT_EQ(my_queue.size(), 6);
+  EXPECT_EQ(my_queue.back(), 6);
+  int output[4] = {};
+  EXPECT_EQ(my_queue.pop_into(output, 4), 4);
+  EXPECT_EQ(output[0], 1);
+  EXPECT_EQ(output[3], 4);
+  EXPECT_EQ(my_queue.front(), 5);
+  EXPECT_EQ(my_queue.size(), 2);
+}
+
+TEST(QueueTest, ManyPushPop) {
+  s21::queue<int> my_queue;
+  std::queue<int> std_queue;
+  for (int i = 0; i < 1000; i++) {
+    my_queue.push(i);
+    std_queue.push(i);
+    if (i % 3 == 0) {
+      my_queue.pop();
+      std_queue.pop();
+    }
+  }
+  EXPECT_TRUE(compare_queues(my_queue, std_queue));
+}
+
+TEST(QueueTest, ListContainer) {
+  s21::queue<int, s21::list<int>> my_queue{1, 2, 3};
+  my_queue.push(4);
+  my_queue.pop();
+  my_queue.insert_many_back(5, 6);
+  EXPECT_EQ(my_queue.front(), 2);
+  EXPECT_EQ(my_queue.back(), 6);
+  EXPECT_EQ(my_queue.size(), 5);
+}
+
+TEST(QueueTest, MoveAssignmentLeavesSourceEmpty) {
+  s21::queue<int> my_queue{1, 2, 3};
+  s21::queue<int> my_queue_move{4, 5};
+  my_queue = std::move(my_queue_move);
+  EXPECT_EQ(my_queue.size(), 2);
+  EXPECT_EQ(my_queue.front(), 4);
+  EXPECT_TRUE(my_queue_move.empty());
+  EXPECT_TRUE(std::is_nothrow_move_constructible_v<s21::queue<int>>);
+  EXPECT_TRUE(std::is_nothrow_move_assignable_v<s21::queue<int>>);
+}
+
+TEST(QueueTest, CopyAssignment) {
+  s21::queue<int> my_queue{1};
+  s21::queue<int> my_queue_copy{2, 3};
+  my_queue = my_queue_copy;
+  my_queue.pop();
+  EXPECT_EQ(my_queue.front(), 3);
+  EXPECT_EQ(my_queue_copy.front(), 2);
+  EXPECT_EQ(my_queue_copy.size(), 2);
+}
+
+TEST(QueueTest, MoveAssignmentListContainer) {
+  s21::queue<int, s21::list<int>> my_queue{1, 2, 3};
+  s21::queue<int, s21::list<int>> my_queue_move{4};
+  my_queue = std::move(my_queue_move);
+  EXPECT_EQ(my_queue.size(), 1);
+  EXPECT_TRUE(my_queue_move.empty());
+  my_queue_move = my_queue;
+  EXPECT_EQ(my_queue_move.front(), 4);
+}
+
+TEST(QueueTest, MoveEmptyListContainer) {
+  s21::queue<int, s21::list<int>> empty_queue;
+  s21::queue<int, s21::list<int>> my_queue(std::move(empty_queue));
+  my_queue.push(1);
+  my_queue.push(2);
+  empty_queue.push(3);
+  EXPECT_EQ(my_queue.size(), 2);
+  EXPECT_EQ(my_queue.front(), 1);
+  EXPECT_EQ(my_queue.back(), 2);
+  EXPECT_EQ(empty_queue.size(), 1);
+  EXPECT_EQ(empty_queue.front(), 3);
+}
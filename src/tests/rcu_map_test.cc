@@ -0,0 +1,135 @@
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "testing.h"
+
+TEST(RcuMapTest, SingleThreaded) {
+  s21::rcu_map<int, std::string> m{{1, "a"}, {2, "b"}};
+  EXPECT_EQ(m.size(), 2);
+  EXPECT_TRUE(m.contains(1));
+  EXPECT_TRUE(m.insert(3, "c"));
+  EXPECT_FALSE(m.insert(3, "x"));
+  EXPECT_FALSE(m.insert_or_assign(1, "z"));
+  std::string value;
+  EXPECT_TRUE(m.find_and(1, [&](const std::string &v) { value = v; }));
+  EXPECT_EQ(value, "z");
+  EXPECT_FALSE(m.find_and(7, [&](const std::string &v) { value = v; }));
+  EXPECT_EQ(m.erase(2), 1);
+  EXPECT_EQ(m.erase(2), 0);
+  EXPECT_EQ(m.size(), 2);
+  m.clear();
+  EXPECT_TRUE(m.empty());
+}
+
+TEST(RcuMapTest, SnapshotsAndBatches) {
+  s21::rcu_map<int, int> m;
+  auto before = m.snapshot();
+  m.update([](s21::rcu_map<int, int>::transient_type &batch) {
+    for (int i = 0; i < 100; i++) batch.insert(i, i);
+    batch.erase(50);
+  });
+  auto after = m.snapshot();
+  EXPECT_TRUE(before.empty());
+  EXPECT_EQ(after.size(), 99);
+  m.insert_or_assign(0, -1);
+  EXPECT_EQ(after.at(0), 0);
+  EXPECT_EQ(m.snapshot().at(0), -1);
+  // A batch that changes nothing publishes nothing.
+  auto current = m.snapshot();
+  m.update([](s21::rcu_map<int, int>::transient_type &batch) {
+    batch.insert(1, 5);
+    batch.erase(1000);
+  });
+  EXPECT_TRUE(m.snapshot().shares_root_with(current));
+  int sum = m.read([](const s21::persistent_map<int, int> &version) {
+    int res = 0;
+    for (const auto &entry : version) res += entry.second;
+    return res;
+  });
+  EXPECT_EQ(sum, 99 * 100 / 2 - 50 - 1);
+}
+
+TEST(RcuMapTest, ReadersSeeWholeBatches) {
+  // Every batch moves one unit between two keys, so any version a reader
+  // sees sums to the same total.
+  const int kKeys = 64;
+  const int kTotal = kKeys * 100;
+  s21::rcu_map<int, int> m;
+  m.update([&](s21::rcu_map<int, int>::transient_type &batch) {
+    for (int i = 0; i < kKeys; i++) batch.insert(i, 100);
+  });
+  std::atomic<bool> stop(false);
+  std::atomic<int> errors(0);
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 3; t++) {
+    readers.emplace_back([&] {
+      while (!stop.load()) {
+        int sum = m.read([](const s21::persistent_map<int, int> &version) {
+          int res = 0;
+          for (const auto &entry : version) res += entry.second;
+          return res;
+        });
+        if (sum != kTotal) errors++;
+        if (!m.contains(kKeys - 1)) errors++;
+      }
+    });
+  }
+  std::vector<std::thread> writers;
+  for (int t = 0; t < 2; t++) {
+    writers.emplace_back([&, t] {
+      for (int i = 0; i < 2000; i++) {
+        int from = (i * 7 + t) % kKeys;
+        int to = (i * 13 + 1) % kKeys;
+        m.update([&](s21::rcu_map<int, int>::transient_type &batch) {
+          int a = batch.at(from);
+          int b = batch.at(to);
+          if (from == to) return;
+          batch.insert_or_assign(from, a - 1);
+          batch.insert_or_assign(to, b + 1);
+        });
+      }
+    });
+  }
+  for (auto &writer : writers) writer.join();
+  stop = true;
+  for (auto &reader : readers) reader.join();
+  EXPECT_EQ(errors.load(), 0);
+  EXPECT_EQ(m.size(), std::size_t(kKeys));
+}
+
+TEST(RcuMapTest, ReplacedVersionsAreFreed) {
+  static std::atomic<int> alive(0);
+  struct Tracked {
+    Tracked() { alive++; }
+    Tracked(const Tracked &) { alive++; }
+    ~Tracked() { alive--; }
+  };
+  {
+    s21::rcu_map<int, Tracked> m;
+    for (int i = 0; i < 200; i++) m.insert(i, Tracked());
+    for (int i = 0; i < 200; i += 2) m.erase(i);
+    for (int i = 0; i < 8; i++) s21::epoch_domain::instance().collect();
+    EXPECT_EQ(alive.load(), 100);
+  }
+  EXPECT_EQ(alive.load(), 0);
+}
+
+TEST(RcuMapTest, ReplacedVersionIsFreedByTheNextUpdate) {
+  static std::atomic<int> alive(0);
+  struct Tracked {
+    Tracked() { alive++; }
+    Tracked(const Tracked &) { alive++; }
+    ~Tracked() { alive--; }
+  };
+  {
+    s21::rcu_map<int, Tracked> m;
+    m.insert(1, Tracked());
+    m.insert_or_assign(1, Tracked());
+    m.insert_or_assign(1, Tracked());
+    // The version holding the second value is retired but may still be
+    // read; the one holding the first is gone.
+    EXPECT_EQ(alive.load(), 2);
+  }
+}
@@ -0,0 +1,136 @@
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "testing.h"
+
+template <typename value_type>
+bool compare_buffers(const s21::ring_buffer<value_type> &my_buffer,
+                     const std::deque<value_type> &std_deque) {
+  bool result = my_buffer.size() == std_deque.size();
+  for (size_t i = 0; result && i < std_deque.size(); i++) {
+    result = my_buffer[i] == std_deque[i];
+  }
+  return result;
+}
+
+TEST(RingBufferTest, DefaultConstructor) {
+  s21::ring_buffer<int> my_buffer;
+  EXPECT_TRUE(my_buffer.empty());
+  EXPECT_EQ(my_buffer.size(), 0);
+  EXPECT_EQ(my_buffer.capacity(), 0);
+}
+
+TEST(RingBufferTest, InitializerListConstructor) {
+  s21::ring_buffer<int> my_buffer{1, 2, 3, 4, 5};
+  EXPECT_TRUE(compare_buffers(my_buffer, std::deque<int>{1, 2, 3, 4, 5}));
+  EXPECT_EQ(my_buffer.front(), 1);
+  EXPECT_EQ(my_buffer.back(), 5);
+}
+
+TEST(RingBufferTest, CapacityIsPowerOfTwo) {
+  s21::ring_buffer<int> my_buffer;
+  my_buffer.reserve(100);
+  EXPECT_EQ(my_buffer.capacity(), 128);
+  for (int i = 0; i < 129; i++) my_buffer.push_back(i);
+  EXPECT_EQ(my_buffer.capacity(), 256);
+}
+
+TEST(RingBufferTest, WrapAround) {
+  s21::ring_buffer<int> my_buffer;
+  std::deque<int> std_deque;
+  my_buffer.reserve(8);
+  for (int round = 0; round < 20; round++) {
+    for (int i = 0; i < 5; i++) {
+      my_buffer.push_back(round * 10 + i);
+      std_deque.push_back(round * 10 + i);
+    }
+    for (int i = 0; i < 4; i++) {
+      my_buffer.pop_front();
+      std_deque.pop_front();
+    }
+    EXPECT_TRUE(compare_buffers(my_buffer, std_deque));
+  }
+  EXPECT_EQ(my_buffer.capacity(), 32);
+}
+
+TEST(RingBufferTest, GrowWhileWrapped) {
+  s21::ring_buffer<std::string> my_buffer;
+  std::deque<std::string> std_deque;
+  for (int i = 0; i < 6; i++) {
+    my_buffer.push_back(std::to_string(i));
+    std_deque.push_back(std::to_string(i));
+  }
+  for (int i = 0; i < 4; i++) {
+    my_buffer.pop_front();
+    std_deque.pop_front();
+  }
+  for (int i = 6; i < 30; i++) {
+    my_buffer.push_back(std::to_string(i));
+    std_deque.push_back(std::to_string(i));
+  }
+  EXPECT_TRUE(compare_buffers(my_buffer, std_deque));
+}
+
+TEST(RingBufferTest, CopyAndMove) {
+  s21::ring_buffer<int> my_buffer{1, 2, 3};
+  s21::ring_buffer<int> my_copy(my_buffer);
+  s21::ring_buffer<int> my_moved(std::move(my_buffer));
+  EXPECT_TRUE(compare_buffers(my_copy, std::deque<int>{1, 2, 3}));
+  EXPECT_TRUE(compare_buffers(my_moved, std::deque<int>{1, 2, 3}));
+  EXPECT_TRUE(my_buffer.empty());
+  my_buffer = my_copy;
+  EXPECT_TRUE(compare_buffers(my_buffer, std::deque<int>{1, 2, 3}));
+  my_copy = s21::ring_buffer<int>{7};
+  EXPECT_TRUE(compare_buffers(my_copy, std::deque<int>{7}));
+}
+
+TEST(RingBufferTest, PushRangePopInto) {
+  s21::ring_buffer<int> my_buffer{0};
+  std::vector<int> input{1, 2, 3, 4, 5, 6, 7, 8, 9};
+  my_buffer.push_range(input.begin(), input.end());
+  EXPECT_EQ(my_buffer.size(), 10);
+  EXPECT_EQ(my_buffer.capacity(), 16);
+  std::vector<int> output;
+  EXPECT_EQ(my_buffer.pop_into(std::back_inserter(output), 4), 4);
+  EXPECT_EQ(output, (std::vector<int>{0, 1, 2, 3}));
+  int rest[10];
+  EXPECT_EQ(my_buffer.pop_into(rest, 10), 6);
+  EXPECT_EQ(rest[0], 4);
+  EXPECT_EQ(rest[5], 9);
+  EXPECT_TRUE(my_buffer.empty());
+}
+
+TEST(RingBufferTest, PopBackAndAt) {
+  s21::ring_buffer<int> my_buffer{1, 2, 3};
+  my_buffer.pop_back();
+  EXPECT_EQ(my_buffer.back(), 2);
+  EXPECT_EQ(my_buffer.at(1), 2);
+  EXPECT_THROW(my_buffer.at(2), std::out_of_range);
+  my_buffer.emplace_back(8);
+  my_buffer.insert_many_back(9, 10);
+  EXPECT_TRUE(compare_buffers(my_buffer, std::deque<int>{1, 2, 8, 9, 10}));
+  my_buffer.clear();
+  my_buffer.pop_back();
+  my_buffer.pop_front();
+  EXPECT_TRUE(my_buffer.empty());
+}
+
+TEST(RingBufferTest, AppendOwnElementsAtCapacity) {
+  const std::string first(100, 'f');
+  const std::string last(100, 'l');
+  s21::ring_buffer<std::string> my_buffer;
+  my_buffer.push_back(first);
+  while (my_buffer.size() < my_buffer.capacity()) my_buffer.push_back(last);
+  std::size_t capacity = my_buffer.capacity();
+  my_buffer.emplace_back(my_buffer.front());
+  EXPECT_GT(my_buffer.capacity(), capacity);
+  EXPECT_EQ(my_buffer.back(), first);
+
+  while (my_buffer.size() < my_buffer.capacity()) my_buffer.push_back(last);
+  capacity = my_buffer.capacity();
+  my_buffer.insert_many_back(my_buffer.front(), my_buffer[1]);
+  EXPECT_GT(my_buffer.capacity(), capacity);
+  EXPECT_EQ(my_buffer[my_buffer.size() - 2], first);
+  EXPECT_EQ(my_buffer.back(), last);
+}
@@ -0,0 +1,234 @@
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "testing.h"
+
+namespace {
+
+std::vector<std::uint32_t> valuesOf(const s21::roaring_set &s) {
+  return std::vector<std::uint32_t>(s.begin(), s.end());
+}
+
+std::vector<std::uint32_t> valuesOf(const std::set<std::uint32_t> &s) {
+  return std::vector<std::uint32_t>(s.begin(), s.end());
+}
+
+// Values spread over a few chunks, each chunk with its own density, so
+// that arrays, bitmaps and runs all meet each other.
+std::set<std::uint32_t> randomValues(std::mt19937 &rng, int chunks) {
+  std::set<std::uint32_t> res;
+  for (int chunk = 0; chunk < chunks; chunk++) {
+    std::uint32_t high = std::uint32_t(rng() % 6) << 16;
+    switch (rng() % 4) {
+      case 0:
+        for (int i = 0; i < 300; i++) res.insert(high | (rng() & 0xFFFF));
+        break;
+      case 1:
+        for (int i = 0; i < 20000; i++) res.insert(high | (rng() & 0xFFFF));
+        break;
+      case 2: {
+        std::uint32_t start = rng() & 0x7FFF;
+        for (std::uint32_t v = start; v < start + 9000; v++) {
+          res.insert(high | v);
+        }
+        break;
+      }
+      default:
+        for (std::uint32_t v = 0; v < 0x10000; v += 1 + rng() % 3) {
+          res.insert(high | v);
+        }
+    }
+  }
+  return res;
+}
+
+s21::roaring_set roaringOf(const std::set<std::uint32_t> &values,
+                           bool optimize) {
+  s21::roaring_set res;
+  for (std::uint32_t value : values) res.insert(value);
+  if (optimize) res.run_optimize();
+  return res;
+}
+
+}  // namespace
+
+TEST(RoaringSetTest, InsertEraseContains) {
+  s21::roaring_set s{7, 0xFFFFFFFFu, 65536, 3, 65535, 7};
+  EXPECT_EQ(s.size(), 5);
+  EXPECT_EQ(valuesOf(s),
+            (std::vector<std::uint32_t>{3, 7, 65535, 65536, 0xFFFFFFFFu}));
+  EXPECT_TRUE(s.contains(65536));
+  EXPECT_FALSE(s.contains(65537));
+  EXPECT_EQ(s.count(0xFFFFFFFFu), 1);
+  EXPECT_FALSE(s.insert(3));
+  EXPECT_TRUE(s.insert(4));
+  EXPECT_EQ(s.erase(65536), 1);
+  EXPECT_EQ(s.erase(65536), 0);
+  EXPECT_EQ(s.erase(1u << 20), 0);
+  EXPECT_EQ(valuesOf(s),
+            (std::vector<std::uint32_t>{3, 4, 7, 65535, 0xFFFFFFFFu}));
+  s.clear();
+  EXPECT_TRUE(s.empty());
+  EXPECT_TRUE(s.begin() == s.end());
+}
+
+TEST(RoaringSetTest, ChunksSwitchBetweenArrayAndBitmap) {
+  s21::roaring_set s;
+  std::set<std::uint32_t> expected;
+  for (std::uint32_t v = 0; v < 3 * 5000; v += 3) {
+    s.insert(v);
+    expected.insert(v);
+  }
+  EXPECT_EQ(s.size(), expected.size());
+  EXPECT_EQ(valuesOf(s), valuesOf(expected));
+  EXPECT_LT(s.memory_usage(), 8192 + 512);
+  for (std::uint32_t v = 0; v < 3 * 5000; v += 6) {
+    s.erase(v);
+    expected.erase(v);
+  }
+  EXPECT_EQ(valuesOf(s), valuesOf(expected));
+  for (std::uint32_t v = 0; v < 3 * 5000; v++) {
+    if (s.contains(v) != (expected.count(v) == 1)) {
+      ADD_FAILURE() << v;
+      break;
+    }
+  }
+}
+
+TEST(RoaringSetTest, RunOptimizeCompressesRanges) {
+  s21::roaring_set s;
+  for (std::uint32_t v = 1000; v < 200000; v++) s.insert(v);
+  EXPECT_TRUE(s.run_optimize());
+  EXPECT_FALSE(s.run_optimize());
+  EXPECT_LT(s.memory_usage(), 512);
+  EXPECT_EQ(s.size(), 199000);
+  EXPECT_FALSE(s.contains(999));
+  EXPECT_TRUE(s.contains(1000));
+  EXPECT_TRUE(s.contains(199999));
+  EXPECT_FALSE(s.contains(200000));
+
+  std::set<std::uint32_t> expected;
+  for (std::uint32_t v = 1000; v < 200000; v++) expected.insert(v);
+  for (std::uint32_t v : {5000u, 5001u, 1000u, 199999u, 70000u}) {
+    EXPECT_EQ(s.erase(v), 1);
+    expected.erase(v);
+  }
+  for (std::uint32_t v : {5000u, 999u, 200000u, 300000u}) {
+    EXPECT_TRUE(s.insert(v));
+    expected.insert(v);
+  }
+  EXPECT_EQ(valuesOf(s), valuesOf(expected));
+
+  // Scattered holes make runs larger than a bitmap.
+  for (std::uint32_t v = 2000; v < 60000; v += 7) {
+    s.erase(v);
+    expected.erase(v);
+  }
+  EXPECT_EQ(s.size(), expected.size());
+  EXPECT_EQ(valuesOf(s), valuesOf(expected));
+  EXPECT_LT(s.memory_usage(), 4 * 8192);
+}
+
+TEST(RoaringSetTest, EqualityIgnoresLayout) {
+  std::mt19937 rng(3);
+  std::set<std::uint32_t> values = randomValues(rng, 6);
+  s21::roaring_set plain = roaringOf(values, false);
+  s21::roaring_set optimized = roaringOf(values, true);
+  EXPECT_TRUE(plain == optimized);
+  EXPECT_LE(optimized.memory_usage(), plain.memory_usage());
+  s21::roaring_set copy(optimized);
+  EXPECT_TRUE(copy == plain);
+  copy.erase(*values.begin());
+  EXPECT_TRUE(copy != plain);
+  s21::roaring_set moved(std::move(copy));
+  EXPECT_EQ(moved.size(), values.size() - 1);
+  copy = moved;
+  EXPECT_TRUE(copy == moved);
+}
+
+TEST(RoaringSetTest, SetAlgebraMatchesStd) {
+  std::mt19937 rng(11);
+  for (int round = 0; round < 12; round++) {
+    std::set<std::uint32_t> a = randomValues(rng, 4);
+    std::set<std::uint32_t> b = randomValues(rng, 4);
+    s21::roaring_set ra = roaringOf(a, round % 2 == 0);
+    s21::roaring_set rb = roaringOf(b, round % 3 == 0);
+
+    std::vector<std::uint32_t> expected;
+    std::set_union(a.begin(), a.end(), b.begin(), b.end(),
+                   std::back_inserter(expected));
+    s21::roaring_set res = ra | rb;
+    ASSERT_EQ(res.size(), expected.size());
+    ASSERT_EQ(valuesOf(res), expected);
+
+    expected.clear();
+    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(),
+                          std::back_inserter(expected));
+    res = ra & rb;
+    ASSERT_EQ(res.size(), expected.size());
+    ASSERT_EQ(valuesOf(res), expected);
+
+    expected.clear();
+    std::set_difference(a.begin(), a.end(), b.begin(), b.end(),
+                        std::back_inserter(expected));
+    res = ra - rb;
+    ASSERT_EQ(res.size(), expected.size());
+    ASSERT_EQ(valuesOf(res), expected);
+
+    res = ra;
+    res -= rb;
+    res |= rb;
+    ASSERT_TRUE(res == (ra | rb));
+    res &= ra;
+    ASSERT_TRUE(res == ra);
+  }
+}
+
+TEST(RoaringSetTest, SmallArraysIntersect) {
+  // Arrays of every length around the eight-value SIMD block.
+  for (std::uint32_t n = 0; n < 40; n++) {
+    for (std::uint32_t step = 1; step <= 3; step++) {
+      std::set<std::uint32_t> a;
+      std::set<std::uint32_t> b;
+      for (std::uint32_t i = 0; i < n; i++) a.insert(2 * i);
+      for (std::uint32_t i = 0; i < 30; i++) b.insert(step * i + n % 2);
+      std::vector<std::uint32_t> common;
+      std::set_intersection(a.begin(), a.end(), b.begin(), b.end(),
+                            std::back_inserter(common));
+      std::vector<std::uint32_t> rest;
+      std::set_difference(a.begin(), a.end(), b.begin(), b.end(),
+                          std::back_inserter(rest));
+      s21::roaring_set ra = roaringOf(a, false);
+      s21::roaring_set rb = roaringOf(b, false);
+      ASSERT_EQ(valuesOf(ra & rb), common);
+      ASSERT_EQ(valuesOf(ra - rb), rest);
+    }
+  }
+}
+
+TEST(RoaringSetTest, RandomOperations) {
+  std::mt19937 rng(5);
+  s21::roaring_set s;
+  std::set<std::uint32_t> expected;
+  for (int i = 0; i < 200000; i++) {
+    std::uint32_t value = (rng() % 3) << 16 | (rng() % 12000);
+    switch (rng() % 3) {
+      case 0:
+        ASSERT_EQ(s.insert(value), expected.insert(value).second);
+        break;
+      case 1:
+        ASSERT_EQ(s.erase(value), expected.erase(value));
+        break;
+      default:
+        ASSERT_EQ(s.contains(value), expected.count(value) == 1);
+    }
+    if (i % 50000 == 0) s.run_optimize();
+  }
+  EXPECT_EQ(s.size(), expected.size());
+  EXPECT_EQ(valuesOf(s), valuesOf(expected));
+}
@@ -302,3 +302,20 @@ TEST(set, insert_many) {
   EXPECT_EQ(*(res[4].first), 9);
   EXPECT_EQ(res[4].second, true);
 }
+
+TEST(set, decrement_end_after_insert) {
+  s21::set<int> s21_set;
+  auto iter = s21_set.end();
+  s21_set.insert(3);
+  s21_set.insert(7);
+  s21_set.insert(5);
+
+  --iter;
+  EXPECT_EQ(*iter, 7);
+  --iter;
+  EXPECT_EQ(*iter, 5);
+  --iter;
+  EXPECT_EQ(*iter, 3);
+  --iter;
+  EXPECT_TRUE(iter == s21_set.end());
+}
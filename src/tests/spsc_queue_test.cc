@@ -0,0 +1,96 @@
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "testing.h"
+
+TEST(SpscQueueTest, CapacityIsPowerOfTwo) {
+  s21::spsc_queue<int> q(5);
+  EXPECT_EQ(q.capacity(), 8);
+  EXPECT_TRUE(q.empty());
+  EXPECT_EQ(q.front(), nullptr);
+  EXPECT_FALSE(q.pop());
+}
+
+TEST(SpscQueueTest, PushPopOrder) {
+  s21::spsc_queue<int> q(4);
+  EXPECT_TRUE(q.push(1));
+  EXPECT_TRUE(q.push(2));
+  EXPECT_TRUE(q.emplace(3));
+  EXPECT_EQ(q.size(), 3);
+  EXPECT_EQ(*q.front(), 1);
+  EXPECT_TRUE(q.pop());
+  int out = 0;
+  EXPECT_TRUE(q.try_pop(out));
+  EXPECT_EQ(out, 2);
+  EXPECT_EQ(*q.front(), 3);
+}
+
+TEST(SpscQueueTest, FullQueueRejectsPush) {
+  s21::spsc_queue<std::string> q(2);
+  EXPECT_TRUE(q.push("a"));
+  EXPECT_TRUE(q.push("b"));
+  EXPECT_FALSE(q.push("c"));
+  EXPECT_TRUE(q.pop());
+  EXPECT_TRUE(q.push("c"));
+  std::string out;
+  EXPECT_TRUE(q.try_pop(out));
+  EXPECT_EQ(out, "b");
+  EXPECT_TRUE(q.try_pop(out));
+  EXPECT_EQ(out, "c");
+  EXPECT_FALSE(q.try_pop(out));
+}
+
+TEST(SpscQueueTest, BatchOperations) {
+  s21::spsc_queue<int> q(8);
+  std::vector<int> input{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  EXPECT_EQ(q.push_n(input.begin(), input.size()), 8);
+  int output[16] = {};
+  EXPECT_EQ(q.pop_n(output, 3), 3);
+  EXPECT_EQ(output[2], 3);
+  EXPECT_EQ(q.push_n(input.begin() + 8, 2), 2);
+  EXPECT_EQ(q.pop_n(output, 16), 7);
+  EXPECT_EQ(output[0], 4);
+  EXPECT_EQ(output[6], 10);
+  EXPECT_TRUE(q.empty());
+}
+
+TEST(SpscQueueTest, DestructorReleasesValues) {
+  s21::spsc_queue<std::string> q(4);
+  q.push(std::string(100, 'x'));
+  q.push(std::string(100, 'y'));
+  EXPECT_EQ(q.size(), 2);
+}
+
+TEST(SpscQueueTest, ProducerConsumer) {
+  const int kCount = 100000;
+  s21::spsc_queue<int> q(64);
+  std::thread producer([&q] {
+    for (int i = 0; i < kCount;) {
+      int pushed = 0;
+      if (i % 3 == 0) {
+        int batch[5] = {i, i + 1, i + 2, i + 3, i + 4};
+        int n = kCount - i < 5 ? kCount - i : 5;
+        pushed = int(q.push_n(batch, n));
+      } else {
+        pushed = q.push(i) ? 1 : 0;
+      }
+      if (pushed == 0) std::this_thread::yield();
+      i += pushed;
+    }
+  });
+  long long expected = 0;
+  bool ordered = true;
+  int batch[7];
+  while (expected < kCount) {
+    std::size_t n = q.pop_n(batch, 7);
+    if (n == 0) std::this_thread::yield();
+    for (std::size_t i = 0; i < n; i++) {
+      if (batch[i] != expected) ordered = false;
+      expected++;
+    }
+  }
+  producer.join();
+  EXPECT_TRUE(ordered);
+  EXPECT_TRUE(q.empty());
+}
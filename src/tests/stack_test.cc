@@ -1,4 +1,5 @@
 #include <stack>
+#include <string>
 
 #include "testing.h"
 
@@ -287,3 +288,85 @@ TEST(StackTest, InsertManyFront) {
   our_stack_int.insert_many_front(1, 2, 3);
   EXPECT_EQ(our_stack_int.top(), 3);
 }
+
+TEST(StackTest, Emplace) {
+  s21::stack<std::pair<int, int>> s21_stack;
+  auto &top = s21_stack.emplace(1, 2);
+  EXPECT_EQ(top.second, 2);
+  s21_stack.emplace(3, 4);
+  EXPECT_EQ(s21_stack.size(), 2);
+  EXPECT_EQ(s21_stack.top().first, 3);
+}
+
+TEST(StackTest, PopValue) {
+  s21::stack<std::string> s21_stack{"first", "second", "third"};
+  EXPECT_EQ(s21_stack.pop_value(), "third");
+  EXPECT_EQ(s21_stack.pop_value(), "second");
+  EXPECT_EQ(s21_stack.size(), 1);
+  EXPECT_EQ(s21_stack.top(), "first");
+}
+
+TEST(StackTest, Reserve) {
+  s21::stack<int> s21_stack;
+  s21_stack.reserve(100);
+  for (int i = 0; i < 1000; i++) s21_stack.push(i);
+  for (int i = 999; i >= 0; i--) {
+    EXPECT_EQ(s21_stack.top(), i);
+    s21_stack.pop();
+  }
+  EXPECT_TRUE(s21_stack.empty());
+}
+
+TEST(StackTest, ListContainer) {
+  s21::stack<int, s21::list<int>> s21_stack{1, 2, 3};
+  s21_stack.push(4);
+  EXPECT_EQ(s21_stack.pop_value(), 4);
+  s21_stack.insert_many_front(5, 6);
+  EXPECT_EQ(s21_stack.top(), 6);
+  EXPECT_EQ(s21_stack.size(), 5);
+}
+
+TEST(StackTest, Operator_move_leaves_source_empty) {
+  s21::stack<int> s21_stack{1, 2, 3};
+  s21::stack<int> s21_stack_move{4, 5};
+  s21_stack = std::move(s21_stack_move);
+  EXPECT_EQ(s21_stack.size(), 2);
+  EXPECT_EQ(s21_stack.top(), 5);
+  EXPECT_TRUE(s21_stack_move.empty());
+  EXPECT_TRUE(std::is_nothrow_move_constructible_v<s21::stack<int>>);
+  EXPECT_TRUE(std::is_nothrow_move_assignable_v<s21::stack<int>>);
+}
+
+TEST(StackTest, Operator_copy) {
+  s21::stack<std::string> s21_stack{"a"};
+  s21::stack<std::string> s21_stack_copy{"b", "c"};
+  s21_stack = s21_stack_copy;
+  EXPECT_EQ(s21_stack.size(), 2);
+  EXPECT_EQ(s21_stack.top(), "c");
+  s21_stack.pop();
+  EXPECT_EQ(s21_stack_copy.size(), 2);
+  EXPECT_EQ(s21_stack_copy.top(), "c");
+  EXPECT_EQ(s21_stack.top(), "b");
+}
+
+TEST(StackTest, Operator_move_list_container) {
+  s21::stack<int, s21::list<int>> s21_stack{1, 2, 3};
+  s21::stack<int, s21::list<int>> s21_stack_move{4};
+  s21_stack = std::move(s21_stack_move);
+  EXPECT_EQ(s21_stack.size(), 1);
+  EXPECT_TRUE(s21_stack_move.empty());
+  s21_stack_move = s21_stack;
+  EXPECT_EQ(s21_stack_move.top(), 4);
+}
+
+TEST(StackTest, MoveEmptyListContainer) {
+  s21::stack<int, s21::list<int>> empty_stack;
+  s21::stack<int, s21::list<int>> s21_stack(std::move(empty_stack));
+  s21_stack.push(1);
+  s21_stack.push(2);
+  empty_stack.push(3);
+  EXPECT_EQ(s21_stack.size(), 2);
+  EXPECT_EQ(s21_stack.top(), 2);
+  EXPECT_EQ(empty_stack.size(), 1);
+  EXPECT_EQ(empty_stack.top(), 3);
+}
@@ -0,0 +1,52 @@
+#include <atomic>
+
+#include "testing.h"
+
+namespace {
+
+long fib(s21::thread_pool &pool, int n) {
+  if (n < 15) return n < 2 ? n : fib(pool, n - 1) + fib(pool, n - 2);
+  long left = 0;
+  s21::task_group group(pool);
+  group.run([&] { left = fib(pool, n - 1); });
+  long right = fib(pool, n - 2);
+  group.wait();
+  return left + right;
+}
+
+}  // namespace
+
+TEST(ThreadPoolTest, RunsEverySubmittedTask) {
+  std::atomic<int> counter(0);
+  s21::thread_pool pool(3);
+  EXPECT_EQ(pool.size(), 3);
+  for (int i = 0; i < 5000; i++) pool.submit([&counter] { counter++; });
+  pool.wait_idle();
+  EXPECT_EQ(counter.load(), 5000);
+}
+
+TEST(ThreadPoolTest, TasksSubmitTasks) {
+  std::atomic<int> counter(0);
+  s21::thread_pool pool(2);
+  for (int i = 0; i < 10; i++) {
+    pool.submit([&pool, &counter] {
+      for (int j = 0; j < 100; j++) pool.submit([&counter] { counter++; });
+    });
+  }
+  pool.wait_idle();
+  EXPECT_EQ(counter.load(), 1000);
+}
+
+TEST(ThreadPoolTest, DestructorFinishesQueuedTasks) {
+  std::atomic<int> counter(0);
+  {
+    s21::thread_pool pool(2);
+    for (int i = 0; i < 100; i++) pool.submit([&counter] { counter++; });
+  }
+  EXPECT_EQ(counter.load(), 100);
+}
+
+TEST(ThreadPoolTest, RecursiveTaskGroups) {
+  s21::thread_pool pool(4);
+  EXPECT_EQ(fib(pool, 25), 75025);
+}
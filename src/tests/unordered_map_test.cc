@@ -0,0 +1,260 @@
+#include <cstring>
+#include <map>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+#include "testing.h"
+
+namespace {
+
+// Sends every key to one of four home slots, so probe runs are long and
+// erase has to shift values across group and table boundaries.
+struct CollidingHash {
+  std::size_t operator()(int key) const { return std::size_t(key & 3); }
+};
+
+template <typename Map>
+std::map<int, int> contents(const Map &m) {
+  std::map<int, int> res;
+  for (const auto &value : m) res.insert(value);
+  return res;
+}
+
+}  // namespace
+
+TEST(UnorderedMapTest, DefaultConstructor) {
+  s21::unordered_map<int, int> m;
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(m.size(), 0);
+  EXPECT_TRUE(m.begin() == m.end());
+  EXPECT_FALSE(m.contains(1));
+  EXPECT_TRUE(m.find(1) == m.end());
+  EXPECT_EQ(m.erase(1), 0);
+}
+
+TEST(UnorderedMapTest, InitializerList) {
+  s21::unordered_map<int, std::string> m{{1, "one"}, {2, "two"}, {1, "uno"}};
+  EXPECT_EQ(m.size(), 2);
+  EXPECT_EQ(m.at(1), "one");
+  EXPECT_EQ(m.at(2), "two");
+}
+
+TEST(UnorderedMapTest, AtThrows) {
+  s21::unordered_map<int, int> m{{1, 10}};
+  EXPECT_THROW(m.at(2), std::out_of_range);
+  const auto &c = m;
+  EXPECT_EQ(c.at(1), 10);
+}
+
+TEST(UnorderedMapTest, SubscriptInserts) {
+  s21::unordered_map<std::string, int> m;
+  m["a"] = 1;
+  m["b"]++;
+  m["a"] += 5;
+  EXPECT_EQ(m.size(), 2);
+  EXPECT_EQ(m["a"], 6);
+  EXPECT_EQ(m["b"], 1);
+  EXPECT_EQ(m["c"], 0);
+  EXPECT_EQ(m.size(), 3);
+}
+
+TEST(UnorderedMapTest, InsertAndAssign) {
+  s21::unordered_map<int, int> m;
+  auto res = m.insert({1, 10});
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(res.first->second, 10);
+  res = m.insert(1, 20);
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(res.first->second, 10);
+  res = m.insert_or_assign(1, 30);
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(m.at(1), 30);
+  res = m.insert_or_assign(2, 40);
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ((*res.first).first, 2);
+  EXPECT_EQ(m.size(), 2);
+}
+
+TEST(UnorderedMapTest, EraseIterator) {
+  s21::unordered_map<int, int> m{{1, 1}, {2, 2}, {3, 3}};
+  m.erase(m.find(2));
+  m.erase(m.end());
+  EXPECT_EQ(m.size(), 2);
+  EXPECT_FALSE(m.contains(2));
+  EXPECT_TRUE(m.contains(1));
+  EXPECT_TRUE(m.contains(3));
+}
+
+TEST(UnorderedMapTest, GrowsAndFindsEverything) {
+  s21::unordered_map<int, int> m;
+  for (int i = 0; i < 10000; i++) m[i * 7] = i;
+  EXPECT_EQ(m.size(), 10000);
+  EXPECT_LE(m.load_factor(), m.max_load_factor());
+  for (int i = 0; i < 10000; i++) {
+    ASSERT_TRUE(m.contains(i * 7));
+    ASSERT_EQ(m.at(i * 7), i);
+    ASSERT_FALSE(m.contains(i * 7 + 1));
+  }
+  std::size_t visited = 0;
+  for (auto it = m.begin(); it != m.end(); ++it) visited++;
+  EXPECT_EQ(visited, 10000);
+}
+
+TEST(UnorderedMapTest, RandomOperationsMatchStd) {
+  std::mt19937 rng(7);
+  s21::unordered_map<int, int> m;
+  std::unordered_map<int, int> expected;
+  for (int i = 0; i < 50000; i++) {
+    int key = int(rng() % 2000);
+    switch (rng() % 3) {
+      case 0:
+        EXPECT_EQ(m.insert(key, i).second, expected.emplace(key, i).second);
+        break;
+      case 1:
+        m.insert_or_assign(key, i);
+        expected[key] = i;
+        break;
+      default:
+        EXPECT_EQ(m.erase(key), expected.erase(key));
+    }
+  }
+  EXPECT_EQ(m.size(), expected.size());
+  EXPECT_EQ(contents(m), contents(expected));
+}
+
+TEST(UnorderedMapTest, EraseShiftsCollidingRuns) {
+  s21::unordered_map<int, int, CollidingHash> m;
+  std::map<int, int> expected;
+  std::mt19937 rng(11);
+  for (int i = 0; i < 20000; i++) {
+    int key = int(rng() % 300);
+    if (rng() % 2) {
+      m[key] = i;
+      expected[key] = i;
+    } else {
+      EXPECT_EQ(m.erase(key), expected.erase(key));
+    }
+    if (i % 1000 == 0) {
+      for (int k = 0; k < 300; k++) {
+        ASSERT_EQ(m.contains(k), expected.count(k) == 1);
+      }
+    }
+  }
+  EXPECT_EQ(contents(m), expected);
+  while (!m.empty()) m.erase(m.begin());
+  EXPECT_TRUE(m.begin() == m.end());
+}
+
+TEST(UnorderedMapTest, MaxLoadFactor) {
+  s21::unordered_map<int, int> m;
+  EXPECT_FLOAT_EQ(m.max_load_factor(), 0.875f);
+  for (int i = 0; i < 100; i++) m[i] = i;
+  m.max_load_factor(0.25f);
+  EXPECT_LE(m.load_factor(), 0.25f);
+  EXPECT_GE(m.bucket_count(), 400);
+  m.max_load_factor(2.0f);
+  EXPECT_FLOAT_EQ(m.max_load_factor(), 0.9375f);
+  for (int i = 0; i < 100; i++) EXPECT_EQ(m.at(i), i);
+}
+
+TEST(UnorderedMapTest, ReserveAndRehash) {
+  s21::unordered_map<int, int> m;
+  m.reserve(1000);
+  std::size_t buckets = m.bucket_count();
+  EXPECT_GE(float(buckets) * m.max_load_factor(), 1000.0f);
+  for (int i = 0; i < 1000; i++) m[i] = i;
+  EXPECT_EQ(m.bucket_count(), buckets);
+  for (int i = 100; i < 1000; i++) m.erase(i);
+  m.rehash(0);
+  EXPECT_LT(m.bucket_count(), buckets);
+  for (int i = 0; i < 100; i++) EXPECT_EQ(m.at(i), i);
+  m.clear();
+  m.rehash(0);
+  EXPECT_EQ(m.bucket_count(), 0);
+  m[5] = 5;
+  EXPECT_EQ(m.at(5), 5);
+}
+
+TEST(UnorderedMapTest, CopyAndMove) {
+  s21::unordered_map<std::string, int> m{{"a", 1}, {"b", 2}};
+  s21::unordered_map<std::string, int> copy(m);
+  copy["c"] = 3;
+  EXPECT_EQ(m.size(), 2);
+  EXPECT_EQ(copy.size(), 3);
+  s21::unordered_map<std::string, int> moved(std::move(copy));
+  EXPECT_EQ(moved.at("c"), 3);
+  m = moved;
+  EXPECT_EQ(m.at("c"), 3);
+  s21::unordered_map<std::string, int> other;
+  other = std::move(m);
+  EXPECT_EQ(other.size(), 3);
+  other.swap(moved);
+  EXPECT_EQ(other.size(), 3);
+}
+
+TEST(UnorderedMapTest, Merge) {
+  s21::unordered_map<int, int> a{{1, 1}, {2, 2}};
+  s21::unordered_map<int, int> b{{2, 20}, {3, 30}};
+  a.merge(b);
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(a.size(), 3);
+  EXPECT_EQ(a.at(2), 2);
+  EXPECT_EQ(a.at(3), 30);
+}
+
+TEST(UnorderedMapTest, InsertMany) {
+  s21::unordered_map<int, char> m{{1, 'a'}};
+  auto res = m.insert_many(std::pair<const int, char>{1, 'x'},
+                           std::pair<const int, char>{2, 'b'},
+                           std::pair<const int, char>{3, 'c'});
+  ASSERT_EQ(res.size(), 3);
+  EXPECT_FALSE(res[0].second);
+  EXPECT_EQ(res[0].first->second, 'a');
+  EXPECT_TRUE(res[1].second);
+  EXPECT_EQ(res[1].first->second, 'b');
+  EXPECT_EQ(res[2].first->first, 3);
+  EXPECT_EQ(m.size(), 3);
+}
+
+TEST(UnorderedMapTest, InsertCopyOfElementWhileGrowing) {
+  s21::unordered_map<int, std::string> m{{0, std::string(100, 'a')}};
+  auto fillToThreshold = [&m] {
+    for (int i = int(m.size()); float(m.size() + 1) <=
+                                float(m.bucket_count()) * m.max_load_factor();
+         i++) {
+      m.insert(i, std::string(100, char('a' + i % 26)));
+    }
+  };
+  fillToThreshold();
+  std::size_t buckets = m.bucket_count();
+  EXPECT_TRUE(m.insert(100, m.at(0)).second);
+  EXPECT_GT(m.bucket_count(), buckets);
+  EXPECT_EQ(m.at(100), std::string(100, 'a'));
+
+  fillToThreshold();
+  buckets = m.bucket_count();
+  EXPECT_TRUE(m.insert_or_assign(101, m.at(1)).second);
+  EXPECT_GT(m.bucket_count(), buckets);
+  EXPECT_EQ(m.at(101), std::string(100, 'b'));
+}
+
+TEST(UnorderedMapTest, GroupImplementationsAgree) {
+  std::mt19937 rng(3);
+  s21::hash_ctrl_t ctrl[s21::kHashGroupWidth];
+  for (int round = 0; round < 1000; round++) {
+    for (auto &c : ctrl) {
+      c = rng() % 4 ? s21::hash_ctrl_t(rng() % 8) : s21::kEmptyCtrl;
+    }
+    s21::portable_group portable(ctrl);
+    s21::hash_group group(ctrl);
+    ASSERT_EQ(portable.match_empty(), group.match_empty());
+    for (int h2 = 0; h2 < 8; h2++) {
+      ASSERT_EQ(portable.match(s21::hash_ctrl_t(h2)),
+                group.match(s21::hash_ctrl_t(h2)));
+    }
+  }
+  std::memset(ctrl, 0x7F, sizeof(ctrl));
+  EXPECT_EQ(s21::hash_group(ctrl).match(0x7F), 0xFFFFu);
+  EXPECT_EQ(s21::hash_group(ctrl).match_empty(), 0u);
+}
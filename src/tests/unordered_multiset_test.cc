@@ -0,0 +1,113 @@
+#include <algorithm>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "testing.h"
+
+namespace {
+
+std::vector<int> sorted(const s21::unordered_multiset<int> &s) {
+  std::vector<int> res(s.begin(), s.end());
+  std::sort(res.begin(), res.end());
+  return res;
+}
+
+}  // namespace
+
+TEST(UnorderedMultisetTest, DefaultConstructor) {
+  s21::unordered_multiset<int> s;
+  EXPECT_TRUE(s.empty());
+  EXPECT_EQ(s.count(1), 0);
+  EXPECT_TRUE(s.begin() == s.end());
+}
+
+TEST(UnorderedMultisetTest, KeepsDuplicates) {
+  s21::unordered_multiset<int> s{2, 1, 2, 2, 3};
+  EXPECT_EQ(s.size(), 5);
+  EXPECT_EQ(s.count(2), 3);
+  EXPECT_EQ(s.count(4), 0);
+  EXPECT_EQ(sorted(s), (std::vector<int>{1, 2, 2, 2, 3}));
+  EXPECT_EQ(*s.insert(1), 1);
+  EXPECT_EQ(s.count(1), 2);
+  for (int i = 0; i < 100; i++) s.insert(*s.begin());
+  EXPECT_EQ(s.size(), 106);
+}
+
+TEST(UnorderedMultisetTest, EraseOneOrAll) {
+  s21::unordered_multiset<std::string> s{"a", "b", "a", "a"};
+  s.erase(s.find("a"));
+  EXPECT_EQ(s.count("a"), 2);
+  EXPECT_EQ(s.erase("a"), 2);
+  EXPECT_FALSE(s.contains("a"));
+  EXPECT_EQ(s.size(), 1);
+}
+
+TEST(UnorderedMultisetTest, RandomOperationsMatchStd) {
+  std::mt19937 rng(9);
+  s21::unordered_multiset<int> s;
+  std::multiset<int> expected;
+  for (int i = 0; i < 30000; i++) {
+    int key = int(rng() % 500);
+    switch (rng() % 4) {
+      case 0:
+        EXPECT_EQ(s.erase(key), expected.erase(key));
+        break;
+      case 1:
+        if (s.contains(key)) {
+          s.erase(s.find(key));
+          expected.erase(expected.find(key));
+        }
+        break;
+      default:
+        s.insert(key);
+        expected.insert(key);
+    }
+  }
+  for (int key = 0; key < 500; key++) {
+    ASSERT_EQ(s.count(key), expected.count(key));
+  }
+  EXPECT_EQ(sorted(s), std::vector<int>(expected.begin(), expected.end()));
+}
+
+TEST(UnorderedMultisetTest, RangeInsertAndReserve) {
+  std::vector<int> keys;
+  for (int i = 0; i < 4000; i++) keys.push_back(i % 1000);
+  s21::unordered_multiset<int> s;
+  s.insert(keys.begin(), keys.end());
+  std::size_t buckets = s.bucket_count();
+  EXPECT_GE(float(buckets) * s.max_load_factor(), 4000.0f);
+  EXPECT_EQ(s.count(999), 4);
+  s21::unordered_multiset<int> t(keys.begin(), keys.end());
+  EXPECT_EQ(t.size(), 4000);
+  t.reserve(10000);
+  EXPECT_GE(float(t.bucket_count()) * t.max_load_factor(), 10000.0f);
+  t.clear();
+  t.rehash(0);
+  EXPECT_EQ(t.bucket_count(), 0);
+}
+
+TEST(UnorderedMultisetTest, CopyMoveMerge) {
+  s21::unordered_multiset<int> a{1, 1};
+  s21::unordered_multiset<int> b(a);
+  b.insert(1);
+  EXPECT_EQ(a.count(1), 2);
+  a.merge(b);
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(a.count(1), 5);
+  s21::unordered_multiset<int> c(std::move(a));
+  EXPECT_EQ(c.size(), 5);
+  b = c;
+  b.swap(a);
+  EXPECT_EQ(a.size(), 5);
+}
+
+TEST(UnorderedMultisetTest, InsertMany) {
+  s21::unordered_multiset<int> s;
+  auto res = s.insert_many(7, 7, 8);
+  ASSERT_EQ(res.size(), 3);
+  EXPECT_TRUE(res[0].second);
+  EXPECT_EQ(*res[1].first, 7);
+  EXPECT_EQ(s.count(7), 2);
+}
@@ -0,0 +1,131 @@
+#include <algorithm>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "testing.h"
+
+namespace {
+
+std::vector<int> sorted(const s21::unordered_set<int> &s) {
+  std::vector<int> res(s.begin(), s.end());
+  std::sort(res.begin(), res.end());
+  return res;
+}
+
+// Counts how often the table is rebuilt by watching bucket_count.
+struct GrowthCounter {
+  std::size_t last = 0;
+  int growths = 0;
+  void observe(std::size_t buckets) {
+    if (buckets != last) growths++;
+    last = buckets;
+  }
+};
+
+}  // namespace
+
+TEST(UnorderedSetTest, DefaultConstructor) {
+  s21::unordered_set<int> s;
+  EXPECT_TRUE(s.empty());
+  EXPECT_EQ(s.size(), 0);
+  EXPECT_TRUE(s.begin() == s.end());
+  EXPECT_FALSE(s.contains(0));
+}
+
+TEST(UnorderedSetTest, InitializerListDropsDuplicates) {
+  s21::unordered_set<int> s{3, 1, 2, 3, 1};
+  EXPECT_EQ(s.size(), 3);
+  EXPECT_EQ(sorted(s), (std::vector<int>{1, 2, 3}));
+}
+
+TEST(UnorderedSetTest, InsertFindErase) {
+  s21::unordered_set<std::string> s;
+  auto res = s.insert("apple");
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(*res.first, "apple");
+  std::string pear = "pear";
+  EXPECT_TRUE(s.insert(std::move(pear)).second);
+  EXPECT_FALSE(s.insert("apple").second);
+  EXPECT_EQ(s.size(), 2);
+  EXPECT_EQ(*s.find("pear"), "pear");
+  EXPECT_TRUE(s.find("plum") == s.end());
+  EXPECT_EQ(s.count("apple"), 1);
+  s.erase(s.find("apple"));
+  EXPECT_FALSE(s.contains("apple"));
+  EXPECT_EQ(s.erase("pear"), 1);
+  EXPECT_EQ(s.erase("pear"), 0);
+  EXPECT_TRUE(s.empty());
+}
+
+TEST(UnorderedSetTest, RandomOperationsMatchStd) {
+  std::mt19937 rng(5);
+  s21::unordered_set<int> s;
+  std::set<int> expected;
+  for (int i = 0; i < 40000; i++) {
+    int key = int(rng() % 3000);
+    if (rng() % 3) {
+      EXPECT_EQ(s.insert(key).second, expected.insert(key).second);
+    } else {
+      EXPECT_EQ(s.erase(key), expected.erase(key));
+    }
+  }
+  EXPECT_EQ(sorted(s), std::vector<int>(expected.begin(), expected.end()));
+}
+
+TEST(UnorderedSetTest, RangeInsertGrowsOnce) {
+  std::vector<int> keys(5000);
+  for (int i = 0; i < 5000; i++) keys[i] = i;
+  s21::unordered_set<int> s{-1};
+  GrowthCounter counter;
+  counter.observe(s.bucket_count());
+  s.insert(keys.begin(), keys.end());
+  counter.observe(s.bucket_count());
+  EXPECT_EQ(counter.growths, 2);
+  EXPECT_EQ(s.size(), 5001);
+  s21::unordered_set<int> copy(keys.begin(), keys.end());
+  EXPECT_EQ(copy.size(), 5000);
+  EXPECT_TRUE(copy.contains(4999));
+}
+
+TEST(UnorderedSetTest, ReserveAndRehash) {
+  s21::unordered_set<int> s;
+  s.reserve(300);
+  std::size_t buckets = s.bucket_count();
+  for (int i = 0; i < 300; i++) s.insert(i);
+  EXPECT_EQ(s.bucket_count(), buckets);
+  s.rehash(4 * buckets);
+  EXPECT_GE(s.bucket_count(), 4 * buckets);
+  for (int i = 0; i < 300; i++) EXPECT_TRUE(s.contains(i));
+  s.max_load_factor(0.5f);
+  EXPECT_LE(s.load_factor(), 0.5f);
+}
+
+TEST(UnorderedSetTest, CopyMoveSwapMerge) {
+  s21::unordered_set<int> a{1, 2, 3};
+  s21::unordered_set<int> b(a);
+  b.insert(4);
+  EXPECT_EQ(a.size(), 3);
+  s21::unordered_set<int> c(std::move(b));
+  EXPECT_EQ(c.size(), 4);
+  a.swap(c);
+  EXPECT_EQ(a.size(), 4);
+  EXPECT_EQ(c.size(), 3);
+  s21::unordered_set<int> d{3, 5};
+  a.merge(d);
+  EXPECT_TRUE(d.empty());
+  EXPECT_EQ(sorted(a), (std::vector<int>{1, 2, 3, 4, 5}));
+  d = a;
+  EXPECT_EQ(d.size(), 5);
+}
+
+TEST(UnorderedSetTest, InsertMany) {
+  s21::unordered_set<int> s{1};
+  auto res = s.insert_many(1, 2, 3);
+  ASSERT_EQ(res.size(), 3);
+  EXPECT_FALSE(res[0].second);
+  EXPECT_TRUE(res[1].second);
+  EXPECT_EQ(*res[2].first, 3);
+  EXPECT_EQ(s.size(), 3);
+}
@@ -0,0 +1,256 @@
+#include <list>
+#include <string>
+
+#include "testing.h"
+
+template <typename value_type, std::size_t N>
+bool compare_lists(s21::unrolled_list<value_type, N> my_list,
+                   std::list<value_type> std_list) {
+  bool result = true;
+  if (my_list.size() == std_list.size()) {
+    auto my_it = my_list.begin();
+    auto std_it = std_list.begin();
+    for (size_t i = 0; i != my_list.size(); ++i) {
+      if (*my_it != *std_it) {
+        result = false;
+        break;
+      }
+      ++my_it;
+      ++std_it;
+    }
+    if (my_it != my_list.end()) result = false;
+  } else {
+    result = false;
+  }
+  return result;
+}
+
+TEST(UnrolledListTest, DefaultConstructor) {
+  s21::unrolled_list<int> my_list;
+  EXPECT_EQ(my_list.size(), 0);
+  EXPECT_TRUE(my_list.empty());
+  EXPECT_TRUE(my_list.begin() == my_list.end());
+}
+
+TEST(UnrolledListTest, SizeConstructor) {
+  s21::unrolled_list<int, 4> my_list(1000);
+  std::list<int> std_list(1000);
+  EXPECT_TRUE(compare_lists(my_list, std_list));
+}
+
+TEST(UnrolledListTest, InitializerListConstructor) {
+  s21::unrolled_list<int, 4> my_list{1, 2, 3, 7, 9, 11, 13, 15, 17};
+  std::list<int> std_list{1, 2, 3, 7, 9, 11, 13, 15, 17};
+  EXPECT_TRUE(compare_lists(my_list, std_list));
+  EXPECT_EQ(my_list.front(), 1);
+  EXPECT_EQ(my_list.back(), 17);
+}
+
+TEST(UnrolledListTest, CopyConstructor) {
+  s21::unrolled_list<std::string, 2> my_list{"a", "b", "c", "d", "e"};
+  s21::unrolled_list<std::string, 2> my_copy(my_list);
+  std::list<std::string> std_list{"a", "b", "c", "d", "e"};
+  EXPECT_TRUE(compare_lists(my_list, std_list));
+  EXPECT_TRUE(compare_lists(my_copy, std_list));
+}
+
+TEST(UnrolledListTest, MoveConstructor) {
+  s21::unrolled_list<int, 4> my_list{1, 2, 3, 4, 5, 6};
+  s21::unrolled_list<int, 4> my_moved(std::move(my_list));
+  std::list<int> std_list{1, 2, 3, 4, 5, 6};
+  EXPECT_TRUE(compare_lists(my_moved, std_list));
+  EXPECT_TRUE(my_list.empty());
+  EXPECT_TRUE(my_list.begin() == my_list.end());
+}
+
+TEST(UnrolledListTest, Assignment) {
+  s21::unrolled_list<int, 4> my_list{1, 2, 3, 4, 5, 6};
+  s21::unrolled_list<int, 4> my_copy{9, 8};
+  s21::unrolled_list<int, 4> my_moved{7};
+  std::list<int> std_list{1, 2, 3, 4, 5, 6};
+  my_copy = my_list;
+  EXPECT_TRUE(compare_lists(my_copy, std_list));
+  my_moved = std::move(my_list);
+  EXPECT_TRUE(compare_lists(my_moved, std_list));
+  EXPECT_TRUE(my_list.empty());
+}
+
+TEST(UnrolledListTest, PushPop) {
+  s21::unrolled_list<int, 4> my_list;
+  std::list<int> std_list;
+  for (int i = 0; i < 50; i++) {
+    my_list.push_back(i);
+    std_list.push_back(i);
+    my_list.push_front(-i);
+    std_list.push_front(-i);
+  }
+  EXPECT_TRUE(compare_lists(my_list, std_list));
+  for (int i = 0; i < 30; i++) {
+    my_list.pop_back();
+    std_list.pop_back();
+    my_list.pop_front();
+    std_list.pop_front();
+  }
+  EXPECT_TRUE(compare_lists(my_list, std_list));
+  my_list.clear();
+  my_list.pop_back();
+  my_list.pop_front();
+  EXPECT_TRUE(my_list.empty());
+}
+
+TEST(UnrolledListTest, IteratorBackward) {
+  s21::unrolled_list<int, 3> my_list{1, 2, 3, 4, 5, 6, 7};
+  auto it = my_list.end();
+  for (int i = 7; i > 0; i--) {
+    --it;
+    EXPECT_EQ(*it, i);
+  }
+  EXPECT_TRUE(it == my_list.begin());
+}
+
+TEST(UnrolledListTest, Insert) {
+  s21::unrolled_list<int, 4> my_list{1, 2, 3, 4};
+  std::list<int> std_list{1, 2, 3, 4};
+  auto my_it = my_list.insert(++my_list.begin(), 10);
+  auto std_it = std_list.insert(++std_list.begin(), 10);
+  EXPECT_EQ(*my_it, *std_it);
+  my_it = my_list.insert(my_list.end(), 20);
+  std_list.insert(std_list.end(), 20);
+  EXPECT_EQ(*my_it, 20);
+  my_list.insert(my_list.begin(), 30);
+  std_list.insert(std_list.begin(), 30);
+  EXPECT_TRUE(compare_lists(my_list, std_list));
+}
+
+TEST(UnrolledListTest, InsertMiddleRepeatedly) {
+  s21::unrolled_list<int, 4> my_list{0, 1, 2, 3, 4, 5, 6, 7};
+  std::list<int> std_list{0, 1, 2, 3, 4, 5, 6, 7};
+  auto my_it = my_list.begin();
+  auto std_it = std_list.begin();
+  for (int i = 0; i < 4; i++) {
+    ++my_it;
+    ++std_it;
+  }
+  for (int i = 100; i < 140; i++) {
+    my_it = my_list.insert(my_it, i);
+    std_it = std_list.insert(std_it, i);
+  }
+  EXPECT_TRUE(compare_lists(my_list, std_list));
+}
+
+TEST(UnrolledListTest, Erase) {
+  s21::unrolled_list<int, 4> my_list;
+  std::list<int> std_list;
+  for (int i = 0; i < 40; i++) {
+    my_list.push_back(i);
+    std_list.push_back(i);
+  }
+  for (int i = 0; i < 30; i++) {
+    auto my_it = my_list.begin();
+    auto std_it = std_list.begin();
+    for (int j = 0; j < i % 7 && std_it != --std_list.end(); j++) {
+      ++my_it;
+      ++std_it;
+    }
+    my_list.erase(my_it);
+    std_list.erase(std_it);
+    EXPECT_TRUE(compare_lists(my_list, std_list));
+  }
+  my_list.erase(my_list.end());
+  EXPECT_TRUE(compare_lists(my_list, std_list));
+}
+
+TEST(UnrolledListTest, Swap) {
+  s21::unrolled_list<int, 4> my_list1{1, 2, 3, 4, 5};
+  s21::unrolled_list<int, 4> my_list2;
+  my_list1.swap(my_list2);
+  EXPECT_TRUE(my_list1.empty());
+  EXPECT_TRUE(compare_lists(my_list2, std::list<int>{1, 2, 3, 4, 5}));
+  my_list1.push_back(7);
+  my_list1.swap(my_list2);
+  EXPECT_TRUE(compare_lists(my_list1, std::list<int>{1, 2, 3, 4, 5}));
+  EXPECT_TRUE(compare_lists(my_list2, std::list<int>{7}));
+}
+
+TEST(UnrolledListTest, Merge) {
+  s21::unrolled_list<int, 4> my_list1{1, 3, 5, 7, 9, 11};
+  s21::unrolled_list<int, 4> my_list2{2, 3, 4, 10, 12, 14, 16};
+  std::list<int> std_list1{1, 3, 5, 7, 9, 11};
+  std::list<int> std_list2{2, 3, 4, 10, 12, 14, 16};
+  my_list1.merge(my_list2);
+  std_list1.merge(std_list2);
+  EXPECT_TRUE(compare_lists(my_list1, std_list1));
+  EXPECT_TRUE(my_list2.empty());
+}
+
+TEST(UnrolledListTest, SpliceBoundary) {
+  s21::unrolled_list<int, 4> my_list1{1, 2, 3, 4, 5};
+  s21::unrolled_list<int, 4> my_list2{10, 20, 30};
+  std::list<int> std_list1{1, 2, 3, 4, 5};
+  std::list<int> std_list2{10, 20, 30};
+  my_list1.splice(my_list1.begin(), my_list2);
+  std_list1.splice(std_list1.begin(), std_list2);
+  EXPECT_TRUE(compare_lists(my_list1, std_list1));
+  EXPECT_TRUE(my_list2.empty());
+}
+
+TEST(UnrolledListTest, SpliceMiddle) {
+  s21::unrolled_list<int, 4> my_list1{1, 2, 3, 4, 5};
+  s21::unrolled_list<int, 4> my_list2{10, 20, 30, 40, 50};
+  std::list<int> std_list1{1, 2, 3, 4, 5};
+  std::list<int> std_list2{10, 20, 30, 40, 50};
+  my_list1.splice(++(++my_list1.begin()), my_list2);
+  std_list1.splice(++(++std_list1.begin()), std_list2);
+  EXPECT_TRUE(compare_lists(my_list1, std_list1));
+  my_list2.splice(my_list2.end(), my_list1);
+  EXPECT_TRUE(compare_lists(my_list2, std_list1));
+}
+
+TEST(UnrolledListTest, Reverse) {
+  s21::unrolled_list<int, 3> my_list{1, 2, 3, 4, 5, 6, 7, 8};
+  std::list<int> std_list{1, 2, 3, 4, 5, 6, 7, 8};
+  my_list.reverse();
+  std_list.reverse();
+  EXPECT_TRUE(compare_lists(my_list, std_list));
+  s21::unrolled_list<int, 3> my_empty;
+  my_empty.reverse();
+  EXPECT_TRUE(my_empty.empty());
+}
+
+TEST(UnrolledListTest, Unique) {
+  s21::unrolled_list<int, 4> my_list{1, 1, 1, 2, 2, 3, 4, 4, 4, 4, 4, 5, 1, 1};
+  std::list<int> std_list{1, 1, 1, 2, 2, 3, 4, 4, 4, 4, 4, 5, 1, 1};
+  my_list.unique();
+  std_list.unique();
+  EXPECT_TRUE(compare_lists(my_list, std_list));
+  my_list.push_back(9);
+  std_list.push_back(9);
+  EXPECT_TRUE(compare_lists(my_list, std_list));
+}
+
+TEST(UnrolledListTest, Sort) {
+  s21::unrolled_list<int, 4> my_list{9, -1, 7, 3, 3, 12, 0, 5, -8, 2, 1};
+  std::list<int> std_list{9, -1, 7, 3, 3, 12, 0, 5, -8, 2, 1};
+  my_list.sort();
+  std_list.sort();
+  EXPECT_TRUE(compare_lists(my_list, std_list));
+}
+
+TEST(UnrolledListTest, SortStrings) {
+  s21::unrolled_list<std::string, 2> my_list{"pear", "apple", "fig", "kiwi"};
+  std::list<std::string> std_list{"pear", "apple", "fig", "kiwi"};
+  my_list.sort();
+  std_list.sort();
+  EXPECT_TRUE(compare_lists(my_list, std_list));
+}
+
+TEST(UnrolledListTest, InsertMany) {
+  s21::unrolled_list<int, 4> my_list{1, 2, 3, 4, 5};
+  auto it = my_list.insert_many(++my_list.begin(), 7, 8, 9);
+  EXPECT_EQ(*it, 2);
+  EXPECT_TRUE(compare_lists(my_list, std::list<int>{1, 7, 8, 9, 2, 3, 4, 5}));
+  my_list.insert_many_back(10, 11);
+  my_list.insert_many_front(0, -1);
+  EXPECT_TRUE(compare_lists(
+      my_list, std::list<int>{-1, 0, 1, 7, 8, 9, 2, 3, 4, 5, 10, 11}));
+}
@@ -1,4 +1,5 @@
 #include <initializer_list>
+#include <string>
 #include <vector>
 
 #include "testing.h"
@@ -495,3 +496,64 @@ TEST(vector, insert_many_back) {
     EXPECT_EQ(s21_vector[i], i);
   }
 }
+
+TEST(vector, emplace_back) {
+  s21::vector<std::string> s21_vector;
+  std::vector<std::string> std_vector;
+  for (int i{}; i < 20; i++) {
+    s21_vector.emplace_back(3, char('a' + i));
+    std_vector.emplace_back(3, char('a' + i));
+  }
+  s21_vector.pop_back();
+  std_vector.pop_back();
+
+  EXPECT_EQ(s21_vector.size(), std_vector.size());
+  EXPECT_EQ(s21_vector.capacity(), std_vector.capacity());
+  for (unsigned i{}; i < s21_vector.size(); i++) {
+    EXPECT_EQ(s21_vector[i], std_vector[i]);
+  }
+}
+
+TEST(vector, insert_strings) {
+  s21::vector<std::string> s21_vector{"b", "d"};
+  std::vector<std::string> std_vector{"b", "d"};
+  // Without spare capacity, at the front, the end and in the middle.
+  EXPECT_EQ(*s21_vector.insert(s21_vector.begin(), "a"), "a");
+  std_vector.insert(std_vector.begin(), "a");
+  s21_vector.reserve(8);
+  std_vector.reserve(8);
+  EXPECT_EQ(*s21_vector.insert(s21_vector.end(), "e"), "e");
+  std_vector.insert(std_vector.end(), "e");
+  EXPECT_EQ(*s21_vector.insert(s21_vector.begin() + 2, "c"), "c");
+  std_vector.insert(std_vector.begin() + 2, "c");
+  EXPECT_EQ(*s21_vector.insert(s21_vector.begin(), s21_vector[4]), "e");
+  std_vector.insert(std_vector.begin(), std_vector[4]);
+  s21::vector<std::string> full{"x", "y", "z"};
+  full.insert(full.end(), full[0]);
+
+  ASSERT_EQ(s21_vector.size(), std_vector.size());
+  for (unsigned i{}; i < s21_vector.size(); i++) {
+    EXPECT_EQ(s21_vector[i], std_vector[i]);
+  }
+  ASSERT_EQ(full.size(), 4);
+  EXPECT_EQ(full[3], "x");
+}
+
+TEST(vector, erase_strings) {
+  s21::vector<std::string> s21_vector{"a", "b", "c", "d"};
+  s21_vector.erase(s21_vector.begin());
+  s21_vector.erase(s21_vector.begin() + 1);
+  s21_vector.erase(s21_vector.end() - 1);
+  ASSERT_EQ(s21_vector.size(), 1);
+  EXPECT_EQ(s21_vector[0], "b");
+  EXPECT_EQ(s21_vector.capacity(), 4);
+}
+
+TEST(vector, emplace_back_own_element) {
+  s21::vector<std::string> s21_vector{"first"};
+  s21_vector.emplace_back(s21_vector[0]);
+  s21_vector.emplace_back(s21_vector.back());
+  ASSERT_EQ(s21_vector.size(), 3);
+  EXPECT_EQ(s21_vector[1], "first");
+  EXPECT_EQ(s21_vector[2], "first");
+}
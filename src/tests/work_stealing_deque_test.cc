@@ -0,0 +1,82 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "testing.h"
+
+TEST(WorkStealingDequeTest, OwnerIsLifo) {
+  s21::work_stealing_deque<int> d(4);
+  EXPECT_TRUE(d.empty());
+  int out = 0;
+  EXPECT_FALSE(d.pop(out));
+  for (int i = 0; i < 3; i++) d.push(i);
+  EXPECT_EQ(d.size(), 3);
+  EXPECT_TRUE(d.pop(out));
+  EXPECT_EQ(out, 2);
+  EXPECT_TRUE(d.pop(out));
+  EXPECT_EQ(out, 1);
+}
+
+TEST(WorkStealingDequeTest, ThiefIsFifo) {
+  s21::work_stealing_deque<int> d;
+  for (int i = 0; i < 3; i++) d.push(i);
+  int out = 0;
+  EXPECT_TRUE(d.steal(out));
+  EXPECT_EQ(out, 0);
+  EXPECT_TRUE(d.pop(out));
+  EXPECT_EQ(out, 2);
+  EXPECT_TRUE(d.steal(out));
+  EXPECT_EQ(out, 1);
+  EXPECT_FALSE(d.steal(out));
+  EXPECT_FALSE(d.pop(out));
+  EXPECT_TRUE(d.empty());
+}
+
+TEST(WorkStealingDequeTest, GrowsWhenFull) {
+  s21::work_stealing_deque<int> d(2);
+  int out = 0;
+  d.push(-1);
+  EXPECT_TRUE(d.steal(out));
+  for (int i = 0; i < 100; i++) d.push(i);
+  EXPECT_GE(d.capacity(), 100);
+  EXPECT_EQ(d.size(), 100);
+  for (int i = 0; i < 50; i++) {
+    EXPECT_TRUE(d.steal(out));
+    EXPECT_EQ(out, i);
+  }
+  for (int i = 99; i >= 50; i--) {
+    EXPECT_TRUE(d.pop(out));
+    EXPECT_EQ(out, i);
+  }
+}
+
+TEST(WorkStealingDequeTest, EveryValueTakenOnce) {
+  const int kCount = 100000;
+  const int kThieves = 3;
+  s21::work_stealing_deque<int> d(8);
+  std::vector<std::atomic<int>> taken(kCount);
+  std::atomic<bool> done(false);
+  std::vector<std::thread> thieves;
+  for (int t = 0; t < kThieves; t++) {
+    thieves.emplace_back([&] {
+      int value = 0;
+      while (!done.load()) {
+        if (d.steal(value)) {
+          taken[value]++;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  int value = 0;
+  for (int i = 0; i < kCount; i++) {
+    d.push(i);
+    if (i % 3 == 0 && d.pop(value)) taken[value]++;
+  }
+  while (d.pop(value)) taken[value]++;
+  while (!d.empty()) std::this_thread::yield();
+  done = true;
+  for (auto &thief : thieves) thief.join();
+  for (int i = 0; i < kCount; i++) EXPECT_EQ(taken[i].load(), 1) << i;
+}